@@ -3,1495 +3,2941 @@
 #ifndef EVENT_NAMES_H
 #define EVENT_NAMES_H
 
-static const char * const ev_map[EV_MAX + 1] = {
-	[EV_SYN] = "EV_SYN",
-	[EV_KEY] = "EV_KEY",
-	[EV_REL] = "EV_REL",
-	[EV_ABS] = "EV_ABS",
-	[EV_MSC] = "EV_MSC",
-	[EV_SW] = "EV_SW",
-	[EV_LED] = "EV_LED",
-	[EV_SND] = "EV_SND",
-	[EV_REP] = "EV_REP",
-	[EV_FF] = "EV_FF",
-	[EV_PWR] = "EV_PWR",
-	[EV_FF_STATUS] = "EV_FF_STATUS",
-	[EV_MAX] = "EV_MAX",
-};
+static const char names_blob[] =
+	"\0"
+	"\006EV_SYN\0"
+	"\006EV_KEY\0"
+	"\006EV_REL\0"
+	"\006EV_ABS\0"
+	"\006EV_MSC\0"
+	"\005EV_SW\0"
+	"\006EV_LED\0"
+	"\006EV_SND\0"
+	"\006EV_REP\0"
+	"\005EV_FF\0"
+	"\006EV_PWR\0"
+	"\014EV_FF_STATUS\0"
+	"\006EV_MAX\0"
+	"\022INPUT_PROP_POINTER\0"
+	"\021INPUT_PROP_DIRECT\0"
+	"\024INPUT_PROP_BUTTONPAD\0"
+	"\022INPUT_PROP_SEMI_MT\0"
+	"\027INPUT_PROP_TOPBUTTONPAD\0"
+	"\031INPUT_PROP_POINTING_STICK\0"
+	"\030INPUT_PROP_ACCELEROMETER\0"
+	"\016INPUT_PROP_MAX\0"
+	"\016MT_TOOL_FINGER\0"
+	"\013MT_TOOL_PEN\0"
+	"\014MT_TOOL_PALM\0"
+	"\014MT_TOOL_DIAL\0"
+	"\013MT_TOOL_MAX\0"
+	"\005REL_X\0"
+	"\005REL_Y\0"
+	"\005REL_Z\0"
+	"\006REL_RX\0"
+	"\006REL_RY\0"
+	"\006REL_RZ\0"
+	"\012REL_HWHEEL\0"
+	"\010REL_DIAL\0"
+	"\011REL_WHEEL\0"
+	"\010REL_MISC\0"
+	"\014REL_RESERVED\0"
+	"\020REL_WHEEL_HI_RES\0"
+	"\021REL_HWHEEL_HI_RES\0"
+	"\007REL_MAX\0"
+	"\005ABS_X\0"
+	"\005ABS_Y\0"
+	"\005ABS_Z\0"
+	"\006ABS_RX\0"
+	"\006ABS_RY\0"
+	"\006ABS_RZ\0"
+	"\014ABS_THROTTLE\0"
+	"\012ABS_RUDDER\0"
+	"\011ABS_WHEEL\0"
+	"\007ABS_GAS\0"
+	"\011ABS_BRAKE\0"
+	"\011ABS_HAT0X\0"
+	"\011ABS_HAT0Y\0"
+	"\011ABS_HAT1X\0"
+	"\011ABS_HAT1Y\0"
+	"\011ABS_HAT2X\0"
+	"\011ABS_HAT2Y\0"
+	"\011ABS_HAT3X\0"
+	"\011ABS_HAT3Y\0"
+	"\014ABS_PRESSURE\0"
+	"\014ABS_DISTANCE\0"
+	"\012ABS_TILT_X\0"
+	"\012ABS_TILT_Y\0"
+	"\016ABS_TOOL_WIDTH\0"
+	"\012ABS_VOLUME\0"
+	"\013ABS_PROFILE\0"
+	"\010ABS_MISC\0"
+	"\014ABS_RESERVED\0"
+	"\013ABS_MT_SLOT\0"
+	"\022ABS_MT_TOUCH_MAJOR\0"
+	"\022ABS_MT_TOUCH_MINOR\0"
+	"\022ABS_MT_WIDTH_MAJOR\0"
+	"\022ABS_MT_WIDTH_MINOR\0"
+	"\022ABS_MT_ORIENTATION\0"
+	"\021ABS_MT_POSITION_X\0"
+	"\021ABS_MT_POSITION_Y\0"
+	"\020ABS_MT_TOOL_TYPE\0"
+	"\016ABS_MT_BLOB_ID\0"
+	"\022ABS_MT_TRACKING_ID\0"
+	"\017ABS_MT_PRESSURE\0"
+	"\017ABS_MT_DISTANCE\0"
+	"\015ABS_MT_TOOL_X\0"
+	"\015ABS_MT_TOOL_Y\0"
+	"\007ABS_MAX\0"
+	"\014KEY_RESERVED\0"
+	"\007KEY_ESC\0"
+	"\005KEY_1\0"
+	"\005KEY_2\0"
+	"\005KEY_3\0"
+	"\005KEY_4\0"
+	"\005KEY_5\0"
+	"\005KEY_6\0"
+	"\005KEY_7\0"
+	"\005KEY_8\0"
+	"\005KEY_9\0"
+	"\005KEY_0\0"
+	"\011KEY_MINUS\0"
+	"\011KEY_EQUAL\0"
+	"\015KEY_BACKSPACE\0"
+	"\007KEY_TAB\0"
+	"\005KEY_Q\0"
+	"\005KEY_W\0"
+	"\005KEY_E\0"
+	"\005KEY_R\0"
+	"\005KEY_T\0"
+	"\005KEY_Y\0"
+	"\005KEY_U\0"
+	"\005KEY_I\0"
+	"\005KEY_O\0"
+	"\005KEY_P\0"
+	"\015KEY_LEFTBRACE\0"
+	"\016KEY_RIGHTBRACE\0"
+	"\011KEY_ENTER\0"
+	"\014KEY_LEFTCTRL\0"
+	"\005KEY_A\0"
+	"\005KEY_S\0"
+	"\005KEY_D\0"
+	"\005KEY_F\0"
+	"\005KEY_G\0"
+	"\005KEY_H\0"
+	"\005KEY_J\0"
+	"\005KEY_K\0"
+	"\005KEY_L\0"
+	"\015KEY_SEMICOLON\0"
+	"\016KEY_APOSTROPHE\0"
+	"\011KEY_GRAVE\0"
+	"\015KEY_LEFTSHIFT\0"
+	"\015KEY_BACKSLASH\0"
+	"\005KEY_Z\0"
+	"\005KEY_X\0"
+	"\005KEY_C\0"
+	"\005KEY_V\0"
+	"\005KEY_B\0"
+	"\005KEY_N\0"
+	"\005KEY_M\0"
+	"\011KEY_COMMA\0"
+	"\007KEY_DOT\0"
+	"\011KEY_SLASH\0"
+	"\016KEY_RIGHTSHIFT\0"
+	"\016KEY_KPASTERISK\0"
+	"\013KEY_LEFTALT\0"
+	"\011KEY_SPACE\0"
+	"\014KEY_CAPSLOCK\0"
+	"\006KEY_F1\0"
+	"\006KEY_F2\0"
+	"\006KEY_F3\0"
+	"\006KEY_F4\0"
+	"\006KEY_F5\0"
+	"\006KEY_F6\0"
+	"\006KEY_F7\0"
+	"\006KEY_F8\0"
+	"\006KEY_F9\0"
+	"\007KEY_F10\0"
+	"\013KEY_NUMLOCK\0"
+	"\016KEY_SCROLLLOCK\0"
+	"\007KEY_KP7\0"
+	"\007KEY_KP8\0"
+	"\007KEY_KP9\0"
+	"\013KEY_KPMINUS\0"
+	"\007KEY_KP4\0"
+	"\007KEY_KP5\0"
+	"\007KEY_KP6\0"
+	"\012KEY_KPPLUS\0"
+	"\007KEY_KP1\0"
+	"\007KEY_KP2\0"
+	"\007KEY_KP3\0"
+	"\007KEY_KP0\0"
+	"\011KEY_KPDOT\0"
+	"\022KEY_ZENKAKUHANKAKU\0"
+	"\011KEY_102ND\0"
+	"\007KEY_F11\0"
+	"\007KEY_F12\0"
+	"\006KEY_RO\0"
+	"\014KEY_KATAKANA\0"
+	"\014KEY_HIRAGANA\0"
+	"\012KEY_HENKAN\0"
+	"\024KEY_KATAKANAHIRAGANA\0"
+	"\014KEY_MUHENKAN\0"
+	"\015KEY_KPJPCOMMA\0"
+	"\013KEY_KPENTER\0"
+	"\015KEY_RIGHTCTRL\0"
+	"\013KEY_KPSLASH\0"
+	"\011KEY_SYSRQ\0"
+	"\014KEY_RIGHTALT\0"
+	"\014KEY_LINEFEED\0"
+	"\010KEY_HOME\0"
+	"\006KEY_UP\0"
+	"\012KEY_PAGEUP\0"
+	"\010KEY_LEFT\0"
+	"\011KEY_RIGHT\0"
+	"\007KEY_END\0"
+	"\010KEY_DOWN\0"
+	"\014KEY_PAGEDOWN\0"
+	"\012KEY_INSERT\0"
+	"\012KEY_DELETE\0"
+	"\011KEY_MACRO\0"
+	"\010KEY_MUTE\0"
+	"\016KEY_VOLUMEDOWN\0"
+	"\014KEY_VOLUMEUP\0"
+	"\011KEY_POWER\0"
+	"\013KEY_KPEQUAL\0"
+	"\017KEY_KPPLUSMINUS\0"
+	"\011KEY_PAUSE\0"
+	"\011KEY_SCALE\0"
+	"\013KEY_KPCOMMA\0"
+	"\013KEY_HANGEUL\0"
+	"\011KEY_HANJA\0"
+	"\007KEY_YEN\0"
+	"\014KEY_LEFTMETA\0"
+	"\015KEY_RIGHTMETA\0"
+	"\013KEY_COMPOSE\0"
+	"\010KEY_STOP\0"
+	"\011KEY_AGAIN\0"
+	"\011KEY_PROPS\0"
+	"\010KEY_UNDO\0"
+	"\011KEY_FRONT\0"
+	"\010KEY_COPY\0"
+	"\010KEY_OPEN\0"
+	"\011KEY_PASTE\0"
+	"\010KEY_FIND\0"
+	"\007KEY_CUT\0"
+	"\010KEY_HELP\0"
+	"\010KEY_MENU\0"
+	"\010KEY_CALC\0"
+	"\011KEY_SETUP\0"
+	"\011KEY_SLEEP\0"
+	"\012KEY_WAKEUP\0"
+	"\010KEY_FILE\0"
+	"\014KEY_SENDFILE\0"
+	"\016KEY_DELETEFILE\0"
+	"\010KEY_XFER\0"
+	"\011KEY_PROG1\0"
+	"\011KEY_PROG2\0"
+	"\007KEY_WWW\0"
+	"\011KEY_MSDOS\0"
+	"\012KEY_COFFEE\0"
+	"\022KEY_ROTATE_DISPLAY\0"
+	"\020KEY_CYCLEWINDOWS\0"
+	"\010KEY_MAIL\0"
+	"\015KEY_BOOKMARKS\0"
+	"\014KEY_COMPUTER\0"
+	"\010KEY_BACK\0"
+	"\013KEY_FORWARD\0"
+	"\013KEY_CLOSECD\0"
+	"\013KEY_EJECTCD\0"
+	"\020KEY_EJECTCLOSECD\0"
+	"\014KEY_NEXTSONG\0"
+	"\015KEY_PLAYPAUSE\0"
+	"\020KEY_PREVIOUSSONG\0"
+	"\012KEY_STOPCD\0"
+	"\012KEY_RECORD\0"
+	"\012KEY_REWIND\0"
+	"\011KEY_PHONE\0"
+	"\007KEY_ISO\0"
+	"\012KEY_CONFIG\0"
+	"\014KEY_HOMEPAGE\0"
+	"\013KEY_REFRESH\0"
+	"\010KEY_EXIT\0"
+	"\010KEY_MOVE\0"
+	"\010KEY_EDIT\0"
+	"\014KEY_SCROLLUP\0"
+	"\016KEY_SCROLLDOWN\0"
+	"\017KEY_KPLEFTPAREN\0"
+	"\020KEY_KPRIGHTPAREN\0"
+	"\007KEY_NEW\0"
+	"\010KEY_REDO\0"
+	"\007KEY_F13\0"
+	"\007KEY_F14\0"
+	"\007KEY_F15\0"
+	"\007KEY_F16\0"
+	"\007KEY_F17\0"
+	"\007KEY_F18\0"
+	"\007KEY_F19\0"
+	"\007KEY_F20\0"
+	"\007KEY_F21\0"
+	"\007KEY_F22\0"
+	"\007KEY_F23\0"
+	"\007KEY_F24\0"
+	"\012KEY_PLAYCD\0"
+	"\013KEY_PAUSECD\0"
+	"\011KEY_PROG3\0"
+	"\011KEY_PROG4\0"
+	"\024KEY_ALL_APPLICATIONS\0"
+	"\013KEY_SUSPEND\0"
+	"\011KEY_CLOSE\0"
+	"\010KEY_PLAY\0"
+	"\017KEY_FASTFORWARD\0"
+	"\015KEY_BASSBOOST\0"
+	"\011KEY_PRINT\0"
+	"\006KEY_HP\0"
+	"\012KEY_CAMERA\0"
+	"\011KEY_SOUND\0"
+	"\014KEY_QUESTION\0"
+	"\011KEY_EMAIL\0"
+	"\010KEY_CHAT\0"
+	"\012KEY_SEARCH\0"
+	"\013KEY_CONNECT\0"
+	"\013KEY_FINANCE\0"
+	"\011KEY_SPORT\0"
+	"\010KEY_SHOP\0"
+	"\014KEY_ALTERASE\0"
+	"\012KEY_CANCEL\0"
+	"\022KEY_BRIGHTNESSDOWN\0"
+	"\020KEY_BRIGHTNESSUP\0"
+	"\011KEY_MEDIA\0"
+	"\023KEY_SWITCHVIDEOMODE\0"
+	"\022KEY_KBDILLUMTOGGLE\0"
+	"\020KEY_KBDILLUMDOWN\0"
+	"\016KEY_KBDILLUMUP\0"
+	"\010KEY_SEND\0"
+	"\011KEY_REPLY\0"
+	"\017KEY_FORWARDMAIL\0"
+	"\010KEY_SAVE\0"
+	"\015KEY_DOCUMENTS\0"
+	"\013KEY_BATTERY\0"
+	"\015KEY_BLUETOOTH\0"
+	"\010KEY_WLAN\0"
+	"\007KEY_UWB\0"
+	"\013KEY_UNKNOWN\0"
+	"\016KEY_VIDEO_NEXT\0"
+	"\016KEY_VIDEO_PREV\0"
+	"\024KEY_BRIGHTNESS_CYCLE\0"
+	"\023KEY_BRIGHTNESS_AUTO\0"
+	"\017KEY_DISPLAY_OFF\0"
+	"\010KEY_WWAN\0"
+	"\012KEY_RFKILL\0"
+	"\013KEY_MICMUTE\0"
+	"\005BTN_0\0"
+	"\005BTN_1\0"
+	"\005BTN_2\0"
+	"\005BTN_3\0"
+	"\005BTN_4\0"
+	"\005BTN_5\0"
+	"\005BTN_6\0"
+	"\005BTN_7\0"
+	"\005BTN_8\0"
+	"\005BTN_9\0"
+	"\010BTN_LEFT\0"
+	"\011BTN_RIGHT\0"
+	"\012BTN_MIDDLE\0"
+	"\010BTN_SIDE\0"
+	"\011BTN_EXTRA\0"
+	"\013BTN_FORWARD\0"
+	"\010BTN_BACK\0"
+	"\010BTN_TASK\0"
+	"\013BTN_TRIGGER\0"
+	"\011BTN_THUMB\0"
+	"\012BTN_THUMB2\0"
+	"\007BTN_TOP\0"
+	"\010BTN_TOP2\0"
+	"\012BTN_PINKIE\0"
+	"\010BTN_BASE\0"
+	"\011BTN_BASE2\0"
+	"\011BTN_BASE3\0"
+	"\011BTN_BASE4\0"
+	"\011BTN_BASE5\0"
+	"\011BTN_BASE6\0"
+	"\010BTN_DEAD\0"
+	"\011BTN_SOUTH\0"
+	"\010BTN_EAST\0"
+	"\005BTN_C\0"
+	"\011BTN_NORTH\0"
+	"\010BTN_WEST\0"
+	"\005BTN_Z\0"
+	"\006BTN_TL\0"
+	"\006BTN_TR\0"
+	"\007BTN_TL2\0"
+	"\007BTN_TR2\0"
+	"\012BTN_SELECT\0"
+	"\011BTN_START\0"
+	"\010BTN_MODE\0"
+	"\012BTN_THUMBL\0"
+	"\012BTN_THUMBR\0"
+	"\014BTN_TOOL_PEN\0"
+	"\017BTN_TOOL_RUBBER\0"
+	"\016BTN_TOOL_BRUSH\0"
+	"\017BTN_TOOL_PENCIL\0"
+	"\021BTN_TOOL_AIRBRUSH\0"
+	"\017BTN_TOOL_FINGER\0"
+	"\016BTN_TOOL_MOUSE\0"
+	"\015BTN_TOOL_LENS\0"
+	"\021BTN_TOOL_QUINTTAP\0"
+	"\013BTN_STYLUS3\0"
+	"\011BTN_TOUCH\0"
+	"\012BTN_STYLUS\0"
+	"\013BTN_STYLUS2\0"
+	"\022BTN_TOOL_DOUBLETAP\0"
+	"\022BTN_TOOL_TRIPLETAP\0"
+	"\020BTN_TOOL_QUADTAP\0"
+	"\015BTN_GEAR_DOWN\0"
+	"\013BTN_GEAR_UP\0"
+	"\006KEY_OK\0"
+	"\012KEY_SELECT\0"
+	"\010KEY_GOTO\0"
+	"\011KEY_CLEAR\0"
+	"\012KEY_POWER2\0"
+	"\012KEY_OPTION\0"
+	"\010KEY_INFO\0"
+	"\010KEY_TIME\0"
+	"\012KEY_VENDOR\0"
+	"\013KEY_ARCHIVE\0"
+	"\013KEY_PROGRAM\0"
+	"\013KEY_CHANNEL\0"
+	"\015KEY_FAVORITES\0"
+	"\007KEY_EPG\0"
+	"\007KEY_PVR\0"
+	"\007KEY_MHP\0"
+	"\014KEY_LANGUAGE\0"
+	"\011KEY_TITLE\0"
+	"\014KEY_SUBTITLE\0"
+	"\011KEY_ANGLE\0"
+	"\017KEY_FULL_SCREEN\0"
+	"\010KEY_MODE\0"
+	"\014KEY_KEYBOARD\0"
+	"\020KEY_ASPECT_RATIO\0"
+	"\006KEY_PC\0"
+	"\006KEY_TV\0"
+	"\007KEY_TV2\0"
+	"\007KEY_VCR\0"
+	"\010KEY_VCR2\0"
+	"\007KEY_SAT\0"
+	"\010KEY_SAT2\0"
+	"\006KEY_CD\0"
+	"\010KEY_TAPE\0"
+	"\011KEY_RADIO\0"
+	"\011KEY_TUNER\0"
+	"\012KEY_PLAYER\0"
+	"\010KEY_TEXT\0"
+	"\007KEY_DVD\0"
+	"\007KEY_AUX\0"
+	"\007KEY_MP3\0"
+	"\011KEY_AUDIO\0"
+	"\011KEY_VIDEO\0"
+	"\015KEY_DIRECTORY\0"
+	"\010KEY_LIST\0"
+	"\010KEY_MEMO\0"
+	"\014KEY_CALENDAR\0"
+	"\007KEY_RED\0"
+	"\011KEY_GREEN\0"
+	"\012KEY_YELLOW\0"
+	"\010KEY_BLUE\0"
+	"\015KEY_CHANNELUP\0"
+	"\017KEY_CHANNELDOWN\0"
+	"\011KEY_FIRST\0"
+	"\010KEY_LAST\0"
+	"\006KEY_AB\0"
+	"\010KEY_NEXT\0"
+	"\013KEY_RESTART\0"
+	"\010KEY_SLOW\0"
+	"\013KEY_SHUFFLE\0"
+	"\011KEY_BREAK\0"
+	"\014KEY_PREVIOUS\0"
+	"\012KEY_DIGITS\0"
+	"\010KEY_TEEN\0"
+	"\010KEY_TWEN\0"
+	"\016KEY_VIDEOPHONE\0"
+	"\011KEY_GAMES\0"
+	"\012KEY_ZOOMIN\0"
+	"\013KEY_ZOOMOUT\0"
+	"\015KEY_ZOOMRESET\0"
+	"\021KEY_WORDPROCESSOR\0"
+	"\012KEY_EDITOR\0"
+	"\017KEY_SPREADSHEET\0"
+	"\022KEY_GRAPHICSEDITOR\0"
+	"\020KEY_PRESENTATION\0"
+	"\014KEY_DATABASE\0"
+	"\010KEY_NEWS\0"
+	"\015KEY_VOICEMAIL\0"
+	"\017KEY_ADDRESSBOOK\0"
+	"\015KEY_MESSENGER\0"
+	"\021KEY_DISPLAYTOGGLE\0"
+	"\016KEY_SPELLCHECK\0"
+	"\012KEY_LOGOFF\0"
+	"\012KEY_DOLLAR\0"
+	"\010KEY_EURO\0"
+	"\015KEY_FRAMEBACK\0"
+	"\020KEY_FRAMEFORWARD\0"
+	"\020KEY_CONTEXT_MENU\0"
+	"\020KEY_MEDIA_REPEAT\0"
+	"\020KEY_10CHANNELSUP\0"
+	"\022KEY_10CHANNELSDOWN\0"
+	"\012KEY_IMAGES\0"
+	"\027KEY_NOTIFICATION_CENTER\0"
+	"\020KEY_PICKUP_PHONE\0"
+	"\020KEY_HANGUP_PHONE\0"
+	"\013KEY_DEL_EOL\0"
+	"\013KEY_DEL_EOS\0"
+	"\014KEY_INS_LINE\0"
+	"\014KEY_DEL_LINE\0"
+	"\006KEY_FN\0"
+	"\012KEY_FN_ESC\0"
+	"\011KEY_FN_F1\0"
+	"\011KEY_FN_F2\0"
+	"\011KEY_FN_F3\0"
+	"\011KEY_FN_F4\0"
+	"\011KEY_FN_F5\0"
+	"\011KEY_FN_F6\0"
+	"\011KEY_FN_F7\0"
+	"\011KEY_FN_F8\0"
+	"\011KEY_FN_F9\0"
+	"\012KEY_FN_F10\0"
+	"\012KEY_FN_F11\0"
+	"\012KEY_FN_F12\0"
+	"\010KEY_FN_1\0"
+	"\010KEY_FN_2\0"
+	"\010KEY_FN_D\0"
+	"\010KEY_FN_E\0"
+	"\010KEY_FN_F\0"
+	"\010KEY_FN_S\0"
+	"\010KEY_FN_B\0"
+	"\022KEY_FN_RIGHT_SHIFT\0"
+	"\014KEY_BRL_DOT1\0"
+	"\014KEY_BRL_DOT2\0"
+	"\014KEY_BRL_DOT3\0"
+	"\014KEY_BRL_DOT4\0"
+	"\014KEY_BRL_DOT5\0"
+	"\014KEY_BRL_DOT6\0"
+	"\014KEY_BRL_DOT7\0"
+	"\014KEY_BRL_DOT8\0"
+	"\014KEY_BRL_DOT9\0"
+	"\015KEY_BRL_DOT10\0"
+	"\015KEY_NUMERIC_0\0"
+	"\015KEY_NUMERIC_1\0"
+	"\015KEY_NUMERIC_2\0"
+	"\015KEY_NUMERIC_3\0"
+	"\015KEY_NUMERIC_4\0"
+	"\015KEY_NUMERIC_5\0"
+	"\015KEY_NUMERIC_6\0"
+	"\015KEY_NUMERIC_7\0"
+	"\015KEY_NUMERIC_8\0"
+	"\015KEY_NUMERIC_9\0"
+	"\020KEY_NUMERIC_STAR\0"
+	"\021KEY_NUMERIC_POUND\0"
+	"\015KEY_NUMERIC_A\0"
+	"\015KEY_NUMERIC_B\0"
+	"\015KEY_NUMERIC_C\0"
+	"\015KEY_NUMERIC_D\0"
+	"\020KEY_CAMERA_FOCUS\0"
+	"\016KEY_WPS_BUTTON\0"
+	"\023KEY_TOUCHPAD_TOGGLE\0"
+	"\017KEY_TOUCHPAD_ON\0"
+	"\020KEY_TOUCHPAD_OFF\0"
+	"\021KEY_CAMERA_ZOOMIN\0"
+	"\022KEY_CAMERA_ZOOMOUT\0"
+	"\015KEY_CAMERA_UP\0"
+	"\017KEY_CAMERA_DOWN\0"
+	"\017KEY_CAMERA_LEFT\0"
+	"\020KEY_CAMERA_RIGHT\0"
+	"\020KEY_ATTENDANT_ON\0"
+	"\021KEY_ATTENDANT_OFF\0"
+	"\024KEY_ATTENDANT_TOGGLE\0"
+	"\021KEY_LIGHTS_TOGGLE\0"
+	"\013BTN_DPAD_UP\0"
+	"\015BTN_DPAD_DOWN\0"
+	"\015BTN_DPAD_LEFT\0"
+	"\016BTN_DPAD_RIGHT\0"
+	"\016KEY_ALS_TOGGLE\0"
+	"\026KEY_ROTATE_LOCK_TOGGLE\0"
+	"\020KEY_BUTTONCONFIG\0"
+	"\017KEY_TASKMANAGER\0"
+	"\013KEY_JOURNAL\0"
+	"\020KEY_CONTROLPANEL\0"
+	"\015KEY_APPSELECT\0"
+	"\017KEY_SCREENSAVER\0"
+	"\020KEY_VOICECOMMAND\0"
+	"\015KEY_ASSISTANT\0"
+	"\023KEY_KBD_LAYOUT_NEXT\0"
+	"\020KEY_EMOJI_PICKER\0"
+	"\013KEY_DICTATE\0"
+	"\030KEY_CAMERA_ACCESS_ENABLE\0"
+	"\031KEY_CAMERA_ACCESS_DISABLE\0"
+	"\030KEY_CAMERA_ACCESS_TOGGLE\0"
+	"\022KEY_BRIGHTNESS_MIN\0"
+	"\022KEY_BRIGHTNESS_MAX\0"
+	"\027KEY_KBDINPUTASSIST_PREV\0"
+	"\027KEY_KBDINPUTASSIST_NEXT\0"
+	"\034KEY_KBDINPUTASSIST_PREVGROUP\0"
+	"\034KEY_KBDINPUTASSIST_NEXTGROUP\0"
+	"\031KEY_KBDINPUTASSIST_ACCEPT\0"
+	"\031KEY_KBDINPUTASSIST_CANCEL\0"
+	"\014KEY_RIGHT_UP\0"
+	"\016KEY_RIGHT_DOWN\0"
+	"\013KEY_LEFT_UP\0"
+	"\015KEY_LEFT_DOWN\0"
+	"\015KEY_ROOT_MENU\0"
+	"\022KEY_MEDIA_TOP_MENU\0"
+	"\016KEY_NUMERIC_11\0"
+	"\016KEY_NUMERIC_12\0"
+	"\016KEY_AUDIO_DESC\0"
+	"\013KEY_3D_MODE\0"
+	"\021KEY_NEXT_FAVORITE\0"
+	"\017KEY_STOP_RECORD\0"
+	"\020KEY_PAUSE_RECORD\0"
+	"\007KEY_VOD\0"
+	"\012KEY_UNMUTE\0"
+	"\017KEY_FASTREVERSE\0"
+	"\017KEY_SLOWREVERSE\0"
+	"\010KEY_DATA\0"
+	"\025KEY_ONSCREEN_KEYBOARD\0"
+	"\031KEY_PRIVACY_SCREEN_TOGGLE\0"
+	"\030KEY_SELECTIVE_SCREENSHOT\0"
+	"\020KEY_NEXT_ELEMENT\0"
+	"\024KEY_PREVIOUS_ELEMENT\0"
+	"\033KEY_AUTOPILOT_ENGAGE_TOGGLE\0"
+	"\021KEY_MARK_WAYPOINT\0"
+	"\007KEY_SOS\0"
+	"\015KEY_NAV_CHART\0"
+	"\021KEY_FISHING_CHART\0"
+	"\026KEY_SINGLE_RANGE_RADAR\0"
+	"\024KEY_DUAL_RANGE_RADAR\0"
+	"\021KEY_RADAR_OVERLAY\0"
+	"\025KEY_TRADITIONAL_SONAR\0"
+	"\021KEY_CLEARVU_SONAR\0"
+	"\020KEY_SIDEVU_SONAR\0"
+	"\014KEY_NAV_INFO\0"
+	"\023KEY_BRIGHTNESS_MENU\0"
+	"\012KEY_MACRO1\0"
+	"\012KEY_MACRO2\0"
+	"\012KEY_MACRO3\0"
+	"\012KEY_MACRO4\0"
+	"\012KEY_MACRO5\0"
+	"\012KEY_MACRO6\0"
+	"\012KEY_MACRO7\0"
+	"\012KEY_MACRO8\0"
+	"\012KEY_MACRO9\0"
+	"\013KEY_MACRO10\0"
+	"\013KEY_MACRO11\0"
+	"\013KEY_MACRO12\0"
+	"\013KEY_MACRO13\0"
+	"\013KEY_MACRO14\0"
+	"\013KEY_MACRO15\0"
+	"\013KEY_MACRO16\0"
+	"\013KEY_MACRO17\0"
+	"\013KEY_MACRO18\0"
+	"\013KEY_MACRO19\0"
+	"\013KEY_MACRO20\0"
+	"\013KEY_MACRO21\0"
+	"\013KEY_MACRO22\0"
+	"\013KEY_MACRO23\0"
+	"\013KEY_MACRO24\0"
+	"\013KEY_MACRO25\0"
+	"\013KEY_MACRO26\0"
+	"\013KEY_MACRO27\0"
+	"\013KEY_MACRO28\0"
+	"\013KEY_MACRO29\0"
+	"\013KEY_MACRO30\0"
+	"\026KEY_MACRO_RECORD_START\0"
+	"\025KEY_MACRO_RECORD_STOP\0"
+	"\026KEY_MACRO_PRESET_CYCLE\0"
+	"\021KEY_MACRO_PRESET1\0"
+	"\021KEY_MACRO_PRESET2\0"
+	"\021KEY_MACRO_PRESET3\0"
+	"\021KEY_KBD_LCD_MENU1\0"
+	"\021KEY_KBD_LCD_MENU2\0"
+	"\021KEY_KBD_LCD_MENU3\0"
+	"\021KEY_KBD_LCD_MENU4\0"
+	"\021KEY_KBD_LCD_MENU5\0"
+	"\022BTN_TRIGGER_HAPPY1\0"
+	"\022BTN_TRIGGER_HAPPY2\0"
+	"\022BTN_TRIGGER_HAPPY3\0"
+	"\022BTN_TRIGGER_HAPPY4\0"
+	"\022BTN_TRIGGER_HAPPY5\0"
+	"\022BTN_TRIGGER_HAPPY6\0"
+	"\022BTN_TRIGGER_HAPPY7\0"
+	"\022BTN_TRIGGER_HAPPY8\0"
+	"\022BTN_TRIGGER_HAPPY9\0"
+	"\023BTN_TRIGGER_HAPPY10\0"
+	"\023BTN_TRIGGER_HAPPY11\0"
+	"\023BTN_TRIGGER_HAPPY12\0"
+	"\023BTN_TRIGGER_HAPPY13\0"
+	"\023BTN_TRIGGER_HAPPY14\0"
+	"\023BTN_TRIGGER_HAPPY15\0"
+	"\023BTN_TRIGGER_HAPPY16\0"
+	"\023BTN_TRIGGER_HAPPY17\0"
+	"\023BTN_TRIGGER_HAPPY18\0"
+	"\023BTN_TRIGGER_HAPPY19\0"
+	"\023BTN_TRIGGER_HAPPY20\0"
+	"\023BTN_TRIGGER_HAPPY21\0"
+	"\023BTN_TRIGGER_HAPPY22\0"
+	"\023BTN_TRIGGER_HAPPY23\0"
+	"\023BTN_TRIGGER_HAPPY24\0"
+	"\023BTN_TRIGGER_HAPPY25\0"
+	"\023BTN_TRIGGER_HAPPY26\0"
+	"\023BTN_TRIGGER_HAPPY27\0"
+	"\023BTN_TRIGGER_HAPPY28\0"
+	"\023BTN_TRIGGER_HAPPY29\0"
+	"\023BTN_TRIGGER_HAPPY30\0"
+	"\023BTN_TRIGGER_HAPPY31\0"
+	"\023BTN_TRIGGER_HAPPY32\0"
+	"\023BTN_TRIGGER_HAPPY33\0"
+	"\023BTN_TRIGGER_HAPPY34\0"
+	"\023BTN_TRIGGER_HAPPY35\0"
+	"\023BTN_TRIGGER_HAPPY36\0"
+	"\023BTN_TRIGGER_HAPPY37\0"
+	"\023BTN_TRIGGER_HAPPY38\0"
+	"\023BTN_TRIGGER_HAPPY39\0"
+	"\023BTN_TRIGGER_HAPPY40\0"
+	"\007KEY_MAX\0"
+	"\010LED_NUML\0"
+	"\011LED_CAPSL\0"
+	"\013LED_SCROLLL\0"
+	"\013LED_COMPOSE\0"
+	"\010LED_KANA\0"
+	"\011LED_SLEEP\0"
+	"\013LED_SUSPEND\0"
+	"\010LED_MUTE\0"
+	"\010LED_MISC\0"
+	"\010LED_MAIL\0"
+	"\014LED_CHARGING\0"
+	"\007LED_MAX\0"
+	"\011SND_CLICK\0"
+	"\010SND_BELL\0"
+	"\010SND_TONE\0"
+	"\007SND_MAX\0"
+	"\012MSC_SERIAL\0"
+	"\014MSC_PULSELED\0"
+	"\013MSC_GESTURE\0"
+	"\007MSC_RAW\0"
+	"\010MSC_SCAN\0"
+	"\015MSC_TIMESTAMP\0"
+	"\007MSC_MAX\0"
+	"\006SW_LID\0"
+	"\016SW_TABLET_MODE\0"
+	"\023SW_HEADPHONE_INSERT\0"
+	"\015SW_RFKILL_ALL\0"
+	"\024SW_MICROPHONE_INSERT\0"
+	"\007SW_DOCK\0"
+	"\021SW_LINEOUT_INSERT\0"
+	"\027SW_JACK_PHYSICAL_INSERT\0"
+	"\022SW_VIDEOOUT_INSERT\0"
+	"\024SW_CAMERA_LENS_COVER\0"
+	"\017SW_KEYPAD_SLIDE\0"
+	"\022SW_FRONT_PROXIMITY\0"
+	"\016SW_ROTATE_LOCK\0"
+	"\020SW_LINEIN_INSERT\0"
+	"\016SW_MUTE_DEVICE\0"
+	"\017SW_PEN_INSERTED\0"
+	"\020SW_MACHINE_COVER\0"
+	"\021FF_STATUS_STOPPED\0"
+	"\015FF_STATUS_MAX\0"
+	"\011FF_RUMBLE\0"
+	"\013FF_PERIODIC\0"
+	"\013FF_CONSTANT\0"
+	"\011FF_SPRING\0"
+	"\013FF_FRICTION\0"
+	"\011FF_DAMPER\0"
+	"\012FF_INERTIA\0"
+	"\007FF_RAMP\0"
+	"\011FF_SQUARE\0"
+	"\013FF_TRIANGLE\0"
+	"\007FF_SINE\0"
+	"\011FF_SAW_UP\0"
+	"\013FF_SAW_DOWN\0"
+	"\011FF_CUSTOM\0"
+	"\007FF_GAIN\0"
+	"\015FF_AUTOCENTER\0"
+	"\006FF_MAX\0"
+	"\012SYN_REPORT\0"
+	"\012SYN_CONFIG\0"
+	"\015SYN_MT_REPORT\0"
+	"\013SYN_DROPPED\0"
+	"\007SYN_MAX\0"
+	"\011REP_DELAY\0"
+	"\012REP_PERIOD\0"
+	"\005BTN_A\0"
+	"\005BTN_B\0"
+	"\005BTN_X\0"
+	"\005BTN_Y\0"
+	"\007REP_MAX\0"
+	"\006SW_MAX\0"
+;
 
-static const char * const rel_map[REL_MAX + 1] = {
-	[REL_X] = "REL_X",
-	[REL_Y] = "REL_Y",
-	[REL_Z] = "REL_Z",
-	[REL_RX] = "REL_RX",
-	[REL_RY] = "REL_RY",
-	[REL_RZ] = "REL_RZ",
-	[REL_HWHEEL] = "REL_HWHEEL",
-	[REL_DIAL] = "REL_DIAL",
-	[REL_WHEEL] = "REL_WHEEL",
-	[REL_MISC] = "REL_MISC",
-	[REL_RESERVED] = "REL_RESERVED",
-	[REL_WHEEL_HI_RES] = "REL_WHEEL_HI_RES",
-	[REL_HWHEEL_HI_RES] = "REL_HWHEEL_HI_RES",
-	[REL_MAX] = "REL_MAX",
-};
+static inline const char *
+name_from_offset(unsigned short offset)
+{
+	return offset ? &names_blob[offset] : NULL;
+}
 
-static const char * const abs_map[ABS_MAX + 1] = {
-	[ABS_X] = "ABS_X",
-	[ABS_Y] = "ABS_Y",
-	[ABS_Z] = "ABS_Z",
-	[ABS_RX] = "ABS_RX",
-	[ABS_RY] = "ABS_RY",
-	[ABS_RZ] = "ABS_RZ",
-	[ABS_THROTTLE] = "ABS_THROTTLE",
-	[ABS_RUDDER] = "ABS_RUDDER",
-	[ABS_WHEEL] = "ABS_WHEEL",
-	[ABS_GAS] = "ABS_GAS",
-	[ABS_BRAKE] = "ABS_BRAKE",
-	[ABS_HAT0X] = "ABS_HAT0X",
-	[ABS_HAT0Y] = "ABS_HAT0Y",
-	[ABS_HAT1X] = "ABS_HAT1X",
-	[ABS_HAT1Y] = "ABS_HAT1Y",
-	[ABS_HAT2X] = "ABS_HAT2X",
-	[ABS_HAT2Y] = "ABS_HAT2Y",
-	[ABS_HAT3X] = "ABS_HAT3X",
-	[ABS_HAT3Y] = "ABS_HAT3Y",
-	[ABS_PRESSURE] = "ABS_PRESSURE",
-	[ABS_DISTANCE] = "ABS_DISTANCE",
-	[ABS_TILT_X] = "ABS_TILT_X",
-	[ABS_TILT_Y] = "ABS_TILT_Y",
-	[ABS_TOOL_WIDTH] = "ABS_TOOL_WIDTH",
-	[ABS_VOLUME] = "ABS_VOLUME",
-	[ABS_MISC] = "ABS_MISC",
-	[ABS_RESERVED] = "ABS_RESERVED",
-	[ABS_MT_SLOT] = "ABS_MT_SLOT",
-	[ABS_MT_TOUCH_MAJOR] = "ABS_MT_TOUCH_MAJOR",
-	[ABS_MT_TOUCH_MINOR] = "ABS_MT_TOUCH_MINOR",
-	[ABS_MT_WIDTH_MAJOR] = "ABS_MT_WIDTH_MAJOR",
-	[ABS_MT_WIDTH_MINOR] = "ABS_MT_WIDTH_MINOR",
-	[ABS_MT_ORIENTATION] = "ABS_MT_ORIENTATION",
-	[ABS_MT_POSITION_X] = "ABS_MT_POSITION_X",
-	[ABS_MT_POSITION_Y] = "ABS_MT_POSITION_Y",
-	[ABS_MT_TOOL_TYPE] = "ABS_MT_TOOL_TYPE",
-	[ABS_MT_BLOB_ID] = "ABS_MT_BLOB_ID",
-	[ABS_MT_TRACKING_ID] = "ABS_MT_TRACKING_ID",
-	[ABS_MT_PRESSURE] = "ABS_MT_PRESSURE",
-	[ABS_MT_DISTANCE] = "ABS_MT_DISTANCE",
-	[ABS_MT_TOOL_X] = "ABS_MT_TOOL_X",
-	[ABS_MT_TOOL_Y] = "ABS_MT_TOOL_Y",
-	[ABS_MAX] = "ABS_MAX",
-};
-
-static const char * const key_map[KEY_MAX + 1] = {
-	[KEY_RESERVED] = "KEY_RESERVED",
-	[KEY_ESC] = "KEY_ESC",
-	[KEY_1] = "KEY_1",
-	[KEY_2] = "KEY_2",
-	[KEY_3] = "KEY_3",
-	[KEY_4] = "KEY_4",
-	[KEY_5] = "KEY_5",
-	[KEY_6] = "KEY_6",
-	[KEY_7] = "KEY_7",
-	[KEY_8] = "KEY_8",
-	[KEY_9] = "KEY_9",
-	[KEY_0] = "KEY_0",
-	[KEY_MINUS] = "KEY_MINUS",
-	[KEY_EQUAL] = "KEY_EQUAL",
-	[KEY_BACKSPACE] = "KEY_BACKSPACE",
-	[KEY_TAB] = "KEY_TAB",
-	[KEY_Q] = "KEY_Q",
-	[KEY_W] = "KEY_W",
-	[KEY_E] = "KEY_E",
-	[KEY_R] = "KEY_R",
-	[KEY_T] = "KEY_T",
-	[KEY_Y] = "KEY_Y",
-	[KEY_U] = "KEY_U",
-	[KEY_I] = "KEY_I",
-	[KEY_O] = "KEY_O",
-	[KEY_P] = "KEY_P",
-	[KEY_LEFTBRACE] = "KEY_LEFTBRACE",
-	[KEY_RIGHTBRACE] = "KEY_RIGHTBRACE",
-	[KEY_ENTER] = "KEY_ENTER",
-	[KEY_LEFTCTRL] = "KEY_LEFTCTRL",
-	[KEY_A] = "KEY_A",
-	[KEY_S] = "KEY_S",
-	[KEY_D] = "KEY_D",
-	[KEY_F] = "KEY_F",
-	[KEY_G] = "KEY_G",
-	[KEY_H] = "KEY_H",
-	[KEY_J] = "KEY_J",
-	[KEY_K] = "KEY_K",
-	[KEY_L] = "KEY_L",
-	[KEY_SEMICOLON] = "KEY_SEMICOLON",
-	[KEY_APOSTROPHE] = "KEY_APOSTROPHE",
-	[KEY_GRAVE] = "KEY_GRAVE",
-	[KEY_LEFTSHIFT] = "KEY_LEFTSHIFT",
-	[KEY_BACKSLASH] = "KEY_BACKSLASH",
-	[KEY_Z] = "KEY_Z",
-	[KEY_X] = "KEY_X",
-	[KEY_C] = "KEY_C",
-	[KEY_V] = "KEY_V",
-	[KEY_B] = "KEY_B",
-	[KEY_N] = "KEY_N",
-	[KEY_M] = "KEY_M",
-	[KEY_COMMA] = "KEY_COMMA",
-	[KEY_DOT] = "KEY_DOT",
-	[KEY_SLASH] = "KEY_SLASH",
-	[KEY_RIGHTSHIFT] = "KEY_RIGHTSHIFT",
-	[KEY_KPASTERISK] = "KEY_KPASTERISK",
-	[KEY_LEFTALT] = "KEY_LEFTALT",
-	[KEY_SPACE] = "KEY_SPACE",
-	[KEY_CAPSLOCK] = "KEY_CAPSLOCK",
-	[KEY_F1] = "KEY_F1",
-	[KEY_F2] = "KEY_F2",
-	[KEY_F3] = "KEY_F3",
-	[KEY_F4] = "KEY_F4",
-	[KEY_F5] = "KEY_F5",
-	[KEY_F6] = "KEY_F6",
-	[KEY_F7] = "KEY_F7",
-	[KEY_F8] = "KEY_F8",
-	[KEY_F9] = "KEY_F9",
-	[KEY_F10] = "KEY_F10",
-	[KEY_NUMLOCK] = "KEY_NUMLOCK",
-	[KEY_SCROLLLOCK] = "KEY_SCROLLLOCK",
-	[KEY_KP7] = "KEY_KP7",
-	[KEY_KP8] = "KEY_KP8",
-	[KEY_KP9] = "KEY_KP9",
-	[KEY_KPMINUS] = "KEY_KPMINUS",
-	[KEY_KP4] = "KEY_KP4",
-	[KEY_KP5] = "KEY_KP5",
-	[KEY_KP6] = "KEY_KP6",
-	[KEY_KPPLUS] = "KEY_KPPLUS",
-	[KEY_KP1] = "KEY_KP1",
-	[KEY_KP2] = "KEY_KP2",
-	[KEY_KP3] = "KEY_KP3",
-	[KEY_KP0] = "KEY_KP0",
-	[KEY_KPDOT] = "KEY_KPDOT",
-	[KEY_ZENKAKUHANKAKU] = "KEY_ZENKAKUHANKAKU",
-	[KEY_102ND] = "KEY_102ND",
-	[KEY_F11] = "KEY_F11",
-	[KEY_F12] = "KEY_F12",
-	[KEY_RO] = "KEY_RO",
-	[KEY_KATAKANA] = "KEY_KATAKANA",
-	[KEY_HIRAGANA] = "KEY_HIRAGANA",
-	[KEY_HENKAN] = "KEY_HENKAN",
-	[KEY_KATAKANAHIRAGANA] = "KEY_KATAKANAHIRAGANA",
-	[KEY_MUHENKAN] = "KEY_MUHENKAN",
-	[KEY_KPJPCOMMA] = "KEY_KPJPCOMMA",
-	[KEY_KPENTER] = "KEY_KPENTER",
-	[KEY_RIGHTCTRL] = "KEY_RIGHTCTRL",
-	[KEY_KPSLASH] = "KEY_KPSLASH",
-	[KEY_SYSRQ] = "KEY_SYSRQ",
-	[KEY_RIGHTALT] = "KEY_RIGHTALT",
-	[KEY_LINEFEED] = "KEY_LINEFEED",
-	[KEY_HOME] = "KEY_HOME",
-	[KEY_UP] = "KEY_UP",
-	[KEY_PAGEUP] = "KEY_PAGEUP",
-	[KEY_LEFT] = "KEY_LEFT",
-	[KEY_RIGHT] = "KEY_RIGHT",
-	[KEY_END] = "KEY_END",
-	[KEY_DOWN] = "KEY_DOWN",
-	[KEY_PAGEDOWN] = "KEY_PAGEDOWN",
-	[KEY_INSERT] = "KEY_INSERT",
-	[KEY_DELETE] = "KEY_DELETE",
-	[KEY_MACRO] = "KEY_MACRO",
-	[KEY_MUTE] = "KEY_MUTE",
-	[KEY_VOLUMEDOWN] = "KEY_VOLUMEDOWN",
-	[KEY_VOLUMEUP] = "KEY_VOLUMEUP",
-	[KEY_POWER] = "KEY_POWER",
-	[KEY_KPEQUAL] = "KEY_KPEQUAL",
-	[KEY_KPPLUSMINUS] = "KEY_KPPLUSMINUS",
-	[KEY_PAUSE] = "KEY_PAUSE",
-	[KEY_SCALE] = "KEY_SCALE",
-	[KEY_KPCOMMA] = "KEY_KPCOMMA",
-	[KEY_HANGEUL] = "KEY_HANGEUL",
-	[KEY_HANJA] = "KEY_HANJA",
-	[KEY_YEN] = "KEY_YEN",
-	[KEY_LEFTMETA] = "KEY_LEFTMETA",
-	[KEY_RIGHTMETA] = "KEY_RIGHTMETA",
-	[KEY_COMPOSE] = "KEY_COMPOSE",
-	[KEY_STOP] = "KEY_STOP",
-	[KEY_AGAIN] = "KEY_AGAIN",
-	[KEY_PROPS] = "KEY_PROPS",
-	[KEY_UNDO] = "KEY_UNDO",
-	[KEY_FRONT] = "KEY_FRONT",
-	[KEY_COPY] = "KEY_COPY",
-	[KEY_OPEN] = "KEY_OPEN",
-	[KEY_PASTE] = "KEY_PASTE",
-	[KEY_FIND] = "KEY_FIND",
-	[KEY_CUT] = "KEY_CUT",
-	[KEY_HELP] = "KEY_HELP",
-	[KEY_MENU] = "KEY_MENU",
-	[KEY_CALC] = "KEY_CALC",
-	[KEY_SETUP] = "KEY_SETUP",
-	[KEY_SLEEP] = "KEY_SLEEP",
-	[KEY_WAKEUP] = "KEY_WAKEUP",
-	[KEY_FILE] = "KEY_FILE",
-	[KEY_SENDFILE] = "KEY_SENDFILE",
-	[KEY_DELETEFILE] = "KEY_DELETEFILE",
-	[KEY_XFER] = "KEY_XFER",
-	[KEY_PROG1] = "KEY_PROG1",
-	[KEY_PROG2] = "KEY_PROG2",
-	[KEY_WWW] = "KEY_WWW",
-	[KEY_MSDOS] = "KEY_MSDOS",
-	[KEY_COFFEE] = "KEY_COFFEE",
-	[KEY_ROTATE_DISPLAY] = "KEY_ROTATE_DISPLAY",
-	[KEY_CYCLEWINDOWS] = "KEY_CYCLEWINDOWS",
-	[KEY_MAIL] = "KEY_MAIL",
-	[KEY_BOOKMARKS] = "KEY_BOOKMARKS",
-	[KEY_COMPUTER] = "KEY_COMPUTER",
-	[KEY_BACK] = "KEY_BACK",
-	[KEY_FORWARD] = "KEY_FORWARD",
-	[KEY_CLOSECD] = "KEY_CLOSECD",
-	[KEY_EJECTCD] = "KEY_EJECTCD",
-	[KEY_EJECTCLOSECD] = "KEY_EJECTCLOSECD",
-	[KEY_NEXTSONG] = "KEY_NEXTSONG",
-	[KEY_PLAYPAUSE] = "KEY_PLAYPAUSE",
-	[KEY_PREVIOUSSONG] = "KEY_PREVIOUSSONG",
-	[KEY_STOPCD] = "KEY_STOPCD",
-	[KEY_RECORD] = "KEY_RECORD",
-	[KEY_REWIND] = "KEY_REWIND",
-	[KEY_PHONE] = "KEY_PHONE",
-	[KEY_ISO] = "KEY_ISO",
-	[KEY_CONFIG] = "KEY_CONFIG",
-	[KEY_HOMEPAGE] = "KEY_HOMEPAGE",
-	[KEY_REFRESH] = "KEY_REFRESH",
-	[KEY_EXIT] = "KEY_EXIT",
-	[KEY_MOVE] = "KEY_MOVE",
-	[KEY_EDIT] = "KEY_EDIT",
-	[KEY_SCROLLUP] = "KEY_SCROLLUP",
-	[KEY_SCROLLDOWN] = "KEY_SCROLLDOWN",
-	[KEY_KPLEFTPAREN] = "KEY_KPLEFTPAREN",
-	[KEY_KPRIGHTPAREN] = "KEY_KPRIGHTPAREN",
-	[KEY_NEW] = "KEY_NEW",
-	[KEY_REDO] = "KEY_REDO",
-	[KEY_F13] = "KEY_F13",
-	[KEY_F14] = "KEY_F14",
-	[KEY_F15] = "KEY_F15",
-	[KEY_F16] = "KEY_F16",
-	[KEY_F17] = "KEY_F17",
-	[KEY_F18] = "KEY_F18",
-	[KEY_F19] = "KEY_F19",
-	[KEY_F20] = "KEY_F20",
-	[KEY_F21] = "KEY_F21",
-	[KEY_F22] = "KEY_F22",
-	[KEY_F23] = "KEY_F23",
-	[KEY_F24] = "KEY_F24",
-	[KEY_PLAYCD] = "KEY_PLAYCD",
-	[KEY_PAUSECD] = "KEY_PAUSECD",
-	[KEY_PROG3] = "KEY_PROG3",
-	[KEY_PROG4] = "KEY_PROG4",
-	[KEY_DASHBOARD] = "KEY_DASHBOARD",
-	[KEY_SUSPEND] = "KEY_SUSPEND",
-	[KEY_CLOSE] = "KEY_CLOSE",
-	[KEY_PLAY] = "KEY_PLAY",
-	[KEY_FASTFORWARD] = "KEY_FASTFORWARD",
-	[KEY_BASSBOOST] = "KEY_BASSBOOST",
-	[KEY_PRINT] = "KEY_PRINT",
-	[KEY_HP] = "KEY_HP",
-	[KEY_CAMERA] = "KEY_CAMERA",
-	[KEY_SOUND] = "KEY_SOUND",
-	[KEY_QUESTION] = "KEY_QUESTION",
-	[KEY_EMAIL] = "KEY_EMAIL",
-	[KEY_CHAT] = "KEY_CHAT",
-	[KEY_SEARCH] = "KEY_SEARCH",
-	[KEY_CONNECT] = "KEY_CONNECT",
-	[KEY_FINANCE] = "KEY_FINANCE",
-	[KEY_SPORT] = "KEY_SPORT",
-	[KEY_SHOP] = "KEY_SHOP",
-	[KEY_ALTERASE] = "KEY_ALTERASE",
-	[KEY_CANCEL] = "KEY_CANCEL",
-	[KEY_BRIGHTNESSDOWN] = "KEY_BRIGHTNESSDOWN",
-	[KEY_BRIGHTNESSUP] = "KEY_BRIGHTNESSUP",
-	[KEY_MEDIA] = "KEY_MEDIA",
-	[KEY_SWITCHVIDEOMODE] = "KEY_SWITCHVIDEOMODE",
-	[KEY_KBDILLUMTOGGLE] = "KEY_KBDILLUMTOGGLE",
-	[KEY_KBDILLUMDOWN] = "KEY_KBDILLUMDOWN",
-	[KEY_KBDILLUMUP] = "KEY_KBDILLUMUP",
-	[KEY_SEND] = "KEY_SEND",
-	[KEY_REPLY] = "KEY_REPLY",
-	[KEY_FORWARDMAIL] = "KEY_FORWARDMAIL",
-	[KEY_SAVE] = "KEY_SAVE",
-	[KEY_DOCUMENTS] = "KEY_DOCUMENTS",
-	[KEY_BATTERY] = "KEY_BATTERY",
-	[KEY_BLUETOOTH] = "KEY_BLUETOOTH",
-	[KEY_WLAN] = "KEY_WLAN",
-	[KEY_UWB] = "KEY_UWB",
-	[KEY_UNKNOWN] = "KEY_UNKNOWN",
-	[KEY_VIDEO_NEXT] = "KEY_VIDEO_NEXT",
-	[KEY_VIDEO_PREV] = "KEY_VIDEO_PREV",
-	[KEY_BRIGHTNESS_CYCLE] = "KEY_BRIGHTNESS_CYCLE",
-	[KEY_BRIGHTNESS_AUTO] = "KEY_BRIGHTNESS_AUTO",
-	[KEY_DISPLAY_OFF] = "KEY_DISPLAY_OFF",
-	[KEY_WWAN] = "KEY_WWAN",
-	[KEY_RFKILL] = "KEY_RFKILL",
-	[KEY_MICMUTE] = "KEY_MICMUTE",
-	[KEY_OK] = "KEY_OK",
-	[KEY_SELECT] = "KEY_SELECT",
-	[KEY_GOTO] = "KEY_GOTO",
-	[KEY_CLEAR] = "KEY_CLEAR",
-	[KEY_POWER2] = "KEY_POWER2",
-	[KEY_OPTION] = "KEY_OPTION",
-	[KEY_INFO] = "KEY_INFO",
-	[KEY_TIME] = "KEY_TIME",
-	[KEY_VENDOR] = "KEY_VENDOR",
-	[KEY_ARCHIVE] = "KEY_ARCHIVE",
-	[KEY_PROGRAM] = "KEY_PROGRAM",
-	[KEY_CHANNEL] = "KEY_CHANNEL",
-	[KEY_FAVORITES] = "KEY_FAVORITES",
-	[KEY_EPG] = "KEY_EPG",
-	[KEY_PVR] = "KEY_PVR",
-	[KEY_MHP] = "KEY_MHP",
-	[KEY_LANGUAGE] = "KEY_LANGUAGE",
-	[KEY_TITLE] = "KEY_TITLE",
-	[KEY_SUBTITLE] = "KEY_SUBTITLE",
-	[KEY_ANGLE] = "KEY_ANGLE",
-	[KEY_FULL_SCREEN] = "KEY_FULL_SCREEN",
-	[KEY_MODE] = "KEY_MODE",
-	[KEY_KEYBOARD] = "KEY_KEYBOARD",
-	[KEY_ASPECT_RATIO] = "KEY_ASPECT_RATIO",
-	[KEY_PC] = "KEY_PC",
-	[KEY_TV] = "KEY_TV",
-	[KEY_TV2] = "KEY_TV2",
-	[KEY_VCR] = "KEY_VCR",
-	[KEY_VCR2] = "KEY_VCR2",
-	[KEY_SAT] = "KEY_SAT",
-	[KEY_SAT2] = "KEY_SAT2",
-	[KEY_CD] = "KEY_CD",
-	[KEY_TAPE] = "KEY_TAPE",
-	[KEY_RADIO] = "KEY_RADIO",
-	[KEY_TUNER] = "KEY_TUNER",
-	[KEY_PLAYER] = "KEY_PLAYER",
-	[KEY_TEXT] = "KEY_TEXT",
-	[KEY_DVD] = "KEY_DVD",
-	[KEY_AUX] = "KEY_AUX",
-	[KEY_MP3] = "KEY_MP3",
-	[KEY_AUDIO] = "KEY_AUDIO",
-	[KEY_VIDEO] = "KEY_VIDEO",
-	[KEY_DIRECTORY] = "KEY_DIRECTORY",
-	[KEY_LIST] = "KEY_LIST",
-	[KEY_MEMO] = "KEY_MEMO",
-	[KEY_CALENDAR] = "KEY_CALENDAR",
-	[KEY_RED] = "KEY_RED",
-	[KEY_GREEN] = "KEY_GREEN",
-	[KEY_YELLOW] = "KEY_YELLOW",
-	[KEY_BLUE] = "KEY_BLUE",
-	[KEY_CHANNELUP] = "KEY_CHANNELUP",
-	[KEY_CHANNELDOWN] = "KEY_CHANNELDOWN",
-	[KEY_FIRST] = "KEY_FIRST",
-	[KEY_LAST] = "KEY_LAST",
-	[KEY_AB] = "KEY_AB",
-	[KEY_NEXT] = "KEY_NEXT",
-	[KEY_RESTART] = "KEY_RESTART",
-	[KEY_SLOW] = "KEY_SLOW",
-	[KEY_SHUFFLE] = "KEY_SHUFFLE",
-	[KEY_BREAK] = "KEY_BREAK",
-	[KEY_PREVIOUS] = "KEY_PREVIOUS",
-	[KEY_DIGITS] = "KEY_DIGITS",
-	[KEY_TEEN] = "KEY_TEEN",
-	[KEY_TWEN] = "KEY_TWEN",
-	[KEY_VIDEOPHONE] = "KEY_VIDEOPHONE",
-	[KEY_GAMES] = "KEY_GAMES",
-	[KEY_ZOOMIN] = "KEY_ZOOMIN",
-	[KEY_ZOOMOUT] = "KEY_ZOOMOUT",
-	[KEY_ZOOMRESET] = "KEY_ZOOMRESET",
-	[KEY_WORDPROCESSOR] = "KEY_WORDPROCESSOR",
-	[KEY_EDITOR] = "KEY_EDITOR",
-	[KEY_SPREADSHEET] = "KEY_SPREADSHEET",
-	[KEY_GRAPHICSEDITOR] = "KEY_GRAPHICSEDITOR",
-	[KEY_PRESENTATION] = "KEY_PRESENTATION",
-	[KEY_DATABASE] = "KEY_DATABASE",
-	[KEY_NEWS] = "KEY_NEWS",
-	[KEY_VOICEMAIL] = "KEY_VOICEMAIL",
-	[KEY_ADDRESSBOOK] = "KEY_ADDRESSBOOK",
-	[KEY_MESSENGER] = "KEY_MESSENGER",
-	[KEY_DISPLAYTOGGLE] = "KEY_DISPLAYTOGGLE",
-	[KEY_SPELLCHECK] = "KEY_SPELLCHECK",
-	[KEY_LOGOFF] = "KEY_LOGOFF",
-	[KEY_DOLLAR] = "KEY_DOLLAR",
-	[KEY_EURO] = "KEY_EURO",
-	[KEY_FRAMEBACK] = "KEY_FRAMEBACK",
-	[KEY_FRAMEFORWARD] = "KEY_FRAMEFORWARD",
-	[KEY_CONTEXT_MENU] = "KEY_CONTEXT_MENU",
-	[KEY_MEDIA_REPEAT] = "KEY_MEDIA_REPEAT",
-	[KEY_10CHANNELSUP] = "KEY_10CHANNELSUP",
-	[KEY_10CHANNELSDOWN] = "KEY_10CHANNELSDOWN",
-	[KEY_IMAGES] = "KEY_IMAGES",
-	[KEY_DEL_EOL] = "KEY_DEL_EOL",
-	[KEY_DEL_EOS] = "KEY_DEL_EOS",
-	[KEY_INS_LINE] = "KEY_INS_LINE",
-	[KEY_DEL_LINE] = "KEY_DEL_LINE",
-	[KEY_FN] = "KEY_FN",
-	[KEY_FN_ESC] = "KEY_FN_ESC",
-	[KEY_FN_F1] = "KEY_FN_F1",
-	[KEY_FN_F2] = "KEY_FN_F2",
-	[KEY_FN_F3] = "KEY_FN_F3",
-	[KEY_FN_F4] = "KEY_FN_F4",
-	[KEY_FN_F5] = "KEY_FN_F5",
-	[KEY_FN_F6] = "KEY_FN_F6",
-	[KEY_FN_F7] = "KEY_FN_F7",
-	[KEY_FN_F8] = "KEY_FN_F8",
-	[KEY_FN_F9] = "KEY_FN_F9",
-	[KEY_FN_F10] = "KEY_FN_F10",
-	[KEY_FN_F11] = "KEY_FN_F11",
-	[KEY_FN_F12] = "KEY_FN_F12",
-	[KEY_FN_1] = "KEY_FN_1",
-	[KEY_FN_2] = "KEY_FN_2",
-	[KEY_FN_D] = "KEY_FN_D",
-	[KEY_FN_E] = "KEY_FN_E",
-	[KEY_FN_F] = "KEY_FN_F",
-	[KEY_FN_S] = "KEY_FN_S",
-	[KEY_FN_B] = "KEY_FN_B",
-	[KEY_BRL_DOT1] = "KEY_BRL_DOT1",
-	[KEY_BRL_DOT2] = "KEY_BRL_DOT2",
-	[KEY_BRL_DOT3] = "KEY_BRL_DOT3",
-	[KEY_BRL_DOT4] = "KEY_BRL_DOT4",
-	[KEY_BRL_DOT5] = "KEY_BRL_DOT5",
-	[KEY_BRL_DOT6] = "KEY_BRL_DOT6",
-	[KEY_BRL_DOT7] = "KEY_BRL_DOT7",
-	[KEY_BRL_DOT8] = "KEY_BRL_DOT8",
-	[KEY_BRL_DOT9] = "KEY_BRL_DOT9",
-	[KEY_BRL_DOT10] = "KEY_BRL_DOT10",
-	[KEY_NUMERIC_0] = "KEY_NUMERIC_0",
-	[KEY_NUMERIC_1] = "KEY_NUMERIC_1",
-	[KEY_NUMERIC_2] = "KEY_NUMERIC_2",
-	[KEY_NUMERIC_3] = "KEY_NUMERIC_3",
-	[KEY_NUMERIC_4] = "KEY_NUMERIC_4",
-	[KEY_NUMERIC_5] = "KEY_NUMERIC_5",
-	[KEY_NUMERIC_6] = "KEY_NUMERIC_6",
-	[KEY_NUMERIC_7] = "KEY_NUMERIC_7",
-	[KEY_NUMERIC_8] = "KEY_NUMERIC_8",
-	[KEY_NUMERIC_9] = "KEY_NUMERIC_9",
-	[KEY_NUMERIC_STAR] = "KEY_NUMERIC_STAR",
-	[KEY_NUMERIC_POUND] = "KEY_NUMERIC_POUND",
-	[KEY_NUMERIC_A] = "KEY_NUMERIC_A",
-	[KEY_NUMERIC_B] = "KEY_NUMERIC_B",
-	[KEY_NUMERIC_C] = "KEY_NUMERIC_C",
-	[KEY_NUMERIC_D] = "KEY_NUMERIC_D",
-	[KEY_CAMERA_FOCUS] = "KEY_CAMERA_FOCUS",
-	[KEY_WPS_BUTTON] = "KEY_WPS_BUTTON",
-	[KEY_TOUCHPAD_TOGGLE] = "KEY_TOUCHPAD_TOGGLE",
-	[KEY_TOUCHPAD_ON] = "KEY_TOUCHPAD_ON",
-	[KEY_TOUCHPAD_OFF] = "KEY_TOUCHPAD_OFF",
-	[KEY_CAMERA_ZOOMIN] = "KEY_CAMERA_ZOOMIN",
-	[KEY_CAMERA_ZOOMOUT] = "KEY_CAMERA_ZOOMOUT",
-	[KEY_CAMERA_UP] = "KEY_CAMERA_UP",
-	[KEY_CAMERA_DOWN] = "KEY_CAMERA_DOWN",
-	[KEY_CAMERA_LEFT] = "KEY_CAMERA_LEFT",
-	[KEY_CAMERA_RIGHT] = "KEY_CAMERA_RIGHT",
-	[KEY_ATTENDANT_ON] = "KEY_ATTENDANT_ON",
-	[KEY_ATTENDANT_OFF] = "KEY_ATTENDANT_OFF",
-	[KEY_ATTENDANT_TOGGLE] = "KEY_ATTENDANT_TOGGLE",
-	[KEY_LIGHTS_TOGGLE] = "KEY_LIGHTS_TOGGLE",
-	[KEY_ALS_TOGGLE] = "KEY_ALS_TOGGLE",
-	[KEY_ROTATE_LOCK_TOGGLE] = "KEY_ROTATE_LOCK_TOGGLE",
-	[KEY_BUTTONCONFIG] = "KEY_BUTTONCONFIG",
-	[KEY_TASKMANAGER] = "KEY_TASKMANAGER",
-	[KEY_JOURNAL] = "KEY_JOURNAL",
-	[KEY_CONTROLPANEL] = "KEY_CONTROLPANEL",
-	[KEY_APPSELECT] = "KEY_APPSELECT",
-	[KEY_SCREENSAVER] = "KEY_SCREENSAVER",
-	[KEY_VOICECOMMAND] = "KEY_VOICECOMMAND",
-	[KEY_ASSISTANT] = "KEY_ASSISTANT",
-	[KEY_KBD_LAYOUT_NEXT] = "KEY_KBD_LAYOUT_NEXT",
-	[KEY_BRIGHTNESS_MIN] = "KEY_BRIGHTNESS_MIN",
-	[KEY_BRIGHTNESS_MAX] = "KEY_BRIGHTNESS_MAX",
-	[KEY_KBDINPUTASSIST_PREV] = "KEY_KBDINPUTASSIST_PREV",
-	[KEY_KBDINPUTASSIST_NEXT] = "KEY_KBDINPUTASSIST_NEXT",
-	[KEY_KBDINPUTASSIST_PREVGROUP] = "KEY_KBDINPUTASSIST_PREVGROUP",
-	[KEY_KBDINPUTASSIST_NEXTGROUP] = "KEY_KBDINPUTASSIST_NEXTGROUP",
-	[KEY_KBDINPUTASSIST_ACCEPT] = "KEY_KBDINPUTASSIST_ACCEPT",
-	[KEY_KBDINPUTASSIST_CANCEL] = "KEY_KBDINPUTASSIST_CANCEL",
-	[KEY_RIGHT_UP] = "KEY_RIGHT_UP",
-	[KEY_RIGHT_DOWN] = "KEY_RIGHT_DOWN",
-	[KEY_LEFT_UP] = "KEY_LEFT_UP",
-	[KEY_LEFT_DOWN] = "KEY_LEFT_DOWN",
-	[KEY_ROOT_MENU] = "KEY_ROOT_MENU",
-	[KEY_MEDIA_TOP_MENU] = "KEY_MEDIA_TOP_MENU",
-	[KEY_NUMERIC_11] = "KEY_NUMERIC_11",
-	[KEY_NUMERIC_12] = "KEY_NUMERIC_12",
-	[KEY_AUDIO_DESC] = "KEY_AUDIO_DESC",
-	[KEY_3D_MODE] = "KEY_3D_MODE",
-	[KEY_NEXT_FAVORITE] = "KEY_NEXT_FAVORITE",
-	[KEY_STOP_RECORD] = "KEY_STOP_RECORD",
-	[KEY_PAUSE_RECORD] = "KEY_PAUSE_RECORD",
-	[KEY_VOD] = "KEY_VOD",
-	[KEY_UNMUTE] = "KEY_UNMUTE",
-	[KEY_FASTREVERSE] = "KEY_FASTREVERSE",
-	[KEY_SLOWREVERSE] = "KEY_SLOWREVERSE",
-	[KEY_DATA] = "KEY_DATA",
-	[KEY_ONSCREEN_KEYBOARD] = "KEY_ONSCREEN_KEYBOARD",
-	[KEY_MAX] = "KEY_MAX",
-	[BTN_DPAD_UP] = "BTN_DPAD_UP",
-	[BTN_DPAD_DOWN] = "BTN_DPAD_DOWN",
-	[BTN_DPAD_LEFT] = "BTN_DPAD_LEFT",
-	[BTN_DPAD_RIGHT] = "BTN_DPAD_RIGHT",
-	[BTN_TRIGGER_HAPPY1] = "BTN_TRIGGER_HAPPY1",
-	[BTN_TRIGGER_HAPPY2] = "BTN_TRIGGER_HAPPY2",
-	[BTN_TRIGGER_HAPPY3] = "BTN_TRIGGER_HAPPY3",
-	[BTN_TRIGGER_HAPPY4] = "BTN_TRIGGER_HAPPY4",
-	[BTN_TRIGGER_HAPPY5] = "BTN_TRIGGER_HAPPY5",
-	[BTN_TRIGGER_HAPPY6] = "BTN_TRIGGER_HAPPY6",
-	[BTN_TRIGGER_HAPPY7] = "BTN_TRIGGER_HAPPY7",
-	[BTN_TRIGGER_HAPPY8] = "BTN_TRIGGER_HAPPY8",
-	[BTN_TRIGGER_HAPPY9] = "BTN_TRIGGER_HAPPY9",
-	[BTN_TRIGGER_HAPPY10] = "BTN_TRIGGER_HAPPY10",
-	[BTN_TRIGGER_HAPPY11] = "BTN_TRIGGER_HAPPY11",
-	[BTN_TRIGGER_HAPPY12] = "BTN_TRIGGER_HAPPY12",
-	[BTN_TRIGGER_HAPPY13] = "BTN_TRIGGER_HAPPY13",
-	[BTN_TRIGGER_HAPPY14] = "BTN_TRIGGER_HAPPY14",
-	[BTN_TRIGGER_HAPPY15] = "BTN_TRIGGER_HAPPY15",
-	[BTN_TRIGGER_HAPPY16] = "BTN_TRIGGER_HAPPY16",
-	[BTN_TRIGGER_HAPPY17] = "BTN_TRIGGER_HAPPY17",
-	[BTN_TRIGGER_HAPPY18] = "BTN_TRIGGER_HAPPY18",
-	[BTN_TRIGGER_HAPPY19] = "BTN_TRIGGER_HAPPY19",
-	[BTN_TRIGGER_HAPPY20] = "BTN_TRIGGER_HAPPY20",
-	[BTN_TRIGGER_HAPPY21] = "BTN_TRIGGER_HAPPY21",
-	[BTN_TRIGGER_HAPPY22] = "BTN_TRIGGER_HAPPY22",
-	[BTN_TRIGGER_HAPPY23] = "BTN_TRIGGER_HAPPY23",
-	[BTN_TRIGGER_HAPPY24] = "BTN_TRIGGER_HAPPY24",
-	[BTN_TRIGGER_HAPPY25] = "BTN_TRIGGER_HAPPY25",
-	[BTN_TRIGGER_HAPPY26] = "BTN_TRIGGER_HAPPY26",
-	[BTN_TRIGGER_HAPPY27] = "BTN_TRIGGER_HAPPY27",
-	[BTN_TRIGGER_HAPPY28] = "BTN_TRIGGER_HAPPY28",
-	[BTN_TRIGGER_HAPPY29] = "BTN_TRIGGER_HAPPY29",
-	[BTN_TRIGGER_HAPPY30] = "BTN_TRIGGER_HAPPY30",
-	[BTN_TRIGGER_HAPPY31] = "BTN_TRIGGER_HAPPY31",
-	[BTN_TRIGGER_HAPPY32] = "BTN_TRIGGER_HAPPY32",
-	[BTN_TRIGGER_HAPPY33] = "BTN_TRIGGER_HAPPY33",
-	[BTN_TRIGGER_HAPPY34] = "BTN_TRIGGER_HAPPY34",
-	[BTN_TRIGGER_HAPPY35] = "BTN_TRIGGER_HAPPY35",
-	[BTN_TRIGGER_HAPPY36] = "BTN_TRIGGER_HAPPY36",
-	[BTN_TRIGGER_HAPPY37] = "BTN_TRIGGER_HAPPY37",
-	[BTN_TRIGGER_HAPPY38] = "BTN_TRIGGER_HAPPY38",
-	[BTN_TRIGGER_HAPPY39] = "BTN_TRIGGER_HAPPY39",
-	[BTN_TRIGGER_HAPPY40] = "BTN_TRIGGER_HAPPY40",
-	[BTN_0] = "BTN_0",
-	[BTN_1] = "BTN_1",
-	[BTN_2] = "BTN_2",
-	[BTN_3] = "BTN_3",
-	[BTN_4] = "BTN_4",
-	[BTN_5] = "BTN_5",
-	[BTN_6] = "BTN_6",
-	[BTN_7] = "BTN_7",
-	[BTN_8] = "BTN_8",
-	[BTN_9] = "BTN_9",
-	[BTN_LEFT] = "BTN_LEFT",
-	[BTN_RIGHT] = "BTN_RIGHT",
-	[BTN_MIDDLE] = "BTN_MIDDLE",
-	[BTN_SIDE] = "BTN_SIDE",
-	[BTN_EXTRA] = "BTN_EXTRA",
-	[BTN_FORWARD] = "BTN_FORWARD",
-	[BTN_BACK] = "BTN_BACK",
-	[BTN_TASK] = "BTN_TASK",
-	[BTN_TRIGGER] = "BTN_TRIGGER",
-	[BTN_THUMB] = "BTN_THUMB",
-	[BTN_THUMB2] = "BTN_THUMB2",
-	[BTN_TOP] = "BTN_TOP",
-	[BTN_TOP2] = "BTN_TOP2",
-	[BTN_PINKIE] = "BTN_PINKIE",
-	[BTN_BASE] = "BTN_BASE",
-	[BTN_BASE2] = "BTN_BASE2",
-	[BTN_BASE3] = "BTN_BASE3",
-	[BTN_BASE4] = "BTN_BASE4",
-	[BTN_BASE5] = "BTN_BASE5",
-	[BTN_BASE6] = "BTN_BASE6",
-	[BTN_DEAD] = "BTN_DEAD",
-	[BTN_SOUTH] = "BTN_SOUTH",
-	[BTN_EAST] = "BTN_EAST",
-	[BTN_C] = "BTN_C",
-	[BTN_NORTH] = "BTN_NORTH",
-	[BTN_WEST] = "BTN_WEST",
-	[BTN_Z] = "BTN_Z",
-	[BTN_TL] = "BTN_TL",
-	[BTN_TR] = "BTN_TR",
-	[BTN_TL2] = "BTN_TL2",
-	[BTN_TR2] = "BTN_TR2",
-	[BTN_SELECT] = "BTN_SELECT",
-	[BTN_START] = "BTN_START",
-	[BTN_MODE] = "BTN_MODE",
-	[BTN_THUMBL] = "BTN_THUMBL",
-	[BTN_THUMBR] = "BTN_THUMBR",
-	[BTN_TOOL_PEN] = "BTN_TOOL_PEN",
-	[BTN_TOOL_RUBBER] = "BTN_TOOL_RUBBER",
-	[BTN_TOOL_BRUSH] = "BTN_TOOL_BRUSH",
-	[BTN_TOOL_PENCIL] = "BTN_TOOL_PENCIL",
-	[BTN_TOOL_AIRBRUSH] = "BTN_TOOL_AIRBRUSH",
-	[BTN_TOOL_FINGER] = "BTN_TOOL_FINGER",
-	[BTN_TOOL_MOUSE] = "BTN_TOOL_MOUSE",
-	[BTN_TOOL_LENS] = "BTN_TOOL_LENS",
-	[BTN_TOOL_QUINTTAP] = "BTN_TOOL_QUINTTAP",
-	[BTN_STYLUS3] = "BTN_STYLUS3",
-	[BTN_TOUCH] = "BTN_TOUCH",
-	[BTN_STYLUS] = "BTN_STYLUS",
-	[BTN_STYLUS2] = "BTN_STYLUS2",
-	[BTN_TOOL_DOUBLETAP] = "BTN_TOOL_DOUBLETAP",
-	[BTN_TOOL_TRIPLETAP] = "BTN_TOOL_TRIPLETAP",
-	[BTN_TOOL_QUADTAP] = "BTN_TOOL_QUADTAP",
-	[BTN_GEAR_DOWN] = "BTN_GEAR_DOWN",
-	[BTN_GEAR_UP] = "BTN_GEAR_UP",
-};
-
-static const char * const led_map[LED_MAX + 1] = {
-	[LED_NUML] = "LED_NUML",
-	[LED_CAPSL] = "LED_CAPSL",
-	[LED_SCROLLL] = "LED_SCROLLL",
-	[LED_COMPOSE] = "LED_COMPOSE",
-	[LED_KANA] = "LED_KANA",
-	[LED_SLEEP] = "LED_SLEEP",
-	[LED_SUSPEND] = "LED_SUSPEND",
-	[LED_MUTE] = "LED_MUTE",
-	[LED_MISC] = "LED_MISC",
-	[LED_MAIL] = "LED_MAIL",
-	[LED_CHARGING] = "LED_CHARGING",
-	[LED_MAX] = "LED_MAX",
-};
-
-static const char * const snd_map[SND_MAX + 1] = {
-	[SND_CLICK] = "SND_CLICK",
-	[SND_BELL] = "SND_BELL",
-	[SND_TONE] = "SND_TONE",
-	[SND_MAX] = "SND_MAX",
-};
+static inline size_t
+name_length(unsigned short offset)
+{
+	return offset ? (unsigned char)names_blob[offset - 1] : 0;
+}
 
-static const char * const msc_map[MSC_MAX + 1] = {
-	[MSC_SERIAL] = "MSC_SERIAL",
-	[MSC_PULSELED] = "MSC_PULSELED",
-	[MSC_GESTURE] = "MSC_GESTURE",
-	[MSC_RAW] = "MSC_RAW",
-	[MSC_SCAN] = "MSC_SCAN",
-	[MSC_TIMESTAMP] = "MSC_TIMESTAMP",
-	[MSC_MAX] = "MSC_MAX",
+static const unsigned short ev_map[EV_MAX + 1] = {
+	[EV_SYN] = 2,
+	[EV_KEY] = 10,
+	[EV_REL] = 18,
+	[EV_ABS] = 26,
+	[EV_MSC] = 34,
+	[EV_SW] = 42,
+	[EV_LED] = 49,
+	[EV_SND] = 57,
+	[EV_REP] = 65,
+	[EV_FF] = 73,
+	[EV_PWR] = 80,
+	[EV_FF_STATUS] = 88,
+	[EV_MAX] = 102,
 };
 
-static const char * const sw_map[SW_MAX + 1] = {
-	[SW_LID] = "SW_LID",
-	[SW_TABLET_MODE] = "SW_TABLET_MODE",
-	[SW_HEADPHONE_INSERT] = "SW_HEADPHONE_INSERT",
-	[SW_RFKILL_ALL] = "SW_RFKILL_ALL",
-	[SW_MICROPHONE_INSERT] = "SW_MICROPHONE_INSERT",
-	[SW_DOCK] = "SW_DOCK",
-	[SW_LINEOUT_INSERT] = "SW_LINEOUT_INSERT",
-	[SW_JACK_PHYSICAL_INSERT] = "SW_JACK_PHYSICAL_INSERT",
-	[SW_VIDEOOUT_INSERT] = "SW_VIDEOOUT_INSERT",
-	[SW_CAMERA_LENS_COVER] = "SW_CAMERA_LENS_COVER",
-	[SW_KEYPAD_SLIDE] = "SW_KEYPAD_SLIDE",
-	[SW_FRONT_PROXIMITY] = "SW_FRONT_PROXIMITY",
-	[SW_ROTATE_LOCK] = "SW_ROTATE_LOCK",
-	[SW_LINEIN_INSERT] = "SW_LINEIN_INSERT",
-	[SW_MUTE_DEVICE] = "SW_MUTE_DEVICE",
-	[SW_PEN_INSERTED] = "SW_PEN_INSERTED",
+static const unsigned short input_prop_map[INPUT_PROP_MAX + 1] = {
+	[INPUT_PROP_POINTER] = 110,
+	[INPUT_PROP_DIRECT] = 130,
+	[INPUT_PROP_BUTTONPAD] = 149,
+	[INPUT_PROP_SEMI_MT] = 171,
+	[INPUT_PROP_TOPBUTTONPAD] = 191,
+	[INPUT_PROP_POINTING_STICK] = 216,
+	[INPUT_PROP_ACCELEROMETER] = 243,
+	[INPUT_PROP_MAX] = 269,
 };
 
-static const char * const ff_map[FF_MAX + 1] = {
-	[FF_STATUS_STOPPED] = "FF_STATUS_STOPPED",
-	[FF_STATUS_MAX] = "FF_STATUS_MAX",
-	[FF_AUTOCENTER] = "FF_AUTOCENTER",
-	[FF_GAIN] = "FF_GAIN",
-	[FF_RUMBLE] = "FF_RUMBLE",
-	[FF_PERIODIC] = "FF_PERIODIC",
-	[FF_CONSTANT] = "FF_CONSTANT",
-	[FF_SPRING] = "FF_SPRING",
-	[FF_FRICTION] = "FF_FRICTION",
-	[FF_DAMPER] = "FF_DAMPER",
-	[FF_INERTIA] = "FF_INERTIA",
-	[FF_RAMP] = "FF_RAMP",
-	[FF_SQUARE] = "FF_SQUARE",
-	[FF_TRIANGLE] = "FF_TRIANGLE",
-	[FF_SINE] = "FF_SINE",
-	[FF_SAW_UP] = "FF_SAW_UP",
-	[FF_SAW_DOWN] = "FF_SAW_DOWN",
-	[FF_CUSTOM] = "FF_CUSTOM",
-	[FF_MAX] = "FF_MAX",
+static const unsigned short mt_tool_map[MT_TOOL_MAX + 1] = {
+	[MT_TOOL_FINGER] = 285,
+	[MT_TOOL_PEN] = 301,
+	[MT_TOOL_PALM] = 314,
+	[MT_TOOL_DIAL] = 328,
+	[MT_TOOL_MAX] = 342,
 };
 
-static const char * const syn_map[SYN_MAX + 1] = {
-	[SYN_REPORT] = "SYN_REPORT",
-	[SYN_CONFIG] = "SYN_CONFIG",
-	[SYN_MT_REPORT] = "SYN_MT_REPORT",
-	[SYN_DROPPED] = "SYN_DROPPED",
-	[SYN_MAX] = "SYN_MAX",
+static const unsigned short code_map[] = {
+	/* EV_REL */
+	355, /* "REL_X" */
+	362, /* "REL_Y" */
+	369, /* "REL_Z" */
+	376, /* "REL_RX" */
+	384, /* "REL_RY" */
+	392, /* "REL_RZ" */
+	400, /* "REL_HWHEEL" */
+	412, /* "REL_DIAL" */
+	422, /* "REL_WHEEL" */
+	433, /* "REL_MISC" */
+	443, /* "REL_RESERVED" */
+	457, /* "REL_WHEEL_HI_RES" */
+	475, /* "REL_HWHEEL_HI_RES" */
+	0,
+	0,
+	494, /* "REL_MAX" */
+	/* EV_ABS */
+	503, /* "ABS_X" */
+	510, /* "ABS_Y" */
+	517, /* "ABS_Z" */
+	524, /* "ABS_RX" */
+	532, /* "ABS_RY" */
+	540, /* "ABS_RZ" */
+	548, /* "ABS_THROTTLE" */
+	562, /* "ABS_RUDDER" */
+	574, /* "ABS_WHEEL" */
+	585, /* "ABS_GAS" */
+	594, /* "ABS_BRAKE" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	605, /* "ABS_HAT0X" */
+	616, /* "ABS_HAT0Y" */
+	627, /* "ABS_HAT1X" */
+	638, /* "ABS_HAT1Y" */
+	649, /* "ABS_HAT2X" */
+	660, /* "ABS_HAT2Y" */
+	671, /* "ABS_HAT3X" */
+	682, /* "ABS_HAT3Y" */
+	693, /* "ABS_PRESSURE" */
+	707, /* "ABS_DISTANCE" */
+	721, /* "ABS_TILT_X" */
+	733, /* "ABS_TILT_Y" */
+	745, /* "ABS_TOOL_WIDTH" */
+	0,
+	0,
+	0,
+	761, /* "ABS_VOLUME" */
+	773, /* "ABS_PROFILE" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	786, /* "ABS_MISC" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	796, /* "ABS_RESERVED" */
+	810, /* "ABS_MT_SLOT" */
+	823, /* "ABS_MT_TOUCH_MAJOR" */
+	843, /* "ABS_MT_TOUCH_MINOR" */
+	863, /* "ABS_MT_WIDTH_MAJOR" */
+	883, /* "ABS_MT_WIDTH_MINOR" */
+	903, /* "ABS_MT_ORIENTATION" */
+	923, /* "ABS_MT_POSITION_X" */
+	942, /* "ABS_MT_POSITION_Y" */
+	961, /* "ABS_MT_TOOL_TYPE" */
+	979, /* "ABS_MT_BLOB_ID" */
+	995, /* "ABS_MT_TRACKING_ID" */
+	1015, /* "ABS_MT_PRESSURE" */
+	1032, /* "ABS_MT_DISTANCE" */
+	1049, /* "ABS_MT_TOOL_X" */
+	1064, /* "ABS_MT_TOOL_Y" */
+	0,
+	1079, /* "ABS_MAX" */
+	/* EV_KEY */
+	1088, /* "KEY_RESERVED" */
+	1102, /* "KEY_ESC" */
+	1111, /* "KEY_1" */
+	1118, /* "KEY_2" */
+	1125, /* "KEY_3" */
+	1132, /* "KEY_4" */
+	1139, /* "KEY_5" */
+	1146, /* "KEY_6" */
+	1153, /* "KEY_7" */
+	1160, /* "KEY_8" */
+	1167, /* "KEY_9" */
+	1174, /* "KEY_0" */
+	1181, /* "KEY_MINUS" */
+	1192, /* "KEY_EQUAL" */
+	1203, /* "KEY_BACKSPACE" */
+	1218, /* "KEY_TAB" */
+	1227, /* "KEY_Q" */
+	1234, /* "KEY_W" */
+	1241, /* "KEY_E" */
+	1248, /* "KEY_R" */
+	1255, /* "KEY_T" */
+	1262, /* "KEY_Y" */
+	1269, /* "KEY_U" */
+	1276, /* "KEY_I" */
+	1283, /* "KEY_O" */
+	1290, /* "KEY_P" */
+	1297, /* "KEY_LEFTBRACE" */
+	1312, /* "KEY_RIGHTBRACE" */
+	1328, /* "KEY_ENTER" */
+	1339, /* "KEY_LEFTCTRL" */
+	1353, /* "KEY_A" */
+	1360, /* "KEY_S" */
+	1367, /* "KEY_D" */
+	1374, /* "KEY_F" */
+	1381, /* "KEY_G" */
+	1388, /* "KEY_H" */
+	1395, /* "KEY_J" */
+	1402, /* "KEY_K" */
+	1409, /* "KEY_L" */
+	1416, /* "KEY_SEMICOLON" */
+	1431, /* "KEY_APOSTROPHE" */
+	1447, /* "KEY_GRAVE" */
+	1458, /* "KEY_LEFTSHIFT" */
+	1473, /* "KEY_BACKSLASH" */
+	1488, /* "KEY_Z" */
+	1495, /* "KEY_X" */
+	1502, /* "KEY_C" */
+	1509, /* "KEY_V" */
+	1516, /* "KEY_B" */
+	1523, /* "KEY_N" */
+	1530, /* "KEY_M" */
+	1537, /* "KEY_COMMA" */
+	1548, /* "KEY_DOT" */
+	1557, /* "KEY_SLASH" */
+	1568, /* "KEY_RIGHTSHIFT" */
+	1584, /* "KEY_KPASTERISK" */
+	1600, /* "KEY_LEFTALT" */
+	1613, /* "KEY_SPACE" */
+	1624, /* "KEY_CAPSLOCK" */
+	1638, /* "KEY_F1" */
+	1646, /* "KEY_F2" */
+	1654, /* "KEY_F3" */
+	1662, /* "KEY_F4" */
+	1670, /* "KEY_F5" */
+	1678, /* "KEY_F6" */
+	1686, /* "KEY_F7" */
+	1694, /* "KEY_F8" */
+	1702, /* "KEY_F9" */
+	1710, /* "KEY_F10" */
+	1719, /* "KEY_NUMLOCK" */
+	1732, /* "KEY_SCROLLLOCK" */
+	1748, /* "KEY_KP7" */
+	1757, /* "KEY_KP8" */
+	1766, /* "KEY_KP9" */
+	1775, /* "KEY_KPMINUS" */
+	1788, /* "KEY_KP4" */
+	1797, /* "KEY_KP5" */
+	1806, /* "KEY_KP6" */
+	1815, /* "KEY_KPPLUS" */
+	1827, /* "KEY_KP1" */
+	1836, /* "KEY_KP2" */
+	1845, /* "KEY_KP3" */
+	1854, /* "KEY_KP0" */
+	1863, /* "KEY_KPDOT" */
+	0,
+	1874, /* "KEY_ZENKAKUHANKAKU" */
+	1894, /* "KEY_102ND" */
+	1905, /* "KEY_F11" */
+	1914, /* "KEY_F12" */
+	1923, /* "KEY_RO" */
+	1931, /* "KEY_KATAKANA" */
+	1945, /* "KEY_HIRAGANA" */
+	1959, /* "KEY_HENKAN" */
+	1971, /* "KEY_KATAKANAHIRAGANA" */
+	1993, /* "KEY_MUHENKAN" */
+	2007, /* "KEY_KPJPCOMMA" */
+	2022, /* "KEY_KPENTER" */
+	2035, /* "KEY_RIGHTCTRL" */
+	2050, /* "KEY_KPSLASH" */
+	2063, /* "KEY_SYSRQ" */
+	2074, /* "KEY_RIGHTALT" */
+	2088, /* "KEY_LINEFEED" */
+	2102, /* "KEY_HOME" */
+	2112, /* "KEY_UP" */
+	2120, /* "KEY_PAGEUP" */
+	2132, /* "KEY_LEFT" */
+	2142, /* "KEY_RIGHT" */
+	2153, /* "KEY_END" */
+	2162, /* "KEY_DOWN" */
+	2172, /* "KEY_PAGEDOWN" */
+	2186, /* "KEY_INSERT" */
+	2198, /* "KEY_DELETE" */
+	2210, /* "KEY_MACRO" */
+	2221, /* "KEY_MUTE" */
+	2231, /* "KEY_VOLUMEDOWN" */
+	2247, /* "KEY_VOLUMEUP" */
+	2261, /* "KEY_POWER" */
+	2272, /* "KEY_KPEQUAL" */
+	2285, /* "KEY_KPPLUSMINUS" */
+	2302, /* "KEY_PAUSE" */
+	2313, /* "KEY_SCALE" */
+	2324, /* "KEY_KPCOMMA" */
+	2337, /* "KEY_HANGEUL" */
+	2350, /* "KEY_HANJA" */
+	2361, /* "KEY_YEN" */
+	2370, /* "KEY_LEFTMETA" */
+	2384, /* "KEY_RIGHTMETA" */
+	2399, /* "KEY_COMPOSE" */
+	2412, /* "KEY_STOP" */
+	2422, /* "KEY_AGAIN" */
+	2433, /* "KEY_PROPS" */
+	2444, /* "KEY_UNDO" */
+	2454, /* "KEY_FRONT" */
+	2465, /* "KEY_COPY" */
+	2475, /* "KEY_OPEN" */
+	2485, /* "KEY_PASTE" */
+	2496, /* "KEY_FIND" */
+	2506, /* "KEY_CUT" */
+	2515, /* "KEY_HELP" */
+	2525, /* "KEY_MENU" */
+	2535, /* "KEY_CALC" */
+	2545, /* "KEY_SETUP" */
+	2556, /* "KEY_SLEEP" */
+	2567, /* "KEY_WAKEUP" */
+	2579, /* "KEY_FILE" */
+	2589, /* "KEY_SENDFILE" */
+	2603, /* "KEY_DELETEFILE" */
+	2619, /* "KEY_XFER" */
+	2629, /* "KEY_PROG1" */
+	2640, /* "KEY_PROG2" */
+	2651, /* "KEY_WWW" */
+	2660, /* "KEY_MSDOS" */
+	2671, /* "KEY_COFFEE" */
+	2683, /* "KEY_ROTATE_DISPLAY" */
+	2703, /* "KEY_CYCLEWINDOWS" */
+	2721, /* "KEY_MAIL" */
+	2731, /* "KEY_BOOKMARKS" */
+	2746, /* "KEY_COMPUTER" */
+	2760, /* "KEY_BACK" */
+	2770, /* "KEY_FORWARD" */
+	2783, /* "KEY_CLOSECD" */
+	2796, /* "KEY_EJECTCD" */
+	2809, /* "KEY_EJECTCLOSECD" */
+	2827, /* "KEY_NEXTSONG" */
+	2841, /* "KEY_PLAYPAUSE" */
+	2856, /* "KEY_PREVIOUSSONG" */
+	2874, /* "KEY_STOPCD" */
+	2886, /* "KEY_RECORD" */
+	2898, /* "KEY_REWIND" */
+	2910, /* "KEY_PHONE" */
+	2921, /* "KEY_ISO" */
+	2930, /* "KEY_CONFIG" */
+	2942, /* "KEY_HOMEPAGE" */
+	2956, /* "KEY_REFRESH" */
+	2969, /* "KEY_EXIT" */
+	2979, /* "KEY_MOVE" */
+	2989, /* "KEY_EDIT" */
+	2999, /* "KEY_SCROLLUP" */
+	3013, /* "KEY_SCROLLDOWN" */
+	3029, /* "KEY_KPLEFTPAREN" */
+	3046, /* "KEY_KPRIGHTPAREN" */
+	3064, /* "KEY_NEW" */
+	3073, /* "KEY_REDO" */
+	3083, /* "KEY_F13" */
+	3092, /* "KEY_F14" */
+	3101, /* "KEY_F15" */
+	3110, /* "KEY_F16" */
+	3119, /* "KEY_F17" */
+	3128, /* "KEY_F18" */
+	3137, /* "KEY_F19" */
+	3146, /* "KEY_F20" */
+	3155, /* "KEY_F21" */
+	3164, /* "KEY_F22" */
+	3173, /* "KEY_F23" */
+	3182, /* "KEY_F24" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	3191, /* "KEY_PLAYCD" */
+	3203, /* "KEY_PAUSECD" */
+	3216, /* "KEY_PROG3" */
+	3227, /* "KEY_PROG4" */
+	3238, /* "KEY_ALL_APPLICATIONS" */
+	3260, /* "KEY_SUSPEND" */
+	3273, /* "KEY_CLOSE" */
+	3284, /* "KEY_PLAY" */
+	3294, /* "KEY_FASTFORWARD" */
+	3311, /* "KEY_BASSBOOST" */
+	3326, /* "KEY_PRINT" */
+	3337, /* "KEY_HP" */
+	3345, /* "KEY_CAMERA" */
+	3357, /* "KEY_SOUND" */
+	3368, /* "KEY_QUESTION" */
+	3382, /* "KEY_EMAIL" */
+	3393, /* "KEY_CHAT" */
+	3403, /* "KEY_SEARCH" */
+	3415, /* "KEY_CONNECT" */
+	3428, /* "KEY_FINANCE" */
+	3441, /* "KEY_SPORT" */
+	3452, /* "KEY_SHOP" */
+	3462, /* "KEY_ALTERASE" */
+	3476, /* "KEY_CANCEL" */
+	3488, /* "KEY_BRIGHTNESSDOWN" */
+	3508, /* "KEY_BRIGHTNESSUP" */
+	3526, /* "KEY_MEDIA" */
+	3537, /* "KEY_SWITCHVIDEOMODE" */
+	3558, /* "KEY_KBDILLUMTOGGLE" */
+	3578, /* "KEY_KBDILLUMDOWN" */
+	3596, /* "KEY_KBDILLUMUP" */
+	3612, /* "KEY_SEND" */
+	3622, /* "KEY_REPLY" */
+	3633, /* "KEY_FORWARDMAIL" */
+	3650, /* "KEY_SAVE" */
+	3660, /* "KEY_DOCUMENTS" */
+	3675, /* "KEY_BATTERY" */
+	3688, /* "KEY_BLUETOOTH" */
+	3703, /* "KEY_WLAN" */
+	3713, /* "KEY_UWB" */
+	3722, /* "KEY_UNKNOWN" */
+	3735, /* "KEY_VIDEO_NEXT" */
+	3751, /* "KEY_VIDEO_PREV" */
+	3767, /* "KEY_BRIGHTNESS_CYCLE" */
+	3789, /* "KEY_BRIGHTNESS_AUTO" */
+	3810, /* "KEY_DISPLAY_OFF" */
+	3827, /* "KEY_WWAN" */
+	3837, /* "KEY_RFKILL" */
+	3849, /* "KEY_MICMUTE" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	3862, /* "BTN_0" */
+	3869, /* "BTN_1" */
+	3876, /* "BTN_2" */
+	3883, /* "BTN_3" */
+	3890, /* "BTN_4" */
+	3897, /* "BTN_5" */
+	3904, /* "BTN_6" */
+	3911, /* "BTN_7" */
+	3918, /* "BTN_8" */
+	3925, /* "BTN_9" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	3932, /* "BTN_LEFT" */
+	3942, /* "BTN_RIGHT" */
+	3953, /* "BTN_MIDDLE" */
+	3965, /* "BTN_SIDE" */
+	3975, /* "BTN_EXTRA" */
+	3986, /* "BTN_FORWARD" */
+	3999, /* "BTN_BACK" */
+	4009, /* "BTN_TASK" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	4019, /* "BTN_TRIGGER" */
+	4032, /* "BTN_THUMB" */
+	4043, /* "BTN_THUMB2" */
+	4055, /* "BTN_TOP" */
+	4064, /* "BTN_TOP2" */
+	4074, /* "BTN_PINKIE" */
+	4086, /* "BTN_BASE" */
+	4096, /* "BTN_BASE2" */
+	4107, /* "BTN_BASE3" */
+	4118, /* "BTN_BASE4" */
+	4129, /* "BTN_BASE5" */
+	4140, /* "BTN_BASE6" */
+	0,
+	0,
+	0,
+	4151, /* "BTN_DEAD" */
+	4161, /* "BTN_SOUTH" */
+	4172, /* "BTN_EAST" */
+	4182, /* "BTN_C" */
+	4189, /* "BTN_NORTH" */
+	4200, /* "BTN_WEST" */
+	4210, /* "BTN_Z" */
+	4217, /* "BTN_TL" */
+	4225, /* "BTN_TR" */
+	4233, /* "BTN_TL2" */
+	4242, /* "BTN_TR2" */
+	4251, /* "BTN_SELECT" */
+	4263, /* "BTN_START" */
+	4274, /* "BTN_MODE" */
+	4284, /* "BTN_THUMBL" */
+	4296, /* "BTN_THUMBR" */
+	0,
+	4308, /* "BTN_TOOL_PEN" */
+	4322, /* "BTN_TOOL_RUBBER" */
+	4339, /* "BTN_TOOL_BRUSH" */
+	4355, /* "BTN_TOOL_PENCIL" */
+	4372, /* "BTN_TOOL_AIRBRUSH" */
+	4391, /* "BTN_TOOL_FINGER" */
+	4408, /* "BTN_TOOL_MOUSE" */
+	4424, /* "BTN_TOOL_LENS" */
+	4439, /* "BTN_TOOL_QUINTTAP" */
+	4458, /* "BTN_STYLUS3" */
+	4471, /* "BTN_TOUCH" */
+	4482, /* "BTN_STYLUS" */
+	4494, /* "BTN_STYLUS2" */
+	4507, /* "BTN_TOOL_DOUBLETAP" */
+	4527, /* "BTN_TOOL_TRIPLETAP" */
+	4547, /* "BTN_TOOL_QUADTAP" */
+	4565, /* "BTN_GEAR_DOWN" */
+	4580, /* "BTN_GEAR_UP" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	4593, /* "KEY_OK" */
+	4601, /* "KEY_SELECT" */
+	4613, /* "KEY_GOTO" */
+	4623, /* "KEY_CLEAR" */
+	4634, /* "KEY_POWER2" */
+	4646, /* "KEY_OPTION" */
+	4658, /* "KEY_INFO" */
+	4668, /* "KEY_TIME" */
+	4678, /* "KEY_VENDOR" */
+	4690, /* "KEY_ARCHIVE" */
+	4703, /* "KEY_PROGRAM" */
+	4716, /* "KEY_CHANNEL" */
+	4729, /* "KEY_FAVORITES" */
+	4744, /* "KEY_EPG" */
+	4753, /* "KEY_PVR" */
+	4762, /* "KEY_MHP" */
+	4771, /* "KEY_LANGUAGE" */
+	4785, /* "KEY_TITLE" */
+	4796, /* "KEY_SUBTITLE" */
+	4810, /* "KEY_ANGLE" */
+	4821, /* "KEY_FULL_SCREEN" */
+	4838, /* "KEY_MODE" */
+	4848, /* "KEY_KEYBOARD" */
+	4862, /* "KEY_ASPECT_RATIO" */
+	4880, /* "KEY_PC" */
+	4888, /* "KEY_TV" */
+	4896, /* "KEY_TV2" */
+	4905, /* "KEY_VCR" */
+	4914, /* "KEY_VCR2" */
+	4924, /* "KEY_SAT" */
+	4933, /* "KEY_SAT2" */
+	4943, /* "KEY_CD" */
+	4951, /* "KEY_TAPE" */
+	4961, /* "KEY_RADIO" */
+	4972, /* "KEY_TUNER" */
+	4983, /* "KEY_PLAYER" */
+	4995, /* "KEY_TEXT" */
+	5005, /* "KEY_DVD" */
+	5014, /* "KEY_AUX" */
+	5023, /* "KEY_MP3" */
+	5032, /* "KEY_AUDIO" */
+	5043, /* "KEY_VIDEO" */
+	5054, /* "KEY_DIRECTORY" */
+	5069, /* "KEY_LIST" */
+	5079, /* "KEY_MEMO" */
+	5089, /* "KEY_CALENDAR" */
+	5103, /* "KEY_RED" */
+	5112, /* "KEY_GREEN" */
+	5123, /* "KEY_YELLOW" */
+	5135, /* "KEY_BLUE" */
+	5145, /* "KEY_CHANNELUP" */
+	5160, /* "KEY_CHANNELDOWN" */
+	5177, /* "KEY_FIRST" */
+	5188, /* "KEY_LAST" */
+	5198, /* "KEY_AB" */
+	5206, /* "KEY_NEXT" */
+	5216, /* "KEY_RESTART" */
+	5229, /* "KEY_SLOW" */
+	5239, /* "KEY_SHUFFLE" */
+	5252, /* "KEY_BREAK" */
+	5263, /* "KEY_PREVIOUS" */
+	5277, /* "KEY_DIGITS" */
+	5289, /* "KEY_TEEN" */
+	5299, /* "KEY_TWEN" */
+	5309, /* "KEY_VIDEOPHONE" */
+	5325, /* "KEY_GAMES" */
+	5336, /* "KEY_ZOOMIN" */
+	5348, /* "KEY_ZOOMOUT" */
+	5361, /* "KEY_ZOOMRESET" */
+	5376, /* "KEY_WORDPROCESSOR" */
+	5395, /* "KEY_EDITOR" */
+	5407, /* "KEY_SPREADSHEET" */
+	5424, /* "KEY_GRAPHICSEDITOR" */
+	5444, /* "KEY_PRESENTATION" */
+	5462, /* "KEY_DATABASE" */
+	5476, /* "KEY_NEWS" */
+	5486, /* "KEY_VOICEMAIL" */
+	5501, /* "KEY_ADDRESSBOOK" */
+	5518, /* "KEY_MESSENGER" */
+	5533, /* "KEY_DISPLAYTOGGLE" */
+	5552, /* "KEY_SPELLCHECK" */
+	5568, /* "KEY_LOGOFF" */
+	5580, /* "KEY_DOLLAR" */
+	5592, /* "KEY_EURO" */
+	5602, /* "KEY_FRAMEBACK" */
+	5617, /* "KEY_FRAMEFORWARD" */
+	5635, /* "KEY_CONTEXT_MENU" */
+	5653, /* "KEY_MEDIA_REPEAT" */
+	5671, /* "KEY_10CHANNELSUP" */
+	5689, /* "KEY_10CHANNELSDOWN" */
+	5709, /* "KEY_IMAGES" */
+	0,
+	5721, /* "KEY_NOTIFICATION_CENTER" */
+	5746, /* "KEY_PICKUP_PHONE" */
+	5764, /* "KEY_HANGUP_PHONE" */
+	0,
+	5782, /* "KEY_DEL_EOL" */
+	5795, /* "KEY_DEL_EOS" */
+	5808, /* "KEY_INS_LINE" */
+	5822, /* "KEY_DEL_LINE" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	5836, /* "KEY_FN" */
+	5844, /* "KEY_FN_ESC" */
+	5856, /* "KEY_FN_F1" */
+	5867, /* "KEY_FN_F2" */
+	5878, /* "KEY_FN_F3" */
+	5889, /* "KEY_FN_F4" */
+	5900, /* "KEY_FN_F5" */
+	5911, /* "KEY_FN_F6" */
+	5922, /* "KEY_FN_F7" */
+	5933, /* "KEY_FN_F8" */
+	5944, /* "KEY_FN_F9" */
+	5955, /* "KEY_FN_F10" */
+	5967, /* "KEY_FN_F11" */
+	5979, /* "KEY_FN_F12" */
+	5991, /* "KEY_FN_1" */
+	6001, /* "KEY_FN_2" */
+	6011, /* "KEY_FN_D" */
+	6021, /* "KEY_FN_E" */
+	6031, /* "KEY_FN_F" */
+	6041, /* "KEY_FN_S" */
+	6051, /* "KEY_FN_B" */
+	6061, /* "KEY_FN_RIGHT_SHIFT" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	6081, /* "KEY_BRL_DOT1" */
+	6095, /* "KEY_BRL_DOT2" */
+	6109, /* "KEY_BRL_DOT3" */
+	6123, /* "KEY_BRL_DOT4" */
+	6137, /* "KEY_BRL_DOT5" */
+	6151, /* "KEY_BRL_DOT6" */
+	6165, /* "KEY_BRL_DOT7" */
+	6179, /* "KEY_BRL_DOT8" */
+	6193, /* "KEY_BRL_DOT9" */
+	6207, /* "KEY_BRL_DOT10" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	6222, /* "KEY_NUMERIC_0" */
+	6237, /* "KEY_NUMERIC_1" */
+	6252, /* "KEY_NUMERIC_2" */
+	6267, /* "KEY_NUMERIC_3" */
+	6282, /* "KEY_NUMERIC_4" */
+	6297, /* "KEY_NUMERIC_5" */
+	6312, /* "KEY_NUMERIC_6" */
+	6327, /* "KEY_NUMERIC_7" */
+	6342, /* "KEY_NUMERIC_8" */
+	6357, /* "KEY_NUMERIC_9" */
+	6372, /* "KEY_NUMERIC_STAR" */
+	6390, /* "KEY_NUMERIC_POUND" */
+	6409, /* "KEY_NUMERIC_A" */
+	6424, /* "KEY_NUMERIC_B" */
+	6439, /* "KEY_NUMERIC_C" */
+	6454, /* "KEY_NUMERIC_D" */
+	6469, /* "KEY_CAMERA_FOCUS" */
+	6487, /* "KEY_WPS_BUTTON" */
+	6503, /* "KEY_TOUCHPAD_TOGGLE" */
+	6524, /* "KEY_TOUCHPAD_ON" */
+	6541, /* "KEY_TOUCHPAD_OFF" */
+	6559, /* "KEY_CAMERA_ZOOMIN" */
+	6578, /* "KEY_CAMERA_ZOOMOUT" */
+	6598, /* "KEY_CAMERA_UP" */
+	6613, /* "KEY_CAMERA_DOWN" */
+	6630, /* "KEY_CAMERA_LEFT" */
+	6647, /* "KEY_CAMERA_RIGHT" */
+	6665, /* "KEY_ATTENDANT_ON" */
+	6683, /* "KEY_ATTENDANT_OFF" */
+	6702, /* "KEY_ATTENDANT_TOGGLE" */
+	6724, /* "KEY_LIGHTS_TOGGLE" */
+	0,
+	6743, /* "BTN_DPAD_UP" */
+	6756, /* "BTN_DPAD_DOWN" */
+	6771, /* "BTN_DPAD_LEFT" */
+	6786, /* "BTN_DPAD_RIGHT" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	6802, /* "KEY_ALS_TOGGLE" */
+	6818, /* "KEY_ROTATE_LOCK_TOGGLE" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	6842, /* "KEY_BUTTONCONFIG" */
+	6860, /* "KEY_TASKMANAGER" */
+	6877, /* "KEY_JOURNAL" */
+	6890, /* "KEY_CONTROLPANEL" */
+	6908, /* "KEY_APPSELECT" */
+	6923, /* "KEY_SCREENSAVER" */
+	6940, /* "KEY_VOICECOMMAND" */
+	6958, /* "KEY_ASSISTANT" */
+	6973, /* "KEY_KBD_LAYOUT_NEXT" */
+	6994, /* "KEY_EMOJI_PICKER" */
+	7012, /* "KEY_DICTATE" */
+	7025, /* "KEY_CAMERA_ACCESS_ENABLE" */
+	7051, /* "KEY_CAMERA_ACCESS_DISABLE" */
+	7078, /* "KEY_CAMERA_ACCESS_TOGGLE" */
+	0,
+	0,
+	7104, /* "KEY_BRIGHTNESS_MIN" */
+	7124, /* "KEY_BRIGHTNESS_MAX" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	7144, /* "KEY_KBDINPUTASSIST_PREV" */
+	7169, /* "KEY_KBDINPUTASSIST_NEXT" */
+	7194, /* "KEY_KBDINPUTASSIST_PREVGROUP" */
+	7224, /* "KEY_KBDINPUTASSIST_NEXTGROUP" */
+	7254, /* "KEY_KBDINPUTASSIST_ACCEPT" */
+	7281, /* "KEY_KBDINPUTASSIST_CANCEL" */
+	7308, /* "KEY_RIGHT_UP" */
+	7322, /* "KEY_RIGHT_DOWN" */
+	7338, /* "KEY_LEFT_UP" */
+	7351, /* "KEY_LEFT_DOWN" */
+	7366, /* "KEY_ROOT_MENU" */
+	7381, /* "KEY_MEDIA_TOP_MENU" */
+	7401, /* "KEY_NUMERIC_11" */
+	7417, /* "KEY_NUMERIC_12" */
+	7433, /* "KEY_AUDIO_DESC" */
+	7449, /* "KEY_3D_MODE" */
+	7462, /* "KEY_NEXT_FAVORITE" */
+	7481, /* "KEY_STOP_RECORD" */
+	7498, /* "KEY_PAUSE_RECORD" */
+	7516, /* "KEY_VOD" */
+	7525, /* "KEY_UNMUTE" */
+	7537, /* "KEY_FASTREVERSE" */
+	7554, /* "KEY_SLOWREVERSE" */
+	7571, /* "KEY_DATA" */
+	7581, /* "KEY_ONSCREEN_KEYBOARD" */
+	7604, /* "KEY_PRIVACY_SCREEN_TOGGLE" */
+	7631, /* "KEY_SELECTIVE_SCREENSHOT" */
+	7657, /* "KEY_NEXT_ELEMENT" */
+	7675, /* "KEY_PREVIOUS_ELEMENT" */
+	7697, /* "KEY_AUTOPILOT_ENGAGE_TOGGLE" */
+	7726, /* "KEY_MARK_WAYPOINT" */
+	7745, /* "KEY_SOS" */
+	7754, /* "KEY_NAV_CHART" */
+	7769, /* "KEY_FISHING_CHART" */
+	7788, /* "KEY_SINGLE_RANGE_RADAR" */
+	7812, /* "KEY_DUAL_RANGE_RADAR" */
+	7834, /* "KEY_RADAR_OVERLAY" */
+	7853, /* "KEY_TRADITIONAL_SONAR" */
+	7876, /* "KEY_CLEARVU_SONAR" */
+	7895, /* "KEY_SIDEVU_SONAR" */
+	7913, /* "KEY_NAV_INFO" */
+	7927, /* "KEY_BRIGHTNESS_MENU" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	7948, /* "KEY_MACRO1" */
+	7960, /* "KEY_MACRO2" */
+	7972, /* "KEY_MACRO3" */
+	7984, /* "KEY_MACRO4" */
+	7996, /* "KEY_MACRO5" */
+	8008, /* "KEY_MACRO6" */
+	8020, /* "KEY_MACRO7" */
+	8032, /* "KEY_MACRO8" */
+	8044, /* "KEY_MACRO9" */
+	8056, /* "KEY_MACRO10" */
+	8069, /* "KEY_MACRO11" */
+	8082, /* "KEY_MACRO12" */
+	8095, /* "KEY_MACRO13" */
+	8108, /* "KEY_MACRO14" */
+	8121, /* "KEY_MACRO15" */
+	8134, /* "KEY_MACRO16" */
+	8147, /* "KEY_MACRO17" */
+	8160, /* "KEY_MACRO18" */
+	8173, /* "KEY_MACRO19" */
+	8186, /* "KEY_MACRO20" */
+	8199, /* "KEY_MACRO21" */
+	8212, /* "KEY_MACRO22" */
+	8225, /* "KEY_MACRO23" */
+	8238, /* "KEY_MACRO24" */
+	8251, /* "KEY_MACRO25" */
+	8264, /* "KEY_MACRO26" */
+	8277, /* "KEY_MACRO27" */
+	8290, /* "KEY_MACRO28" */
+	8303, /* "KEY_MACRO29" */
+	8316, /* "KEY_MACRO30" */
+	0,
+	0,
+	8329, /* "KEY_MACRO_RECORD_START" */
+	8353, /* "KEY_MACRO_RECORD_STOP" */
+	8376, /* "KEY_MACRO_PRESET_CYCLE" */
+	8400, /* "KEY_MACRO_PRESET1" */
+	8419, /* "KEY_MACRO_PRESET2" */
+	8438, /* "KEY_MACRO_PRESET3" */
+	0,
+	0,
+	8457, /* "KEY_KBD_LCD_MENU1" */
+	8476, /* "KEY_KBD_LCD_MENU2" */
+	8495, /* "KEY_KBD_LCD_MENU3" */
+	8514, /* "KEY_KBD_LCD_MENU4" */
+	8533, /* "KEY_KBD_LCD_MENU5" */
+	0,
+	0,
+	0,
+	8552, /* "BTN_TRIGGER_HAPPY1" */
+	8572, /* "BTN_TRIGGER_HAPPY2" */
+	8592, /* "BTN_TRIGGER_HAPPY3" */
+	8612, /* "BTN_TRIGGER_HAPPY4" */
+	8632, /* "BTN_TRIGGER_HAPPY5" */
+	8652, /* "BTN_TRIGGER_HAPPY6" */
+	8672, /* "BTN_TRIGGER_HAPPY7" */
+	8692, /* "BTN_TRIGGER_HAPPY8" */
+	8712, /* "BTN_TRIGGER_HAPPY9" */
+	8732, /* "BTN_TRIGGER_HAPPY10" */
+	8753, /* "BTN_TRIGGER_HAPPY11" */
+	8774, /* "BTN_TRIGGER_HAPPY12" */
+	8795, /* "BTN_TRIGGER_HAPPY13" */
+	8816, /* "BTN_TRIGGER_HAPPY14" */
+	8837, /* "BTN_TRIGGER_HAPPY15" */
+	8858, /* "BTN_TRIGGER_HAPPY16" */
+	8879, /* "BTN_TRIGGER_HAPPY17" */
+	8900, /* "BTN_TRIGGER_HAPPY18" */
+	8921, /* "BTN_TRIGGER_HAPPY19" */
+	8942, /* "BTN_TRIGGER_HAPPY20" */
+	8963, /* "BTN_TRIGGER_HAPPY21" */
+	8984, /* "BTN_TRIGGER_HAPPY22" */
+	9005, /* "BTN_TRIGGER_HAPPY23" */
+	9026, /* "BTN_TRIGGER_HAPPY24" */
+	9047, /* "BTN_TRIGGER_HAPPY25" */
+	9068, /* "BTN_TRIGGER_HAPPY26" */
+	9089, /* "BTN_TRIGGER_HAPPY27" */
+	9110, /* "BTN_TRIGGER_HAPPY28" */
+	9131, /* "BTN_TRIGGER_HAPPY29" */
+	9152, /* "BTN_TRIGGER_HAPPY30" */
+	9173, /* "BTN_TRIGGER_HAPPY31" */
+	9194, /* "BTN_TRIGGER_HAPPY32" */
+	9215, /* "BTN_TRIGGER_HAPPY33" */
+	9236, /* "BTN_TRIGGER_HAPPY34" */
+	9257, /* "BTN_TRIGGER_HAPPY35" */
+	9278, /* "BTN_TRIGGER_HAPPY36" */
+	9299, /* "BTN_TRIGGER_HAPPY37" */
+	9320, /* "BTN_TRIGGER_HAPPY38" */
+	9341, /* "BTN_TRIGGER_HAPPY39" */
+	9362, /* "BTN_TRIGGER_HAPPY40" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	9383, /* "KEY_MAX" */
+	/* EV_LED */
+	9392, /* "LED_NUML" */
+	9402, /* "LED_CAPSL" */
+	9413, /* "LED_SCROLLL" */
+	9426, /* "LED_COMPOSE" */
+	9439, /* "LED_KANA" */
+	9449, /* "LED_SLEEP" */
+	9460, /* "LED_SUSPEND" */
+	9473, /* "LED_MUTE" */
+	9483, /* "LED_MISC" */
+	9493, /* "LED_MAIL" */
+	9503, /* "LED_CHARGING" */
+	0,
+	0,
+	0,
+	0,
+	9517, /* "LED_MAX" */
+	/* EV_SND */
+	9526, /* "SND_CLICK" */
+	9537, /* "SND_BELL" */
+	9547, /* "SND_TONE" */
+	0,
+	0,
+	0,
+	0,
+	9557, /* "SND_MAX" */
+	/* EV_MSC */
+	9566, /* "MSC_SERIAL" */
+	9578, /* "MSC_PULSELED" */
+	9592, /* "MSC_GESTURE" */
+	9605, /* "MSC_RAW" */
+	9614, /* "MSC_SCAN" */
+	9624, /* "MSC_TIMESTAMP" */
+	0,
+	9639, /* "MSC_MAX" */
+	/* EV_SW */
+	9648, /* "SW_LID" */
+	9656, /* "SW_TABLET_MODE" */
+	9672, /* "SW_HEADPHONE_INSERT" */
+	9693, /* "SW_RFKILL_ALL" */
+	9708, /* "SW_MICROPHONE_INSERT" */
+	9730, /* "SW_DOCK" */
+	9739, /* "SW_LINEOUT_INSERT" */
+	9758, /* "SW_JACK_PHYSICAL_INSERT" */
+	9783, /* "SW_VIDEOOUT_INSERT" */
+	9803, /* "SW_CAMERA_LENS_COVER" */
+	9825, /* "SW_KEYPAD_SLIDE" */
+	9842, /* "SW_FRONT_PROXIMITY" */
+	9862, /* "SW_ROTATE_LOCK" */
+	9878, /* "SW_LINEIN_INSERT" */
+	9896, /* "SW_MUTE_DEVICE" */
+	9912, /* "SW_PEN_INSERTED" */
+	9929, /* "SW_MACHINE_COVER" */
+	/* EV_FF */
+	9947, /* "FF_STATUS_STOPPED" */
+	9966, /* "FF_STATUS_MAX" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	9981, /* "FF_RUMBLE" */
+	9992, /* "FF_PERIODIC" */
+	10005, /* "FF_CONSTANT" */
+	10018, /* "FF_SPRING" */
+	10029, /* "FF_FRICTION" */
+	10042, /* "FF_DAMPER" */
+	10053, /* "FF_INERTIA" */
+	10065, /* "FF_RAMP" */
+	10074, /* "FF_SQUARE" */
+	10085, /* "FF_TRIANGLE" */
+	10098, /* "FF_SINE" */
+	10107, /* "FF_SAW_UP" */
+	10118, /* "FF_SAW_DOWN" */
+	10131, /* "FF_CUSTOM" */
+	0,
+	0,
+	10142, /* "FF_GAIN" */
+	10151, /* "FF_AUTOCENTER" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	10166, /* "FF_MAX" */
+	/* EV_SYN */
+	10174, /* "SYN_REPORT" */
+	10186, /* "SYN_CONFIG" */
+	10198, /* "SYN_MT_REPORT" */
+	10213, /* "SYN_DROPPED" */
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	10226, /* "SYN_MAX" */
+	/* EV_REP */
+	10235, /* "REP_DELAY" */
+	10246, /* "REP_PERIOD" */
 };
 
-static const char * const rep_map[REP_MAX + 1] = {
-	[REP_DELAY] = "REP_DELAY",
-	[REP_PERIOD] = "REP_PERIOD",
-};
-
-static const char * const input_prop_map[INPUT_PROP_MAX + 1] = {
-	[INPUT_PROP_POINTER] = "INPUT_PROP_POINTER",
-	[INPUT_PROP_DIRECT] = "INPUT_PROP_DIRECT",
-	[INPUT_PROP_BUTTONPAD] = "INPUT_PROP_BUTTONPAD",
-	[INPUT_PROP_SEMI_MT] = "INPUT_PROP_SEMI_MT",
-	[INPUT_PROP_TOPBUTTONPAD] = "INPUT_PROP_TOPBUTTONPAD",
-	[INPUT_PROP_POINTING_STICK] = "INPUT_PROP_POINTING_STICK",
-	[INPUT_PROP_ACCELEROMETER] = "INPUT_PROP_ACCELEROMETER",
-	[INPUT_PROP_MAX] = "INPUT_PROP_MAX",
-};
-
-static const char * const mt_tool_map[MT_TOOL_MAX + 1] = {
-	[MT_TOOL_FINGER] = "MT_TOOL_FINGER",
-	[MT_TOOL_PEN] = "MT_TOOL_PEN",
-	[MT_TOOL_PALM] = "MT_TOOL_PALM",
-	[MT_TOOL_DIAL] = "MT_TOOL_DIAL",
-	[MT_TOOL_MAX] = "MT_TOOL_MAX",
-};
-
-static const char * const * const event_type_map[EV_MAX + 1] = {
-	[EV_REL] = rel_map,
-	[EV_ABS] = abs_map,
-	[EV_KEY] = key_map,
-	[EV_LED] = led_map,
-	[EV_SND] = snd_map,
-	[EV_MSC] = msc_map,
-	[EV_SW] = sw_map,
-	[EV_FF] = ff_map,
-	[EV_SYN] = syn_map,
-	[EV_REP] = rep_map,
+static const unsigned short event_type_map[EV_MAX + 1] = {
+	[EV_REL] = 0,
+	[EV_ABS] = 16,
+	[EV_KEY] = 80,
+	[EV_LED] = 848,
+	[EV_SND] = 864,
+	[EV_MSC] = 872,
+	[EV_SW] = 880,
+	[EV_FF] = 897,
+	[EV_SYN] = 1025,
+	[EV_REP] = 1041,
 };
 
 #if __clang__
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Winitializer-overrides"
-#else
+#elif __GNUC__
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Woverride-init"
 #endif
 static const int ev_max[EV_MAX + 1] = {
-	[0 ... EV_MAX] = -1,
-	[EV_REL] = REL_MAX,
-	[EV_ABS] = ABS_MAX,
-	[EV_KEY] = KEY_MAX,
-	[EV_LED] = LED_MAX,
-	[EV_SND] = SND_MAX,
-	[EV_MSC] = MSC_MAX,
-	[EV_SW] = SW_MAX,
-	[EV_FF] = FF_MAX,
-	[EV_SYN] = SYN_MAX,
-	[EV_REP] = REP_MAX,
+	SYN_MAX,
+	KEY_MAX,
+	REL_MAX,
+	ABS_MAX,
+	MSC_MAX,
+	SW_MAX,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	LED_MAX,
+	SND_MAX,
+	-1,
+	REP_MAX,
+	FF_MAX,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
+	-1,
 };
 #if __clang__
 #pragma clang diagnostic pop /* "-Winitializer-overrides" */
-#else
+#elif __GNUC__
 #pragma GCC diagnostic pop /* "-Woverride-init" */
 #endif
 
 struct name_entry {
-	const char *name;
+	unsigned short name; /* offset into names_blob */
+	unsigned short len;
 	unsigned int value;
 };
 
 static const struct name_entry tool_type_names[] = {
-	{ .name = "MT_TOOL_DIAL", .value = MT_TOOL_DIAL },
-	{ .name = "MT_TOOL_FINGER", .value = MT_TOOL_FINGER },
-	{ .name = "MT_TOOL_MAX", .value = MT_TOOL_MAX },
-	{ .name = "MT_TOOL_PALM", .value = MT_TOOL_PALM },
-	{ .name = "MT_TOOL_PEN", .value = MT_TOOL_PEN },
+	{ .name = 328, .len = 12, .value = MT_TOOL_DIAL },
+	{ .name = 285, .len = 14, .value = MT_TOOL_FINGER },
+	{ .name = 342, .len = 11, .value = MT_TOOL_MAX },
+	{ .name = 314, .len = 12, .value = MT_TOOL_PALM },
+	{ .name = 301, .len = 11, .value = MT_TOOL_PEN },
+};
+
+static const short tool_type_names_hash_g[] = {
+	0, 1, -1, 0, 5,
+};
+
+static const unsigned short tool_type_names_hash_index[] = {
+	3, 1, 2, 4, 0,
 };
 
 static const struct name_entry ev_names[] = {
-	{ .name = "EV_ABS", .value = EV_ABS },
-	{ .name = "EV_FF", .value = EV_FF },
-	{ .name = "EV_FF_STATUS", .value = EV_FF_STATUS },
-	{ .name = "EV_KEY", .value = EV_KEY },
-	{ .name = "EV_LED", .value = EV_LED },
-	{ .name = "EV_MAX", .value = EV_MAX },
-	{ .name = "EV_MSC", .value = EV_MSC },
-	{ .name = "EV_PWR", .value = EV_PWR },
-	{ .name = "EV_REL", .value = EV_REL },
-	{ .name = "EV_REP", .value = EV_REP },
-	{ .name = "EV_SND", .value = EV_SND },
-	{ .name = "EV_SW", .value = EV_SW },
-	{ .name = "EV_SYN", .value = EV_SYN },
+	{ .name = 26, .len = 6, .value = EV_ABS },
+	{ .name = 73, .len = 5, .value = EV_FF },
+	{ .name = 88, .len = 12, .value = EV_FF_STATUS },
+	{ .name = 10, .len = 6, .value = EV_KEY },
+	{ .name = 49, .len = 6, .value = EV_LED },
+	{ .name = 102, .len = 6, .value = EV_MAX },
+	{ .name = 34, .len = 6, .value = EV_MSC },
+	{ .name = 80, .len = 6, .value = EV_PWR },
+	{ .name = 18, .len = 6, .value = EV_REL },
+	{ .name = 65, .len = 6, .value = EV_REP },
+	{ .name = 57, .len = 6, .value = EV_SND },
+	{ .name = 42, .len = 5, .value = EV_SW },
+	{ .name = 2, .len = 6, .value = EV_SYN },
+};
+
+static const short ev_names_hash_g[] = {
+	-13, 0, -11, -10, -9, 0, 1, 0, -7, -2, 1, -1,
+	1,
+};
+
+static const unsigned short ev_names_hash_index[] = {
+	5, 8, 12, 0, 10, 11, 9, 4, 1, 7, 6, 2,
+	3,
 };
 
 static const struct name_entry code_names[] = {
-	{ .name = "ABS_BRAKE", .value = ABS_BRAKE },
-	{ .name = "ABS_DISTANCE", .value = ABS_DISTANCE },
-	{ .name = "ABS_GAS", .value = ABS_GAS },
-	{ .name = "ABS_HAT0X", .value = ABS_HAT0X },
-	{ .name = "ABS_HAT0Y", .value = ABS_HAT0Y },
-	{ .name = "ABS_HAT1X", .value = ABS_HAT1X },
-	{ .name = "ABS_HAT1Y", .value = ABS_HAT1Y },
-	{ .name = "ABS_HAT2X", .value = ABS_HAT2X },
-	{ .name = "ABS_HAT2Y", .value = ABS_HAT2Y },
-	{ .name = "ABS_HAT3X", .value = ABS_HAT3X },
-	{ .name = "ABS_HAT3Y", .value = ABS_HAT3Y },
-	{ .name = "ABS_MAX", .value = ABS_MAX },
-	{ .name = "ABS_MISC", .value = ABS_MISC },
-	{ .name = "ABS_MT_BLOB_ID", .value = ABS_MT_BLOB_ID },
-	{ .name = "ABS_MT_DISTANCE", .value = ABS_MT_DISTANCE },
-	{ .name = "ABS_MT_ORIENTATION", .value = ABS_MT_ORIENTATION },
-	{ .name = "ABS_MT_POSITION_X", .value = ABS_MT_POSITION_X },
-	{ .name = "ABS_MT_POSITION_Y", .value = ABS_MT_POSITION_Y },
-	{ .name = "ABS_MT_PRESSURE", .value = ABS_MT_PRESSURE },
-	{ .name = "ABS_MT_SLOT", .value = ABS_MT_SLOT },
-	{ .name = "ABS_MT_TOOL_TYPE", .value = ABS_MT_TOOL_TYPE },
-	{ .name = "ABS_MT_TOOL_X", .value = ABS_MT_TOOL_X },
-	{ .name = "ABS_MT_TOOL_Y", .value = ABS_MT_TOOL_Y },
-	{ .name = "ABS_MT_TOUCH_MAJOR", .value = ABS_MT_TOUCH_MAJOR },
-	{ .name = "ABS_MT_TOUCH_MINOR", .value = ABS_MT_TOUCH_MINOR },
-	{ .name = "ABS_MT_TRACKING_ID", .value = ABS_MT_TRACKING_ID },
-	{ .name = "ABS_MT_WIDTH_MAJOR", .value = ABS_MT_WIDTH_MAJOR },
-	{ .name = "ABS_MT_WIDTH_MINOR", .value = ABS_MT_WIDTH_MINOR },
-	{ .name = "ABS_PRESSURE", .value = ABS_PRESSURE },
-	{ .name = "ABS_RESERVED", .value = ABS_RESERVED },
-	{ .name = "ABS_RUDDER", .value = ABS_RUDDER },
-	{ .name = "ABS_RX", .value = ABS_RX },
-	{ .name = "ABS_RY", .value = ABS_RY },
-	{ .name = "ABS_RZ", .value = ABS_RZ },
-	{ .name = "ABS_THROTTLE", .value = ABS_THROTTLE },
-	{ .name = "ABS_TILT_X", .value = ABS_TILT_X },
-	{ .name = "ABS_TILT_Y", .value = ABS_TILT_Y },
-	{ .name = "ABS_TOOL_WIDTH", .value = ABS_TOOL_WIDTH },
-	{ .name = "ABS_VOLUME", .value = ABS_VOLUME },
-	{ .name = "ABS_WHEEL", .value = ABS_WHEEL },
-	{ .name = "ABS_X", .value = ABS_X },
-	{ .name = "ABS_Y", .value = ABS_Y },
-	{ .name = "ABS_Z", .value = ABS_Z },
-	{ .name = "BTN_0", .value = BTN_0 },
-	{ .name = "BTN_1", .value = BTN_1 },
-	{ .name = "BTN_2", .value = BTN_2 },
-	{ .name = "BTN_3", .value = BTN_3 },
-	{ .name = "BTN_4", .value = BTN_4 },
-	{ .name = "BTN_5", .value = BTN_5 },
-	{ .name = "BTN_6", .value = BTN_6 },
-	{ .name = "BTN_7", .value = BTN_7 },
-	{ .name = "BTN_8", .value = BTN_8 },
-	{ .name = "BTN_9", .value = BTN_9 },
-	{ .name = "BTN_A", .value = BTN_A },
-	{ .name = "BTN_B", .value = BTN_B },
-	{ .name = "BTN_BACK", .value = BTN_BACK },
-	{ .name = "BTN_BASE", .value = BTN_BASE },
-	{ .name = "BTN_BASE2", .value = BTN_BASE2 },
-	{ .name = "BTN_BASE3", .value = BTN_BASE3 },
-	{ .name = "BTN_BASE4", .value = BTN_BASE4 },
-	{ .name = "BTN_BASE5", .value = BTN_BASE5 },
-	{ .name = "BTN_BASE6", .value = BTN_BASE6 },
-	{ .name = "BTN_C", .value = BTN_C },
-	{ .name = "BTN_DEAD", .value = BTN_DEAD },
-	{ .name = "BTN_DPAD_DOWN", .value = BTN_DPAD_DOWN },
-	{ .name = "BTN_DPAD_LEFT", .value = BTN_DPAD_LEFT },
-	{ .name = "BTN_DPAD_RIGHT", .value = BTN_DPAD_RIGHT },
-	{ .name = "BTN_DPAD_UP", .value = BTN_DPAD_UP },
-	{ .name = "BTN_EAST", .value = BTN_EAST },
-	{ .name = "BTN_EXTRA", .value = BTN_EXTRA },
-	{ .name = "BTN_FORWARD", .value = BTN_FORWARD },
-	{ .name = "BTN_GEAR_DOWN", .value = BTN_GEAR_DOWN },
-	{ .name = "BTN_GEAR_UP", .value = BTN_GEAR_UP },
-	{ .name = "BTN_LEFT", .value = BTN_LEFT },
-	{ .name = "BTN_MIDDLE", .value = BTN_MIDDLE },
-	{ .name = "BTN_MODE", .value = BTN_MODE },
-	{ .name = "BTN_NORTH", .value = BTN_NORTH },
-	{ .name = "BTN_PINKIE", .value = BTN_PINKIE },
-	{ .name = "BTN_RIGHT", .value = BTN_RIGHT },
-	{ .name = "BTN_SELECT", .value = BTN_SELECT },
-	{ .name = "BTN_SIDE", .value = BTN_SIDE },
-	{ .name = "BTN_SOUTH", .value = BTN_SOUTH },
-	{ .name = "BTN_START", .value = BTN_START },
-	{ .name = "BTN_STYLUS", .value = BTN_STYLUS },
-	{ .name = "BTN_STYLUS2", .value = BTN_STYLUS2 },
-	{ .name = "BTN_STYLUS3", .value = BTN_STYLUS3 },
-	{ .name = "BTN_TASK", .value = BTN_TASK },
-	{ .name = "BTN_THUMB", .value = BTN_THUMB },
-	{ .name = "BTN_THUMB2", .value = BTN_THUMB2 },
-	{ .name = "BTN_THUMBL", .value = BTN_THUMBL },
-	{ .name = "BTN_THUMBR", .value = BTN_THUMBR },
-	{ .name = "BTN_TL", .value = BTN_TL },
-	{ .name = "BTN_TL2", .value = BTN_TL2 },
-	{ .name = "BTN_TOOL_AIRBRUSH", .value = BTN_TOOL_AIRBRUSH },
-	{ .name = "BTN_TOOL_BRUSH", .value = BTN_TOOL_BRUSH },
-	{ .name = "BTN_TOOL_DOUBLETAP", .value = BTN_TOOL_DOUBLETAP },
-	{ .name = "BTN_TOOL_FINGER", .value = BTN_TOOL_FINGER },
-	{ .name = "BTN_TOOL_LENS", .value = BTN_TOOL_LENS },
-	{ .name = "BTN_TOOL_MOUSE", .value = BTN_TOOL_MOUSE },
-	{ .name = "BTN_TOOL_PEN", .value = BTN_TOOL_PEN },
-	{ .name = "BTN_TOOL_PENCIL", .value = BTN_TOOL_PENCIL },
-	{ .name = "BTN_TOOL_QUADTAP", .value = BTN_TOOL_QUADTAP },
-	{ .name = "BTN_TOOL_QUINTTAP", .value = BTN_TOOL_QUINTTAP },
-	{ .name = "BTN_TOOL_RUBBER", .value = BTN_TOOL_RUBBER },
-	{ .name = "BTN_TOOL_TRIPLETAP", .value = BTN_TOOL_TRIPLETAP },
-	{ .name = "BTN_TOP", .value = BTN_TOP },
-	{ .name = "BTN_TOP2", .value = BTN_TOP2 },
-	{ .name = "BTN_TOUCH", .value = BTN_TOUCH },
-	{ .name = "BTN_TR", .value = BTN_TR },
-	{ .name = "BTN_TR2", .value = BTN_TR2 },
-	{ .name = "BTN_TRIGGER", .value = BTN_TRIGGER },
-	{ .name = "BTN_TRIGGER_HAPPY1", .value = BTN_TRIGGER_HAPPY1 },
-	{ .name = "BTN_TRIGGER_HAPPY10", .value = BTN_TRIGGER_HAPPY10 },
-	{ .name = "BTN_TRIGGER_HAPPY11", .value = BTN_TRIGGER_HAPPY11 },
-	{ .name = "BTN_TRIGGER_HAPPY12", .value = BTN_TRIGGER_HAPPY12 },
-	{ .name = "BTN_TRIGGER_HAPPY13", .value = BTN_TRIGGER_HAPPY13 },
-	{ .name = "BTN_TRIGGER_HAPPY14", .value = BTN_TRIGGER_HAPPY14 },
-	{ .name = "BTN_TRIGGER_HAPPY15", .value = BTN_TRIGGER_HAPPY15 },
-	{ .name = "BTN_TRIGGER_HAPPY16", .value = BTN_TRIGGER_HAPPY16 },
-	{ .name = "BTN_TRIGGER_HAPPY17", .value = BTN_TRIGGER_HAPPY17 },
-	{ .name = "BTN_TRIGGER_HAPPY18", .value = BTN_TRIGGER_HAPPY18 },
-	{ .name = "BTN_TRIGGER_HAPPY19", .value = BTN_TRIGGER_HAPPY19 },
-	{ .name = "BTN_TRIGGER_HAPPY2", .value = BTN_TRIGGER_HAPPY2 },
-	{ .name = "BTN_TRIGGER_HAPPY20", .value = BTN_TRIGGER_HAPPY20 },
-	{ .name = "BTN_TRIGGER_HAPPY21", .value = BTN_TRIGGER_HAPPY21 },
-	{ .name = "BTN_TRIGGER_HAPPY22", .value = BTN_TRIGGER_HAPPY22 },
-	{ .name = "BTN_TRIGGER_HAPPY23", .value = BTN_TRIGGER_HAPPY23 },
-	{ .name = "BTN_TRIGGER_HAPPY24", .value = BTN_TRIGGER_HAPPY24 },
-	{ .name = "BTN_TRIGGER_HAPPY25", .value = BTN_TRIGGER_HAPPY25 },
-	{ .name = "BTN_TRIGGER_HAPPY26", .value = BTN_TRIGGER_HAPPY26 },
-	{ .name = "BTN_TRIGGER_HAPPY27", .value = BTN_TRIGGER_HAPPY27 },
-	{ .name = "BTN_TRIGGER_HAPPY28", .value = BTN_TRIGGER_HAPPY28 },
-	{ .name = "BTN_TRIGGER_HAPPY29", .value = BTN_TRIGGER_HAPPY29 },
-	{ .name = "BTN_TRIGGER_HAPPY3", .value = BTN_TRIGGER_HAPPY3 },
-	{ .name = "BTN_TRIGGER_HAPPY30", .value = BTN_TRIGGER_HAPPY30 },
-	{ .name = "BTN_TRIGGER_HAPPY31", .value = BTN_TRIGGER_HAPPY31 },
-	{ .name = "BTN_TRIGGER_HAPPY32", .value = BTN_TRIGGER_HAPPY32 },
-	{ .name = "BTN_TRIGGER_HAPPY33", .value = BTN_TRIGGER_HAPPY33 },
-	{ .name = "BTN_TRIGGER_HAPPY34", .value = BTN_TRIGGER_HAPPY34 },
-	{ .name = "BTN_TRIGGER_HAPPY35", .value = BTN_TRIGGER_HAPPY35 },
-	{ .name = "BTN_TRIGGER_HAPPY36", .value = BTN_TRIGGER_HAPPY36 },
-	{ .name = "BTN_TRIGGER_HAPPY37", .value = BTN_TRIGGER_HAPPY37 },
-	{ .name = "BTN_TRIGGER_HAPPY38", .value = BTN_TRIGGER_HAPPY38 },
-	{ .name = "BTN_TRIGGER_HAPPY39", .value = BTN_TRIGGER_HAPPY39 },
-	{ .name = "BTN_TRIGGER_HAPPY4", .value = BTN_TRIGGER_HAPPY4 },
-	{ .name = "BTN_TRIGGER_HAPPY40", .value = BTN_TRIGGER_HAPPY40 },
-	{ .name = "BTN_TRIGGER_HAPPY5", .value = BTN_TRIGGER_HAPPY5 },
-	{ .name = "BTN_TRIGGER_HAPPY6", .value = BTN_TRIGGER_HAPPY6 },
-	{ .name = "BTN_TRIGGER_HAPPY7", .value = BTN_TRIGGER_HAPPY7 },
-	{ .name = "BTN_TRIGGER_HAPPY8", .value = BTN_TRIGGER_HAPPY8 },
-	{ .name = "BTN_TRIGGER_HAPPY9", .value = BTN_TRIGGER_HAPPY9 },
-	{ .name = "BTN_WEST", .value = BTN_WEST },
-	{ .name = "BTN_X", .value = BTN_X },
-	{ .name = "BTN_Y", .value = BTN_Y },
-	{ .name = "BTN_Z", .value = BTN_Z },
-	{ .name = "FF_AUTOCENTER", .value = FF_AUTOCENTER },
-	{ .name = "FF_CONSTANT", .value = FF_CONSTANT },
-	{ .name = "FF_CUSTOM", .value = FF_CUSTOM },
-	{ .name = "FF_DAMPER", .value = FF_DAMPER },
-	{ .name = "FF_FRICTION", .value = FF_FRICTION },
-	{ .name = "FF_GAIN", .value = FF_GAIN },
-	{ .name = "FF_INERTIA", .value = FF_INERTIA },
-	{ .name = "FF_MAX", .value = FF_MAX },
-	{ .name = "FF_PERIODIC", .value = FF_PERIODIC },
-	{ .name = "FF_RAMP", .value = FF_RAMP },
-	{ .name = "FF_RUMBLE", .value = FF_RUMBLE },
-	{ .name = "FF_SAW_DOWN", .value = FF_SAW_DOWN },
-	{ .name = "FF_SAW_UP", .value = FF_SAW_UP },
-	{ .name = "FF_SINE", .value = FF_SINE },
-	{ .name = "FF_SPRING", .value = FF_SPRING },
-	{ .name = "FF_SQUARE", .value = FF_SQUARE },
-	{ .name = "FF_STATUS_MAX", .value = FF_STATUS_MAX },
-	{ .name = "FF_STATUS_STOPPED", .value = FF_STATUS_STOPPED },
-	{ .name = "FF_TRIANGLE", .value = FF_TRIANGLE },
-	{ .name = "KEY_0", .value = KEY_0 },
-	{ .name = "KEY_1", .value = KEY_1 },
-	{ .name = "KEY_102ND", .value = KEY_102ND },
-	{ .name = "KEY_10CHANNELSDOWN", .value = KEY_10CHANNELSDOWN },
-	{ .name = "KEY_10CHANNELSUP", .value = KEY_10CHANNELSUP },
-	{ .name = "KEY_2", .value = KEY_2 },
-	{ .name = "KEY_3", .value = KEY_3 },
-	{ .name = "KEY_3D_MODE", .value = KEY_3D_MODE },
-	{ .name = "KEY_4", .value = KEY_4 },
-	{ .name = "KEY_5", .value = KEY_5 },
-	{ .name = "KEY_6", .value = KEY_6 },
-	{ .name = "KEY_7", .value = KEY_7 },
-	{ .name = "KEY_8", .value = KEY_8 },
-	{ .name = "KEY_9", .value = KEY_9 },
-	{ .name = "KEY_A", .value = KEY_A },
-	{ .name = "KEY_AB", .value = KEY_AB },
-	{ .name = "KEY_ADDRESSBOOK", .value = KEY_ADDRESSBOOK },
-	{ .name = "KEY_AGAIN", .value = KEY_AGAIN },
-	{ .name = "KEY_ALS_TOGGLE", .value = KEY_ALS_TOGGLE },
-	{ .name = "KEY_ALTERASE", .value = KEY_ALTERASE },
-	{ .name = "KEY_ANGLE", .value = KEY_ANGLE },
-	{ .name = "KEY_APOSTROPHE", .value = KEY_APOSTROPHE },
-	{ .name = "KEY_APPSELECT", .value = KEY_APPSELECT },
-	{ .name = "KEY_ARCHIVE", .value = KEY_ARCHIVE },
-	{ .name = "KEY_ASPECT_RATIO", .value = KEY_ASPECT_RATIO },
-	{ .name = "KEY_ASSISTANT", .value = KEY_ASSISTANT },
-	{ .name = "KEY_ATTENDANT_OFF", .value = KEY_ATTENDANT_OFF },
-	{ .name = "KEY_ATTENDANT_ON", .value = KEY_ATTENDANT_ON },
-	{ .name = "KEY_ATTENDANT_TOGGLE", .value = KEY_ATTENDANT_TOGGLE },
-	{ .name = "KEY_AUDIO", .value = KEY_AUDIO },
-	{ .name = "KEY_AUDIO_DESC", .value = KEY_AUDIO_DESC },
-	{ .name = "KEY_AUX", .value = KEY_AUX },
-	{ .name = "KEY_B", .value = KEY_B },
-	{ .name = "KEY_BACK", .value = KEY_BACK },
-	{ .name = "KEY_BACKSLASH", .value = KEY_BACKSLASH },
-	{ .name = "KEY_BACKSPACE", .value = KEY_BACKSPACE },
-	{ .name = "KEY_BASSBOOST", .value = KEY_BASSBOOST },
-	{ .name = "KEY_BATTERY", .value = KEY_BATTERY },
-	{ .name = "KEY_BLUE", .value = KEY_BLUE },
-	{ .name = "KEY_BLUETOOTH", .value = KEY_BLUETOOTH },
-	{ .name = "KEY_BOOKMARKS", .value = KEY_BOOKMARKS },
-	{ .name = "KEY_BREAK", .value = KEY_BREAK },
-	{ .name = "KEY_BRIGHTNESSDOWN", .value = KEY_BRIGHTNESSDOWN },
-	{ .name = "KEY_BRIGHTNESSUP", .value = KEY_BRIGHTNESSUP },
-	{ .name = "KEY_BRIGHTNESS_AUTO", .value = KEY_BRIGHTNESS_AUTO },
-	{ .name = "KEY_BRIGHTNESS_CYCLE", .value = KEY_BRIGHTNESS_CYCLE },
-	{ .name = "KEY_BRIGHTNESS_MAX", .value = KEY_BRIGHTNESS_MAX },
-	{ .name = "KEY_BRIGHTNESS_MIN", .value = KEY_BRIGHTNESS_MIN },
-	{ .name = "KEY_BRL_DOT1", .value = KEY_BRL_DOT1 },
-	{ .name = "KEY_BRL_DOT10", .value = KEY_BRL_DOT10 },
-	{ .name = "KEY_BRL_DOT2", .value = KEY_BRL_DOT2 },
-	{ .name = "KEY_BRL_DOT3", .value = KEY_BRL_DOT3 },
-	{ .name = "KEY_BRL_DOT4", .value = KEY_BRL_DOT4 },
-	{ .name = "KEY_BRL_DOT5", .value = KEY_BRL_DOT5 },
-	{ .name = "KEY_BRL_DOT6", .value = KEY_BRL_DOT6 },
-	{ .name = "KEY_BRL_DOT7", .value = KEY_BRL_DOT7 },
-	{ .name = "KEY_BRL_DOT8", .value = KEY_BRL_DOT8 },
-	{ .name = "KEY_BRL_DOT9", .value = KEY_BRL_DOT9 },
-	{ .name = "KEY_BUTTONCONFIG", .value = KEY_BUTTONCONFIG },
-	{ .name = "KEY_C", .value = KEY_C },
-	{ .name = "KEY_CALC", .value = KEY_CALC },
-	{ .name = "KEY_CALENDAR", .value = KEY_CALENDAR },
-	{ .name = "KEY_CAMERA", .value = KEY_CAMERA },
-	{ .name = "KEY_CAMERA_DOWN", .value = KEY_CAMERA_DOWN },
-	{ .name = "KEY_CAMERA_FOCUS", .value = KEY_CAMERA_FOCUS },
-	{ .name = "KEY_CAMERA_LEFT", .value = KEY_CAMERA_LEFT },
-	{ .name = "KEY_CAMERA_RIGHT", .value = KEY_CAMERA_RIGHT },
-	{ .name = "KEY_CAMERA_UP", .value = KEY_CAMERA_UP },
-	{ .name = "KEY_CAMERA_ZOOMIN", .value = KEY_CAMERA_ZOOMIN },
-	{ .name = "KEY_CAMERA_ZOOMOUT", .value = KEY_CAMERA_ZOOMOUT },
-	{ .name = "KEY_CANCEL", .value = KEY_CANCEL },
-	{ .name = "KEY_CAPSLOCK", .value = KEY_CAPSLOCK },
-	{ .name = "KEY_CD", .value = KEY_CD },
-	{ .name = "KEY_CHANNEL", .value = KEY_CHANNEL },
-	{ .name = "KEY_CHANNELDOWN", .value = KEY_CHANNELDOWN },
-	{ .name = "KEY_CHANNELUP", .value = KEY_CHANNELUP },
-	{ .name = "KEY_CHAT", .value = KEY_CHAT },
-	{ .name = "KEY_CLEAR", .value = KEY_CLEAR },
-	{ .name = "KEY_CLOSE", .value = KEY_CLOSE },
-	{ .name = "KEY_CLOSECD", .value = KEY_CLOSECD },
-	{ .name = "KEY_COFFEE", .value = KEY_COFFEE },
-	{ .name = "KEY_COMMA", .value = KEY_COMMA },
-	{ .name = "KEY_COMPOSE", .value = KEY_COMPOSE },
-	{ .name = "KEY_COMPUTER", .value = KEY_COMPUTER },
-	{ .name = "KEY_CONFIG", .value = KEY_CONFIG },
-	{ .name = "KEY_CONNECT", .value = KEY_CONNECT },
-	{ .name = "KEY_CONTEXT_MENU", .value = KEY_CONTEXT_MENU },
-	{ .name = "KEY_CONTROLPANEL", .value = KEY_CONTROLPANEL },
-	{ .name = "KEY_COPY", .value = KEY_COPY },
-	{ .name = "KEY_CUT", .value = KEY_CUT },
-	{ .name = "KEY_CYCLEWINDOWS", .value = KEY_CYCLEWINDOWS },
-	{ .name = "KEY_D", .value = KEY_D },
-	{ .name = "KEY_DASHBOARD", .value = KEY_DASHBOARD },
-	{ .name = "KEY_DATA", .value = KEY_DATA },
-	{ .name = "KEY_DATABASE", .value = KEY_DATABASE },
-	{ .name = "KEY_DELETE", .value = KEY_DELETE },
-	{ .name = "KEY_DELETEFILE", .value = KEY_DELETEFILE },
-	{ .name = "KEY_DEL_EOL", .value = KEY_DEL_EOL },
-	{ .name = "KEY_DEL_EOS", .value = KEY_DEL_EOS },
-	{ .name = "KEY_DEL_LINE", .value = KEY_DEL_LINE },
-	{ .name = "KEY_DIGITS", .value = KEY_DIGITS },
-	{ .name = "KEY_DIRECTORY", .value = KEY_DIRECTORY },
-	{ .name = "KEY_DISPLAYTOGGLE", .value = KEY_DISPLAYTOGGLE },
-	{ .name = "KEY_DISPLAY_OFF", .value = KEY_DISPLAY_OFF },
-	{ .name = "KEY_DOCUMENTS", .value = KEY_DOCUMENTS },
-	{ .name = "KEY_DOLLAR", .value = KEY_DOLLAR },
-	{ .name = "KEY_DOT", .value = KEY_DOT },
-	{ .name = "KEY_DOWN", .value = KEY_DOWN },
-	{ .name = "KEY_DVD", .value = KEY_DVD },
-	{ .name = "KEY_E", .value = KEY_E },
-	{ .name = "KEY_EDIT", .value = KEY_EDIT },
-	{ .name = "KEY_EDITOR", .value = KEY_EDITOR },
-	{ .name = "KEY_EJECTCD", .value = KEY_EJECTCD },
-	{ .name = "KEY_EJECTCLOSECD", .value = KEY_EJECTCLOSECD },
-	{ .name = "KEY_EMAIL", .value = KEY_EMAIL },
-	{ .name = "KEY_END", .value = KEY_END },
-	{ .name = "KEY_ENTER", .value = KEY_ENTER },
-	{ .name = "KEY_EPG", .value = KEY_EPG },
-	{ .name = "KEY_EQUAL", .value = KEY_EQUAL },
-	{ .name = "KEY_ESC", .value = KEY_ESC },
-	{ .name = "KEY_EURO", .value = KEY_EURO },
-	{ .name = "KEY_EXIT", .value = KEY_EXIT },
-	{ .name = "KEY_F", .value = KEY_F },
-	{ .name = "KEY_F1", .value = KEY_F1 },
-	{ .name = "KEY_F10", .value = KEY_F10 },
-	{ .name = "KEY_F11", .value = KEY_F11 },
-	{ .name = "KEY_F12", .value = KEY_F12 },
-	{ .name = "KEY_F13", .value = KEY_F13 },
-	{ .name = "KEY_F14", .value = KEY_F14 },
-	{ .name = "KEY_F15", .value = KEY_F15 },
-	{ .name = "KEY_F16", .value = KEY_F16 },
-	{ .name = "KEY_F17", .value = KEY_F17 },
-	{ .name = "KEY_F18", .value = KEY_F18 },
-	{ .name = "KEY_F19", .value = KEY_F19 },
-	{ .name = "KEY_F2", .value = KEY_F2 },
-	{ .name = "KEY_F20", .value = KEY_F20 },
-	{ .name = "KEY_F21", .value = KEY_F21 },
-	{ .name = "KEY_F22", .value = KEY_F22 },
-	{ .name = "KEY_F23", .value = KEY_F23 },
-	{ .name = "KEY_F24", .value = KEY_F24 },
-	{ .name = "KEY_F3", .value = KEY_F3 },
-	{ .name = "KEY_F4", .value = KEY_F4 },
-	{ .name = "KEY_F5", .value = KEY_F5 },
-	{ .name = "KEY_F6", .value = KEY_F6 },
-	{ .name = "KEY_F7", .value = KEY_F7 },
-	{ .name = "KEY_F8", .value = KEY_F8 },
-	{ .name = "KEY_F9", .value = KEY_F9 },
-	{ .name = "KEY_FASTFORWARD", .value = KEY_FASTFORWARD },
-	{ .name = "KEY_FASTREVERSE", .value = KEY_FASTREVERSE },
-	{ .name = "KEY_FAVORITES", .value = KEY_FAVORITES },
-	{ .name = "KEY_FILE", .value = KEY_FILE },
-	{ .name = "KEY_FINANCE", .value = KEY_FINANCE },
-	{ .name = "KEY_FIND", .value = KEY_FIND },
-	{ .name = "KEY_FIRST", .value = KEY_FIRST },
-	{ .name = "KEY_FN", .value = KEY_FN },
-	{ .name = "KEY_FN_1", .value = KEY_FN_1 },
-	{ .name = "KEY_FN_2", .value = KEY_FN_2 },
-	{ .name = "KEY_FN_B", .value = KEY_FN_B },
-	{ .name = "KEY_FN_D", .value = KEY_FN_D },
-	{ .name = "KEY_FN_E", .value = KEY_FN_E },
-	{ .name = "KEY_FN_ESC", .value = KEY_FN_ESC },
-	{ .name = "KEY_FN_F", .value = KEY_FN_F },
-	{ .name = "KEY_FN_F1", .value = KEY_FN_F1 },
-	{ .name = "KEY_FN_F10", .value = KEY_FN_F10 },
-	{ .name = "KEY_FN_F11", .value = KEY_FN_F11 },
-	{ .name = "KEY_FN_F12", .value = KEY_FN_F12 },
-	{ .name = "KEY_FN_F2", .value = KEY_FN_F2 },
-	{ .name = "KEY_FN_F3", .value = KEY_FN_F3 },
-	{ .name = "KEY_FN_F4", .value = KEY_FN_F4 },
-	{ .name = "KEY_FN_F5", .value = KEY_FN_F5 },
-	{ .name = "KEY_FN_F6", .value = KEY_FN_F6 },
-	{ .name = "KEY_FN_F7", .value = KEY_FN_F7 },
-	{ .name = "KEY_FN_F8", .value = KEY_FN_F8 },
-	{ .name = "KEY_FN_F9", .value = KEY_FN_F9 },
-	{ .name = "KEY_FN_S", .value = KEY_FN_S },
-	{ .name = "KEY_FORWARD", .value = KEY_FORWARD },
-	{ .name = "KEY_FORWARDMAIL", .value = KEY_FORWARDMAIL },
-	{ .name = "KEY_FRAMEBACK", .value = KEY_FRAMEBACK },
-	{ .name = "KEY_FRAMEFORWARD", .value = KEY_FRAMEFORWARD },
-	{ .name = "KEY_FRONT", .value = KEY_FRONT },
-	{ .name = "KEY_FULL_SCREEN", .value = KEY_FULL_SCREEN },
-	{ .name = "KEY_G", .value = KEY_G },
-	{ .name = "KEY_GAMES", .value = KEY_GAMES },
-	{ .name = "KEY_GOTO", .value = KEY_GOTO },
-	{ .name = "KEY_GRAPHICSEDITOR", .value = KEY_GRAPHICSEDITOR },
-	{ .name = "KEY_GRAVE", .value = KEY_GRAVE },
-	{ .name = "KEY_GREEN", .value = KEY_GREEN },
-	{ .name = "KEY_H", .value = KEY_H },
-	{ .name = "KEY_HANGEUL", .value = KEY_HANGEUL },
-	{ .name = "KEY_HANJA", .value = KEY_HANJA },
-	{ .name = "KEY_HELP", .value = KEY_HELP },
-	{ .name = "KEY_HENKAN", .value = KEY_HENKAN },
-	{ .name = "KEY_HIRAGANA", .value = KEY_HIRAGANA },
-	{ .name = "KEY_HOME", .value = KEY_HOME },
-	{ .name = "KEY_HOMEPAGE", .value = KEY_HOMEPAGE },
-	{ .name = "KEY_HP", .value = KEY_HP },
-	{ .name = "KEY_I", .value = KEY_I },
-	{ .name = "KEY_IMAGES", .value = KEY_IMAGES },
-	{ .name = "KEY_INFO", .value = KEY_INFO },
-	{ .name = "KEY_INSERT", .value = KEY_INSERT },
-	{ .name = "KEY_INS_LINE", .value = KEY_INS_LINE },
-	{ .name = "KEY_ISO", .value = KEY_ISO },
-	{ .name = "KEY_J", .value = KEY_J },
-	{ .name = "KEY_JOURNAL", .value = KEY_JOURNAL },
-	{ .name = "KEY_K", .value = KEY_K },
-	{ .name = "KEY_KATAKANA", .value = KEY_KATAKANA },
-	{ .name = "KEY_KATAKANAHIRAGANA", .value = KEY_KATAKANAHIRAGANA },
-	{ .name = "KEY_KBDILLUMDOWN", .value = KEY_KBDILLUMDOWN },
-	{ .name = "KEY_KBDILLUMTOGGLE", .value = KEY_KBDILLUMTOGGLE },
-	{ .name = "KEY_KBDILLUMUP", .value = KEY_KBDILLUMUP },
-	{ .name = "KEY_KBDINPUTASSIST_ACCEPT", .value = KEY_KBDINPUTASSIST_ACCEPT },
-	{ .name = "KEY_KBDINPUTASSIST_CANCEL", .value = KEY_KBDINPUTASSIST_CANCEL },
-	{ .name = "KEY_KBDINPUTASSIST_NEXT", .value = KEY_KBDINPUTASSIST_NEXT },
-	{ .name = "KEY_KBDINPUTASSIST_NEXTGROUP", .value = KEY_KBDINPUTASSIST_NEXTGROUP },
-	{ .name = "KEY_KBDINPUTASSIST_PREV", .value = KEY_KBDINPUTASSIST_PREV },
-	{ .name = "KEY_KBDINPUTASSIST_PREVGROUP", .value = KEY_KBDINPUTASSIST_PREVGROUP },
-	{ .name = "KEY_KBD_LAYOUT_NEXT", .value = KEY_KBD_LAYOUT_NEXT },
-	{ .name = "KEY_KEYBOARD", .value = KEY_KEYBOARD },
-	{ .name = "KEY_KP0", .value = KEY_KP0 },
-	{ .name = "KEY_KP1", .value = KEY_KP1 },
-	{ .name = "KEY_KP2", .value = KEY_KP2 },
-	{ .name = "KEY_KP3", .value = KEY_KP3 },
-	{ .name = "KEY_KP4", .value = KEY_KP4 },
-	{ .name = "KEY_KP5", .value = KEY_KP5 },
-	{ .name = "KEY_KP6", .value = KEY_KP6 },
-	{ .name = "KEY_KP7", .value = KEY_KP7 },
-	{ .name = "KEY_KP8", .value = KEY_KP8 },
-	{ .name = "KEY_KP9", .value = KEY_KP9 },
-	{ .name = "KEY_KPASTERISK", .value = KEY_KPASTERISK },
-	{ .name = "KEY_KPCOMMA", .value = KEY_KPCOMMA },
-	{ .name = "KEY_KPDOT", .value = KEY_KPDOT },
-	{ .name = "KEY_KPENTER", .value = KEY_KPENTER },
-	{ .name = "KEY_KPEQUAL", .value = KEY_KPEQUAL },
-	{ .name = "KEY_KPJPCOMMA", .value = KEY_KPJPCOMMA },
-	{ .name = "KEY_KPLEFTPAREN", .value = KEY_KPLEFTPAREN },
-	{ .name = "KEY_KPMINUS", .value = KEY_KPMINUS },
-	{ .name = "KEY_KPPLUS", .value = KEY_KPPLUS },
-	{ .name = "KEY_KPPLUSMINUS", .value = KEY_KPPLUSMINUS },
-	{ .name = "KEY_KPRIGHTPAREN", .value = KEY_KPRIGHTPAREN },
-	{ .name = "KEY_KPSLASH", .value = KEY_KPSLASH },
-	{ .name = "KEY_L", .value = KEY_L },
-	{ .name = "KEY_LANGUAGE", .value = KEY_LANGUAGE },
-	{ .name = "KEY_LAST", .value = KEY_LAST },
-	{ .name = "KEY_LEFT", .value = KEY_LEFT },
-	{ .name = "KEY_LEFTALT", .value = KEY_LEFTALT },
-	{ .name = "KEY_LEFTBRACE", .value = KEY_LEFTBRACE },
-	{ .name = "KEY_LEFTCTRL", .value = KEY_LEFTCTRL },
-	{ .name = "KEY_LEFTMETA", .value = KEY_LEFTMETA },
-	{ .name = "KEY_LEFTSHIFT", .value = KEY_LEFTSHIFT },
-	{ .name = "KEY_LEFT_DOWN", .value = KEY_LEFT_DOWN },
-	{ .name = "KEY_LEFT_UP", .value = KEY_LEFT_UP },
-	{ .name = "KEY_LIGHTS_TOGGLE", .value = KEY_LIGHTS_TOGGLE },
-	{ .name = "KEY_LINEFEED", .value = KEY_LINEFEED },
-	{ .name = "KEY_LIST", .value = KEY_LIST },
-	{ .name = "KEY_LOGOFF", .value = KEY_LOGOFF },
-	{ .name = "KEY_M", .value = KEY_M },
-	{ .name = "KEY_MACRO", .value = KEY_MACRO },
-	{ .name = "KEY_MAIL", .value = KEY_MAIL },
-	{ .name = "KEY_MAX", .value = KEY_MAX },
-	{ .name = "KEY_MEDIA", .value = KEY_MEDIA },
-	{ .name = "KEY_MEDIA_REPEAT", .value = KEY_MEDIA_REPEAT },
-	{ .name = "KEY_MEDIA_TOP_MENU", .value = KEY_MEDIA_TOP_MENU },
-	{ .name = "KEY_MEMO", .value = KEY_MEMO },
-	{ .name = "KEY_MENU", .value = KEY_MENU },
-	{ .name = "KEY_MESSENGER", .value = KEY_MESSENGER },
-	{ .name = "KEY_MHP", .value = KEY_MHP },
-	{ .name = "KEY_MICMUTE", .value = KEY_MICMUTE },
-	{ .name = "KEY_MINUS", .value = KEY_MINUS },
-	{ .name = "KEY_MODE", .value = KEY_MODE },
-	{ .name = "KEY_MOVE", .value = KEY_MOVE },
-	{ .name = "KEY_MP3", .value = KEY_MP3 },
-	{ .name = "KEY_MSDOS", .value = KEY_MSDOS },
-	{ .name = "KEY_MUHENKAN", .value = KEY_MUHENKAN },
-	{ .name = "KEY_MUTE", .value = KEY_MUTE },
-	{ .name = "KEY_N", .value = KEY_N },
-	{ .name = "KEY_NEW", .value = KEY_NEW },
-	{ .name = "KEY_NEWS", .value = KEY_NEWS },
-	{ .name = "KEY_NEXT", .value = KEY_NEXT },
-	{ .name = "KEY_NEXTSONG", .value = KEY_NEXTSONG },
-	{ .name = "KEY_NEXT_FAVORITE", .value = KEY_NEXT_FAVORITE },
-	{ .name = "KEY_NUMERIC_0", .value = KEY_NUMERIC_0 },
-	{ .name = "KEY_NUMERIC_1", .value = KEY_NUMERIC_1 },
-	{ .name = "KEY_NUMERIC_11", .value = KEY_NUMERIC_11 },
-	{ .name = "KEY_NUMERIC_12", .value = KEY_NUMERIC_12 },
-	{ .name = "KEY_NUMERIC_2", .value = KEY_NUMERIC_2 },
-	{ .name = "KEY_NUMERIC_3", .value = KEY_NUMERIC_3 },
-	{ .name = "KEY_NUMERIC_4", .value = KEY_NUMERIC_4 },
-	{ .name = "KEY_NUMERIC_5", .value = KEY_NUMERIC_5 },
-	{ .name = "KEY_NUMERIC_6", .value = KEY_NUMERIC_6 },
-	{ .name = "KEY_NUMERIC_7", .value = KEY_NUMERIC_7 },
-	{ .name = "KEY_NUMERIC_8", .value = KEY_NUMERIC_8 },
-	{ .name = "KEY_NUMERIC_9", .value = KEY_NUMERIC_9 },
-	{ .name = "KEY_NUMERIC_A", .value = KEY_NUMERIC_A },
-	{ .name = "KEY_NUMERIC_B", .value = KEY_NUMERIC_B },
-	{ .name = "KEY_NUMERIC_C", .value = KEY_NUMERIC_C },
-	{ .name = "KEY_NUMERIC_D", .value = KEY_NUMERIC_D },
-	{ .name = "KEY_NUMERIC_POUND", .value = KEY_NUMERIC_POUND },
-	{ .name = "KEY_NUMERIC_STAR", .value = KEY_NUMERIC_STAR },
-	{ .name = "KEY_NUMLOCK", .value = KEY_NUMLOCK },
-	{ .name = "KEY_O", .value = KEY_O },
-	{ .name = "KEY_OK", .value = KEY_OK },
-	{ .name = "KEY_ONSCREEN_KEYBOARD", .value = KEY_ONSCREEN_KEYBOARD },
-	{ .name = "KEY_OPEN", .value = KEY_OPEN },
-	{ .name = "KEY_OPTION", .value = KEY_OPTION },
-	{ .name = "KEY_P", .value = KEY_P },
-	{ .name = "KEY_PAGEDOWN", .value = KEY_PAGEDOWN },
-	{ .name = "KEY_PAGEUP", .value = KEY_PAGEUP },
-	{ .name = "KEY_PASTE", .value = KEY_PASTE },
-	{ .name = "KEY_PAUSE", .value = KEY_PAUSE },
-	{ .name = "KEY_PAUSECD", .value = KEY_PAUSECD },
-	{ .name = "KEY_PAUSE_RECORD", .value = KEY_PAUSE_RECORD },
-	{ .name = "KEY_PC", .value = KEY_PC },
-	{ .name = "KEY_PHONE", .value = KEY_PHONE },
-	{ .name = "KEY_PLAY", .value = KEY_PLAY },
-	{ .name = "KEY_PLAYCD", .value = KEY_PLAYCD },
-	{ .name = "KEY_PLAYER", .value = KEY_PLAYER },
-	{ .name = "KEY_PLAYPAUSE", .value = KEY_PLAYPAUSE },
-	{ .name = "KEY_POWER", .value = KEY_POWER },
-	{ .name = "KEY_POWER2", .value = KEY_POWER2 },
-	{ .name = "KEY_PRESENTATION", .value = KEY_PRESENTATION },
-	{ .name = "KEY_PREVIOUS", .value = KEY_PREVIOUS },
-	{ .name = "KEY_PREVIOUSSONG", .value = KEY_PREVIOUSSONG },
-	{ .name = "KEY_PRINT", .value = KEY_PRINT },
-	{ .name = "KEY_PROG1", .value = KEY_PROG1 },
-	{ .name = "KEY_PROG2", .value = KEY_PROG2 },
-	{ .name = "KEY_PROG3", .value = KEY_PROG3 },
-	{ .name = "KEY_PROG4", .value = KEY_PROG4 },
-	{ .name = "KEY_PROGRAM", .value = KEY_PROGRAM },
-	{ .name = "KEY_PROPS", .value = KEY_PROPS },
-	{ .name = "KEY_PVR", .value = KEY_PVR },
-	{ .name = "KEY_Q", .value = KEY_Q },
-	{ .name = "KEY_QUESTION", .value = KEY_QUESTION },
-	{ .name = "KEY_R", .value = KEY_R },
-	{ .name = "KEY_RADIO", .value = KEY_RADIO },
-	{ .name = "KEY_RECORD", .value = KEY_RECORD },
-	{ .name = "KEY_RED", .value = KEY_RED },
-	{ .name = "KEY_REDO", .value = KEY_REDO },
-	{ .name = "KEY_REFRESH", .value = KEY_REFRESH },
-	{ .name = "KEY_REPLY", .value = KEY_REPLY },
-	{ .name = "KEY_RESERVED", .value = KEY_RESERVED },
-	{ .name = "KEY_RESTART", .value = KEY_RESTART },
-	{ .name = "KEY_REWIND", .value = KEY_REWIND },
-	{ .name = "KEY_RFKILL", .value = KEY_RFKILL },
-	{ .name = "KEY_RIGHT", .value = KEY_RIGHT },
-	{ .name = "KEY_RIGHTALT", .value = KEY_RIGHTALT },
-	{ .name = "KEY_RIGHTBRACE", .value = KEY_RIGHTBRACE },
-	{ .name = "KEY_RIGHTCTRL", .value = KEY_RIGHTCTRL },
-	{ .name = "KEY_RIGHTMETA", .value = KEY_RIGHTMETA },
-	{ .name = "KEY_RIGHTSHIFT", .value = KEY_RIGHTSHIFT },
-	{ .name = "KEY_RIGHT_DOWN", .value = KEY_RIGHT_DOWN },
-	{ .name = "KEY_RIGHT_UP", .value = KEY_RIGHT_UP },
-	{ .name = "KEY_RO", .value = KEY_RO },
-	{ .name = "KEY_ROOT_MENU", .value = KEY_ROOT_MENU },
-	{ .name = "KEY_ROTATE_DISPLAY", .value = KEY_ROTATE_DISPLAY },
-	{ .name = "KEY_ROTATE_LOCK_TOGGLE", .value = KEY_ROTATE_LOCK_TOGGLE },
-	{ .name = "KEY_S", .value = KEY_S },
-	{ .name = "KEY_SAT", .value = KEY_SAT },
-	{ .name = "KEY_SAT2", .value = KEY_SAT2 },
-	{ .name = "KEY_SAVE", .value = KEY_SAVE },
-	{ .name = "KEY_SCALE", .value = KEY_SCALE },
-	{ .name = "KEY_SCREENSAVER", .value = KEY_SCREENSAVER },
-	{ .name = "KEY_SCROLLDOWN", .value = KEY_SCROLLDOWN },
-	{ .name = "KEY_SCROLLLOCK", .value = KEY_SCROLLLOCK },
-	{ .name = "KEY_SCROLLUP", .value = KEY_SCROLLUP },
-	{ .name = "KEY_SEARCH", .value = KEY_SEARCH },
-	{ .name = "KEY_SELECT", .value = KEY_SELECT },
-	{ .name = "KEY_SEMICOLON", .value = KEY_SEMICOLON },
-	{ .name = "KEY_SEND", .value = KEY_SEND },
-	{ .name = "KEY_SENDFILE", .value = KEY_SENDFILE },
-	{ .name = "KEY_SETUP", .value = KEY_SETUP },
-	{ .name = "KEY_SHOP", .value = KEY_SHOP },
-	{ .name = "KEY_SHUFFLE", .value = KEY_SHUFFLE },
-	{ .name = "KEY_SLASH", .value = KEY_SLASH },
-	{ .name = "KEY_SLEEP", .value = KEY_SLEEP },
-	{ .name = "KEY_SLOW", .value = KEY_SLOW },
-	{ .name = "KEY_SLOWREVERSE", .value = KEY_SLOWREVERSE },
-	{ .name = "KEY_SOUND", .value = KEY_SOUND },
-	{ .name = "KEY_SPACE", .value = KEY_SPACE },
-	{ .name = "KEY_SPELLCHECK", .value = KEY_SPELLCHECK },
-	{ .name = "KEY_SPORT", .value = KEY_SPORT },
-	{ .name = "KEY_SPREADSHEET", .value = KEY_SPREADSHEET },
-	{ .name = "KEY_STOP", .value = KEY_STOP },
-	{ .name = "KEY_STOPCD", .value = KEY_STOPCD },
-	{ .name = "KEY_STOP_RECORD", .value = KEY_STOP_RECORD },
-	{ .name = "KEY_SUBTITLE", .value = KEY_SUBTITLE },
-	{ .name = "KEY_SUSPEND", .value = KEY_SUSPEND },
-	{ .name = "KEY_SWITCHVIDEOMODE", .value = KEY_SWITCHVIDEOMODE },
-	{ .name = "KEY_SYSRQ", .value = KEY_SYSRQ },
-	{ .name = "KEY_T", .value = KEY_T },
-	{ .name = "KEY_TAB", .value = KEY_TAB },
-	{ .name = "KEY_TAPE", .value = KEY_TAPE },
-	{ .name = "KEY_TASKMANAGER", .value = KEY_TASKMANAGER },
-	{ .name = "KEY_TEEN", .value = KEY_TEEN },
-	{ .name = "KEY_TEXT", .value = KEY_TEXT },
-	{ .name = "KEY_TIME", .value = KEY_TIME },
-	{ .name = "KEY_TITLE", .value = KEY_TITLE },
-	{ .name = "KEY_TOUCHPAD_OFF", .value = KEY_TOUCHPAD_OFF },
-	{ .name = "KEY_TOUCHPAD_ON", .value = KEY_TOUCHPAD_ON },
-	{ .name = "KEY_TOUCHPAD_TOGGLE", .value = KEY_TOUCHPAD_TOGGLE },
-	{ .name = "KEY_TUNER", .value = KEY_TUNER },
-	{ .name = "KEY_TV", .value = KEY_TV },
-	{ .name = "KEY_TV2", .value = KEY_TV2 },
-	{ .name = "KEY_TWEN", .value = KEY_TWEN },
-	{ .name = "KEY_U", .value = KEY_U },
-	{ .name = "KEY_UNDO", .value = KEY_UNDO },
-	{ .name = "KEY_UNKNOWN", .value = KEY_UNKNOWN },
-	{ .name = "KEY_UNMUTE", .value = KEY_UNMUTE },
-	{ .name = "KEY_UP", .value = KEY_UP },
-	{ .name = "KEY_UWB", .value = KEY_UWB },
-	{ .name = "KEY_V", .value = KEY_V },
-	{ .name = "KEY_VCR", .value = KEY_VCR },
-	{ .name = "KEY_VCR2", .value = KEY_VCR2 },
-	{ .name = "KEY_VENDOR", .value = KEY_VENDOR },
-	{ .name = "KEY_VIDEO", .value = KEY_VIDEO },
-	{ .name = "KEY_VIDEOPHONE", .value = KEY_VIDEOPHONE },
-	{ .name = "KEY_VIDEO_NEXT", .value = KEY_VIDEO_NEXT },
-	{ .name = "KEY_VIDEO_PREV", .value = KEY_VIDEO_PREV },
-	{ .name = "KEY_VOD", .value = KEY_VOD },
-	{ .name = "KEY_VOICECOMMAND", .value = KEY_VOICECOMMAND },
-	{ .name = "KEY_VOICEMAIL", .value = KEY_VOICEMAIL },
-	{ .name = "KEY_VOLUMEDOWN", .value = KEY_VOLUMEDOWN },
-	{ .name = "KEY_VOLUMEUP", .value = KEY_VOLUMEUP },
-	{ .name = "KEY_W", .value = KEY_W },
-	{ .name = "KEY_WAKEUP", .value = KEY_WAKEUP },
-	{ .name = "KEY_WLAN", .value = KEY_WLAN },
-	{ .name = "KEY_WORDPROCESSOR", .value = KEY_WORDPROCESSOR },
-	{ .name = "KEY_WPS_BUTTON", .value = KEY_WPS_BUTTON },
-	{ .name = "KEY_WWAN", .value = KEY_WWAN },
-	{ .name = "KEY_WWW", .value = KEY_WWW },
-	{ .name = "KEY_X", .value = KEY_X },
-	{ .name = "KEY_XFER", .value = KEY_XFER },
-	{ .name = "KEY_Y", .value = KEY_Y },
-	{ .name = "KEY_YELLOW", .value = KEY_YELLOW },
-	{ .name = "KEY_YEN", .value = KEY_YEN },
-	{ .name = "KEY_Z", .value = KEY_Z },
-	{ .name = "KEY_ZENKAKUHANKAKU", .value = KEY_ZENKAKUHANKAKU },
-	{ .name = "KEY_ZOOMIN", .value = KEY_ZOOMIN },
-	{ .name = "KEY_ZOOMOUT", .value = KEY_ZOOMOUT },
-	{ .name = "KEY_ZOOMRESET", .value = KEY_ZOOMRESET },
-	{ .name = "LED_CAPSL", .value = LED_CAPSL },
-	{ .name = "LED_CHARGING", .value = LED_CHARGING },
-	{ .name = "LED_COMPOSE", .value = LED_COMPOSE },
-	{ .name = "LED_KANA", .value = LED_KANA },
-	{ .name = "LED_MAIL", .value = LED_MAIL },
-	{ .name = "LED_MAX", .value = LED_MAX },
-	{ .name = "LED_MISC", .value = LED_MISC },
-	{ .name = "LED_MUTE", .value = LED_MUTE },
-	{ .name = "LED_NUML", .value = LED_NUML },
-	{ .name = "LED_SCROLLL", .value = LED_SCROLLL },
-	{ .name = "LED_SLEEP", .value = LED_SLEEP },
-	{ .name = "LED_SUSPEND", .value = LED_SUSPEND },
-	{ .name = "MSC_GESTURE", .value = MSC_GESTURE },
-	{ .name = "MSC_MAX", .value = MSC_MAX },
-	{ .name = "MSC_PULSELED", .value = MSC_PULSELED },
-	{ .name = "MSC_RAW", .value = MSC_RAW },
-	{ .name = "MSC_SCAN", .value = MSC_SCAN },
-	{ .name = "MSC_SERIAL", .value = MSC_SERIAL },
-	{ .name = "MSC_TIMESTAMP", .value = MSC_TIMESTAMP },
-	{ .name = "REL_DIAL", .value = REL_DIAL },
-	{ .name = "REL_HWHEEL", .value = REL_HWHEEL },
-	{ .name = "REL_HWHEEL_HI_RES", .value = REL_HWHEEL_HI_RES },
-	{ .name = "REL_MAX", .value = REL_MAX },
-	{ .name = "REL_MISC", .value = REL_MISC },
-	{ .name = "REL_RESERVED", .value = REL_RESERVED },
-	{ .name = "REL_RX", .value = REL_RX },
-	{ .name = "REL_RY", .value = REL_RY },
-	{ .name = "REL_RZ", .value = REL_RZ },
-	{ .name = "REL_WHEEL", .value = REL_WHEEL },
-	{ .name = "REL_WHEEL_HI_RES", .value = REL_WHEEL_HI_RES },
-	{ .name = "REL_X", .value = REL_X },
-	{ .name = "REL_Y", .value = REL_Y },
-	{ .name = "REL_Z", .value = REL_Z },
-	{ .name = "REP_DELAY", .value = REP_DELAY },
-	{ .name = "REP_MAX", .value = REP_MAX },
-	{ .name = "REP_PERIOD", .value = REP_PERIOD },
-	{ .name = "SND_BELL", .value = SND_BELL },
-	{ .name = "SND_CLICK", .value = SND_CLICK },
-	{ .name = "SND_MAX", .value = SND_MAX },
-	{ .name = "SND_TONE", .value = SND_TONE },
-	{ .name = "SW_CAMERA_LENS_COVER", .value = SW_CAMERA_LENS_COVER },
-	{ .name = "SW_DOCK", .value = SW_DOCK },
-	{ .name = "SW_FRONT_PROXIMITY", .value = SW_FRONT_PROXIMITY },
-	{ .name = "SW_HEADPHONE_INSERT", .value = SW_HEADPHONE_INSERT },
-	{ .name = "SW_JACK_PHYSICAL_INSERT", .value = SW_JACK_PHYSICAL_INSERT },
-	{ .name = "SW_KEYPAD_SLIDE", .value = SW_KEYPAD_SLIDE },
-	{ .name = "SW_LID", .value = SW_LID },
-	{ .name = "SW_LINEIN_INSERT", .value = SW_LINEIN_INSERT },
-	{ .name = "SW_LINEOUT_INSERT", .value = SW_LINEOUT_INSERT },
-	{ .name = "SW_MAX", .value = SW_MAX },
-	{ .name = "SW_MICROPHONE_INSERT", .value = SW_MICROPHONE_INSERT },
-	{ .name = "SW_MUTE_DEVICE", .value = SW_MUTE_DEVICE },
-	{ .name = "SW_PEN_INSERTED", .value = SW_PEN_INSERTED },
-	{ .name = "SW_RFKILL_ALL", .value = SW_RFKILL_ALL },
-	{ .name = "SW_ROTATE_LOCK", .value = SW_ROTATE_LOCK },
-	{ .name = "SW_TABLET_MODE", .value = SW_TABLET_MODE },
-	{ .name = "SW_VIDEOOUT_INSERT", .value = SW_VIDEOOUT_INSERT },
-	{ .name = "SYN_CONFIG", .value = SYN_CONFIG },
-	{ .name = "SYN_DROPPED", .value = SYN_DROPPED },
-	{ .name = "SYN_MAX", .value = SYN_MAX },
-	{ .name = "SYN_MT_REPORT", .value = SYN_MT_REPORT },
-	{ .name = "SYN_REPORT", .value = SYN_REPORT },
+	{ .name = 594, .len = 9, .value = ABS_BRAKE },
+	{ .name = 707, .len = 12, .value = ABS_DISTANCE },
+	{ .name = 585, .len = 7, .value = ABS_GAS },
+	{ .name = 605, .len = 9, .value = ABS_HAT0X },
+	{ .name = 616, .len = 9, .value = ABS_HAT0Y },
+	{ .name = 627, .len = 9, .value = ABS_HAT1X },
+	{ .name = 638, .len = 9, .value = ABS_HAT1Y },
+	{ .name = 649, .len = 9, .value = ABS_HAT2X },
+	{ .name = 660, .len = 9, .value = ABS_HAT2Y },
+	{ .name = 671, .len = 9, .value = ABS_HAT3X },
+	{ .name = 682, .len = 9, .value = ABS_HAT3Y },
+	{ .name = 1079, .len = 7, .value = ABS_MAX },
+	{ .name = 786, .len = 8, .value = ABS_MISC },
+	{ .name = 979, .len = 14, .value = ABS_MT_BLOB_ID },
+	{ .name = 1032, .len = 15, .value = ABS_MT_DISTANCE },
+	{ .name = 903, .len = 18, .value = ABS_MT_ORIENTATION },
+	{ .name = 923, .len = 17, .value = ABS_MT_POSITION_X },
+	{ .name = 942, .len = 17, .value = ABS_MT_POSITION_Y },
+	{ .name = 1015, .len = 15, .value = ABS_MT_PRESSURE },
+	{ .name = 810, .len = 11, .value = ABS_MT_SLOT },
+	{ .name = 961, .len = 16, .value = ABS_MT_TOOL_TYPE },
+	{ .name = 1049, .len = 13, .value = ABS_MT_TOOL_X },
+	{ .name = 1064, .len = 13, .value = ABS_MT_TOOL_Y },
+	{ .name = 823, .len = 18, .value = ABS_MT_TOUCH_MAJOR },
+	{ .name = 843, .len = 18, .value = ABS_MT_TOUCH_MINOR },
+	{ .name = 995, .len = 18, .value = ABS_MT_TRACKING_ID },
+	{ .name = 863, .len = 18, .value = ABS_MT_WIDTH_MAJOR },
+	{ .name = 883, .len = 18, .value = ABS_MT_WIDTH_MINOR },
+	{ .name = 693, .len = 12, .value = ABS_PRESSURE },
+	{ .name = 773, .len = 11, .value = ABS_PROFILE },
+	{ .name = 796, .len = 12, .value = ABS_RESERVED },
+	{ .name = 562, .len = 10, .value = ABS_RUDDER },
+	{ .name = 524, .len = 6, .value = ABS_RX },
+	{ .name = 532, .len = 6, .value = ABS_RY },
+	{ .name = 540, .len = 6, .value = ABS_RZ },
+	{ .name = 548, .len = 12, .value = ABS_THROTTLE },
+	{ .name = 721, .len = 10, .value = ABS_TILT_X },
+	{ .name = 733, .len = 10, .value = ABS_TILT_Y },
+	{ .name = 745, .len = 14, .value = ABS_TOOL_WIDTH },
+	{ .name = 761, .len = 10, .value = ABS_VOLUME },
+	{ .name = 574, .len = 9, .value = ABS_WHEEL },
+	{ .name = 503, .len = 5, .value = ABS_X },
+	{ .name = 510, .len = 5, .value = ABS_Y },
+	{ .name = 517, .len = 5, .value = ABS_Z },
+	{ .name = 3862, .len = 5, .value = BTN_0 },
+	{ .name = 3869, .len = 5, .value = BTN_1 },
+	{ .name = 3876, .len = 5, .value = BTN_2 },
+	{ .name = 3883, .len = 5, .value = BTN_3 },
+	{ .name = 3890, .len = 5, .value = BTN_4 },
+	{ .name = 3897, .len = 5, .value = BTN_5 },
+	{ .name = 3904, .len = 5, .value = BTN_6 },
+	{ .name = 3911, .len = 5, .value = BTN_7 },
+	{ .name = 3918, .len = 5, .value = BTN_8 },
+	{ .name = 3925, .len = 5, .value = BTN_9 },
+	{ .name = 10258, .len = 5, .value = BTN_A },
+	{ .name = 10265, .len = 5, .value = BTN_B },
+	{ .name = 3999, .len = 8, .value = BTN_BACK },
+	{ .name = 4086, .len = 8, .value = BTN_BASE },
+	{ .name = 4096, .len = 9, .value = BTN_BASE2 },
+	{ .name = 4107, .len = 9, .value = BTN_BASE3 },
+	{ .name = 4118, .len = 9, .value = BTN_BASE4 },
+	{ .name = 4129, .len = 9, .value = BTN_BASE5 },
+	{ .name = 4140, .len = 9, .value = BTN_BASE6 },
+	{ .name = 4182, .len = 5, .value = BTN_C },
+	{ .name = 4151, .len = 8, .value = BTN_DEAD },
+	{ .name = 6756, .len = 13, .value = BTN_DPAD_DOWN },
+	{ .name = 6771, .len = 13, .value = BTN_DPAD_LEFT },
+	{ .name = 6786, .len = 14, .value = BTN_DPAD_RIGHT },
+	{ .name = 6743, .len = 11, .value = BTN_DPAD_UP },
+	{ .name = 4172, .len = 8, .value = BTN_EAST },
+	{ .name = 3975, .len = 9, .value = BTN_EXTRA },
+	{ .name = 3986, .len = 11, .value = BTN_FORWARD },
+	{ .name = 4565, .len = 13, .value = BTN_GEAR_DOWN },
+	{ .name = 4580, .len = 11, .value = BTN_GEAR_UP },
+	{ .name = 3932, .len = 8, .value = BTN_LEFT },
+	{ .name = 3953, .len = 10, .value = BTN_MIDDLE },
+	{ .name = 4274, .len = 8, .value = BTN_MODE },
+	{ .name = 4189, .len = 9, .value = BTN_NORTH },
+	{ .name = 4074, .len = 10, .value = BTN_PINKIE },
+	{ .name = 3942, .len = 9, .value = BTN_RIGHT },
+	{ .name = 4251, .len = 10, .value = BTN_SELECT },
+	{ .name = 3965, .len = 8, .value = BTN_SIDE },
+	{ .name = 4161, .len = 9, .value = BTN_SOUTH },
+	{ .name = 4263, .len = 9, .value = BTN_START },
+	{ .name = 4482, .len = 10, .value = BTN_STYLUS },
+	{ .name = 4494, .len = 11, .value = BTN_STYLUS2 },
+	{ .name = 4458, .len = 11, .value = BTN_STYLUS3 },
+	{ .name = 4009, .len = 8, .value = BTN_TASK },
+	{ .name = 4032, .len = 9, .value = BTN_THUMB },
+	{ .name = 4043, .len = 10, .value = BTN_THUMB2 },
+	{ .name = 4284, .len = 10, .value = BTN_THUMBL },
+	{ .name = 4296, .len = 10, .value = BTN_THUMBR },
+	{ .name = 4217, .len = 6, .value = BTN_TL },
+	{ .name = 4233, .len = 7, .value = BTN_TL2 },
+	{ .name = 4372, .len = 17, .value = BTN_TOOL_AIRBRUSH },
+	{ .name = 4339, .len = 14, .value = BTN_TOOL_BRUSH },
+	{ .name = 4507, .len = 18, .value = BTN_TOOL_DOUBLETAP },
+	{ .name = 4391, .len = 15, .value = BTN_TOOL_FINGER },
+	{ .name = 4424, .len = 13, .value = BTN_TOOL_LENS },
+	{ .name = 4408, .len = 14, .value = BTN_TOOL_MOUSE },
+	{ .name = 4308, .len = 12, .value = BTN_TOOL_PEN },
+	{ .name = 4355, .len = 15, .value = BTN_TOOL_PENCIL },
+	{ .name = 4547, .len = 16, .value = BTN_TOOL_QUADTAP },
+	{ .name = 4439, .len = 17, .value = BTN_TOOL_QUINTTAP },
+	{ .name = 4322, .len = 15, .value = BTN_TOOL_RUBBER },
+	{ .name = 4527, .len = 18, .value = BTN_TOOL_TRIPLETAP },
+	{ .name = 4055, .len = 7, .value = BTN_TOP },
+	{ .name = 4064, .len = 8, .value = BTN_TOP2 },
+	{ .name = 4471, .len = 9, .value = BTN_TOUCH },
+	{ .name = 4225, .len = 6, .value = BTN_TR },
+	{ .name = 4242, .len = 7, .value = BTN_TR2 },
+	{ .name = 4019, .len = 11, .value = BTN_TRIGGER },
+	{ .name = 8552, .len = 18, .value = BTN_TRIGGER_HAPPY1 },
+	{ .name = 8732, .len = 19, .value = BTN_TRIGGER_HAPPY10 },
+	{ .name = 8753, .len = 19, .value = BTN_TRIGGER_HAPPY11 },
+	{ .name = 8774, .len = 19, .value = BTN_TRIGGER_HAPPY12 },
+	{ .name = 8795, .len = 19, .value = BTN_TRIGGER_HAPPY13 },
+	{ .name = 8816, .len = 19, .value = BTN_TRIGGER_HAPPY14 },
+	{ .name = 8837, .len = 19, .value = BTN_TRIGGER_HAPPY15 },
+	{ .name = 8858, .len = 19, .value = BTN_TRIGGER_HAPPY16 },
+	{ .name = 8879, .len = 19, .value = BTN_TRIGGER_HAPPY17 },
+	{ .name = 8900, .len = 19, .value = BTN_TRIGGER_HAPPY18 },
+	{ .name = 8921, .len = 19, .value = BTN_TRIGGER_HAPPY19 },
+	{ .name = 8572, .len = 18, .value = BTN_TRIGGER_HAPPY2 },
+	{ .name = 8942, .len = 19, .value = BTN_TRIGGER_HAPPY20 },
+	{ .name = 8963, .len = 19, .value = BTN_TRIGGER_HAPPY21 },
+	{ .name = 8984, .len = 19, .value = BTN_TRIGGER_HAPPY22 },
+	{ .name = 9005, .len = 19, .value = BTN_TRIGGER_HAPPY23 },
+	{ .name = 9026, .len = 19, .value = BTN_TRIGGER_HAPPY24 },
+	{ .name = 9047, .len = 19, .value = BTN_TRIGGER_HAPPY25 },
+	{ .name = 9068, .len = 19, .value = BTN_TRIGGER_HAPPY26 },
+	{ .name = 9089, .len = 19, .value = BTN_TRIGGER_HAPPY27 },
+	{ .name = 9110, .len = 19, .value = BTN_TRIGGER_HAPPY28 },
+	{ .name = 9131, .len = 19, .value = BTN_TRIGGER_HAPPY29 },
+	{ .name = 8592, .len = 18, .value = BTN_TRIGGER_HAPPY3 },
+	{ .name = 9152, .len = 19, .value = BTN_TRIGGER_HAPPY30 },
+	{ .name = 9173, .len = 19, .value = BTN_TRIGGER_HAPPY31 },
+	{ .name = 9194, .len = 19, .value = BTN_TRIGGER_HAPPY32 },
+	{ .name = 9215, .len = 19, .value = BTN_TRIGGER_HAPPY33 },
+	{ .name = 9236, .len = 19, .value = BTN_TRIGGER_HAPPY34 },
+	{ .name = 9257, .len = 19, .value = BTN_TRIGGER_HAPPY35 },
+	{ .name = 9278, .len = 19, .value = BTN_TRIGGER_HAPPY36 },
+	{ .name = 9299, .len = 19, .value = BTN_TRIGGER_HAPPY37 },
+	{ .name = 9320, .len = 19, .value = BTN_TRIGGER_HAPPY38 },
+	{ .name = 9341, .len = 19, .value = BTN_TRIGGER_HAPPY39 },
+	{ .name = 8612, .len = 18, .value = BTN_TRIGGER_HAPPY4 },
+	{ .name = 9362, .len = 19, .value = BTN_TRIGGER_HAPPY40 },
+	{ .name = 8632, .len = 18, .value = BTN_TRIGGER_HAPPY5 },
+	{ .name = 8652, .len = 18, .value = BTN_TRIGGER_HAPPY6 },
+	{ .name = 8672, .len = 18, .value = BTN_TRIGGER_HAPPY7 },
+	{ .name = 8692, .len = 18, .value = BTN_TRIGGER_HAPPY8 },
+	{ .name = 8712, .len = 18, .value = BTN_TRIGGER_HAPPY9 },
+	{ .name = 4200, .len = 8, .value = BTN_WEST },
+	{ .name = 10272, .len = 5, .value = BTN_X },
+	{ .name = 10279, .len = 5, .value = BTN_Y },
+	{ .name = 4210, .len = 5, .value = BTN_Z },
+	{ .name = 10151, .len = 13, .value = FF_AUTOCENTER },
+	{ .name = 10005, .len = 11, .value = FF_CONSTANT },
+	{ .name = 10131, .len = 9, .value = FF_CUSTOM },
+	{ .name = 10042, .len = 9, .value = FF_DAMPER },
+	{ .name = 10029, .len = 11, .value = FF_FRICTION },
+	{ .name = 10142, .len = 7, .value = FF_GAIN },
+	{ .name = 10053, .len = 10, .value = FF_INERTIA },
+	{ .name = 10166, .len = 6, .value = FF_MAX },
+	{ .name = 9992, .len = 11, .value = FF_PERIODIC },
+	{ .name = 10065, .len = 7, .value = FF_RAMP },
+	{ .name = 9981, .len = 9, .value = FF_RUMBLE },
+	{ .name = 10118, .len = 11, .value = FF_SAW_DOWN },
+	{ .name = 10107, .len = 9, .value = FF_SAW_UP },
+	{ .name = 10098, .len = 7, .value = FF_SINE },
+	{ .name = 10018, .len = 9, .value = FF_SPRING },
+	{ .name = 10074, .len = 9, .value = FF_SQUARE },
+	{ .name = 9966, .len = 13, .value = FF_STATUS_MAX },
+	{ .name = 9947, .len = 17, .value = FF_STATUS_STOPPED },
+	{ .name = 10085, .len = 11, .value = FF_TRIANGLE },
+	{ .name = 1174, .len = 5, .value = KEY_0 },
+	{ .name = 1111, .len = 5, .value = KEY_1 },
+	{ .name = 1894, .len = 9, .value = KEY_102ND },
+	{ .name = 5689, .len = 18, .value = KEY_10CHANNELSDOWN },
+	{ .name = 5671, .len = 16, .value = KEY_10CHANNELSUP },
+	{ .name = 1118, .len = 5, .value = KEY_2 },
+	{ .name = 1125, .len = 5, .value = KEY_3 },
+	{ .name = 7449, .len = 11, .value = KEY_3D_MODE },
+	{ .name = 1132, .len = 5, .value = KEY_4 },
+	{ .name = 1139, .len = 5, .value = KEY_5 },
+	{ .name = 1146, .len = 5, .value = KEY_6 },
+	{ .name = 1153, .len = 5, .value = KEY_7 },
+	{ .name = 1160, .len = 5, .value = KEY_8 },
+	{ .name = 1167, .len = 5, .value = KEY_9 },
+	{ .name = 1353, .len = 5, .value = KEY_A },
+	{ .name = 5198, .len = 6, .value = KEY_AB },
+	{ .name = 5501, .len = 15, .value = KEY_ADDRESSBOOK },
+	{ .name = 2422, .len = 9, .value = KEY_AGAIN },
+	{ .name = 3238, .len = 20, .value = KEY_ALL_APPLICATIONS },
+	{ .name = 6802, .len = 14, .value = KEY_ALS_TOGGLE },
+	{ .name = 3462, .len = 12, .value = KEY_ALTERASE },
+	{ .name = 4810, .len = 9, .value = KEY_ANGLE },
+	{ .name = 1431, .len = 14, .value = KEY_APOSTROPHE },
+	{ .name = 6908, .len = 13, .value = KEY_APPSELECT },
+	{ .name = 4690, .len = 11, .value = KEY_ARCHIVE },
+	{ .name = 4862, .len = 16, .value = KEY_ASPECT_RATIO },
+	{ .name = 6958, .len = 13, .value = KEY_ASSISTANT },
+	{ .name = 6683, .len = 17, .value = KEY_ATTENDANT_OFF },
+	{ .name = 6665, .len = 16, .value = KEY_ATTENDANT_ON },
+	{ .name = 6702, .len = 20, .value = KEY_ATTENDANT_TOGGLE },
+	{ .name = 5032, .len = 9, .value = KEY_AUDIO },
+	{ .name = 7433, .len = 14, .value = KEY_AUDIO_DESC },
+	{ .name = 7697, .len = 27, .value = KEY_AUTOPILOT_ENGAGE_TOGGLE },
+	{ .name = 5014, .len = 7, .value = KEY_AUX },
+	{ .name = 1516, .len = 5, .value = KEY_B },
+	{ .name = 2760, .len = 8, .value = KEY_BACK },
+	{ .name = 1473, .len = 13, .value = KEY_BACKSLASH },
+	{ .name = 1203, .len = 13, .value = KEY_BACKSPACE },
+	{ .name = 3311, .len = 13, .value = KEY_BASSBOOST },
+	{ .name = 3675, .len = 11, .value = KEY_BATTERY },
+	{ .name = 5135, .len = 8, .value = KEY_BLUE },
+	{ .name = 3688, .len = 13, .value = KEY_BLUETOOTH },
+	{ .name = 2731, .len = 13, .value = KEY_BOOKMARKS },
+	{ .name = 5252, .len = 9, .value = KEY_BREAK },
+	{ .name = 3488, .len = 18, .value = KEY_BRIGHTNESSDOWN },
+	{ .name = 3508, .len = 16, .value = KEY_BRIGHTNESSUP },
+	{ .name = 3789, .len = 19, .value = KEY_BRIGHTNESS_AUTO },
+	{ .name = 3767, .len = 20, .value = KEY_BRIGHTNESS_CYCLE },
+	{ .name = 7124, .len = 18, .value = KEY_BRIGHTNESS_MAX },
+	{ .name = 7927, .len = 19, .value = KEY_BRIGHTNESS_MENU },
+	{ .name = 7104, .len = 18, .value = KEY_BRIGHTNESS_MIN },
+	{ .name = 6081, .len = 12, .value = KEY_BRL_DOT1 },
+	{ .name = 6207, .len = 13, .value = KEY_BRL_DOT10 },
+	{ .name = 6095, .len = 12, .value = KEY_BRL_DOT2 },
+	{ .name = 6109, .len = 12, .value = KEY_BRL_DOT3 },
+	{ .name = 6123, .len = 12, .value = KEY_BRL_DOT4 },
+	{ .name = 6137, .len = 12, .value = KEY_BRL_DOT5 },
+	{ .name = 6151, .len = 12, .value = KEY_BRL_DOT6 },
+	{ .name = 6165, .len = 12, .value = KEY_BRL_DOT7 },
+	{ .name = 6179, .len = 12, .value = KEY_BRL_DOT8 },
+	{ .name = 6193, .len = 12, .value = KEY_BRL_DOT9 },
+	{ .name = 6842, .len = 16, .value = KEY_BUTTONCONFIG },
+	{ .name = 1502, .len = 5, .value = KEY_C },
+	{ .name = 2535, .len = 8, .value = KEY_CALC },
+	{ .name = 5089, .len = 12, .value = KEY_CALENDAR },
+	{ .name = 3345, .len = 10, .value = KEY_CAMERA },
+	{ .name = 7051, .len = 25, .value = KEY_CAMERA_ACCESS_DISABLE },
+	{ .name = 7025, .len = 24, .value = KEY_CAMERA_ACCESS_ENABLE },
+	{ .name = 7078, .len = 24, .value = KEY_CAMERA_ACCESS_TOGGLE },
+	{ .name = 6613, .len = 15, .value = KEY_CAMERA_DOWN },
+	{ .name = 6469, .len = 16, .value = KEY_CAMERA_FOCUS },
+	{ .name = 6630, .len = 15, .value = KEY_CAMERA_LEFT },
+	{ .name = 6647, .len = 16, .value = KEY_CAMERA_RIGHT },
+	{ .name = 6598, .len = 13, .value = KEY_CAMERA_UP },
+	{ .name = 6559, .len = 17, .value = KEY_CAMERA_ZOOMIN },
+	{ .name = 6578, .len = 18, .value = KEY_CAMERA_ZOOMOUT },
+	{ .name = 3476, .len = 10, .value = KEY_CANCEL },
+	{ .name = 1624, .len = 12, .value = KEY_CAPSLOCK },
+	{ .name = 4943, .len = 6, .value = KEY_CD },
+	{ .name = 4716, .len = 11, .value = KEY_CHANNEL },
+	{ .name = 5160, .len = 15, .value = KEY_CHANNELDOWN },
+	{ .name = 5145, .len = 13, .value = KEY_CHANNELUP },
+	{ .name = 3393, .len = 8, .value = KEY_CHAT },
+	{ .name = 4623, .len = 9, .value = KEY_CLEAR },
+	{ .name = 7876, .len = 17, .value = KEY_CLEARVU_SONAR },
+	{ .name = 3273, .len = 9, .value = KEY_CLOSE },
+	{ .name = 2783, .len = 11, .value = KEY_CLOSECD },
+	{ .name = 2671, .len = 10, .value = KEY_COFFEE },
+	{ .name = 1537, .len = 9, .value = KEY_COMMA },
+	{ .name = 2399, .len = 11, .value = KEY_COMPOSE },
+	{ .name = 2746, .len = 12, .value = KEY_COMPUTER },
+	{ .name = 2930, .len = 10, .value = KEY_CONFIG },
+	{ .name = 3415, .len = 11, .value = KEY_CONNECT },
+	{ .name = 5635, .len = 16, .value = KEY_CONTEXT_MENU },
+	{ .name = 6890, .len = 16, .value = KEY_CONTROLPANEL },
+	{ .name = 2465, .len = 8, .value = KEY_COPY },
+	{ .name = 2506, .len = 7, .value = KEY_CUT },
+	{ .name = 2703, .len = 16, .value = KEY_CYCLEWINDOWS },
+	{ .name = 1367, .len = 5, .value = KEY_D },
+	{ .name = 7571, .len = 8, .value = KEY_DATA },
+	{ .name = 5462, .len = 12, .value = KEY_DATABASE },
+	{ .name = 2198, .len = 10, .value = KEY_DELETE },
+	{ .name = 2603, .len = 14, .value = KEY_DELETEFILE },
+	{ .name = 5782, .len = 11, .value = KEY_DEL_EOL },
+	{ .name = 5795, .len = 11, .value = KEY_DEL_EOS },
+	{ .name = 5822, .len = 12, .value = KEY_DEL_LINE },
+	{ .name = 7012, .len = 11, .value = KEY_DICTATE },
+	{ .name = 5277, .len = 10, .value = KEY_DIGITS },
+	{ .name = 5054, .len = 13, .value = KEY_DIRECTORY },
+	{ .name = 5533, .len = 17, .value = KEY_DISPLAYTOGGLE },
+	{ .name = 3810, .len = 15, .value = KEY_DISPLAY_OFF },
+	{ .name = 3660, .len = 13, .value = KEY_DOCUMENTS },
+	{ .name = 5580, .len = 10, .value = KEY_DOLLAR },
+	{ .name = 1548, .len = 7, .value = KEY_DOT },
+	{ .name = 2162, .len = 8, .value = KEY_DOWN },
+	{ .name = 7812, .len = 20, .value = KEY_DUAL_RANGE_RADAR },
+	{ .name = 5005, .len = 7, .value = KEY_DVD },
+	{ .name = 1241, .len = 5, .value = KEY_E },
+	{ .name = 2989, .len = 8, .value = KEY_EDIT },
+	{ .name = 5395, .len = 10, .value = KEY_EDITOR },
+	{ .name = 2796, .len = 11, .value = KEY_EJECTCD },
+	{ .name = 2809, .len = 16, .value = KEY_EJECTCLOSECD },
+	{ .name = 3382, .len = 9, .value = KEY_EMAIL },
+	{ .name = 6994, .len = 16, .value = KEY_EMOJI_PICKER },
+	{ .name = 2153, .len = 7, .value = KEY_END },
+	{ .name = 1328, .len = 9, .value = KEY_ENTER },
+	{ .name = 4744, .len = 7, .value = KEY_EPG },
+	{ .name = 1192, .len = 9, .value = KEY_EQUAL },
+	{ .name = 1102, .len = 7, .value = KEY_ESC },
+	{ .name = 5592, .len = 8, .value = KEY_EURO },
+	{ .name = 2969, .len = 8, .value = KEY_EXIT },
+	{ .name = 1374, .len = 5, .value = KEY_F },
+	{ .name = 1638, .len = 6, .value = KEY_F1 },
+	{ .name = 1710, .len = 7, .value = KEY_F10 },
+	{ .name = 1905, .len = 7, .value = KEY_F11 },
+	{ .name = 1914, .len = 7, .value = KEY_F12 },
+	{ .name = 3083, .len = 7, .value = KEY_F13 },
+	{ .name = 3092, .len = 7, .value = KEY_F14 },
+	{ .name = 3101, .len = 7, .value = KEY_F15 },
+	{ .name = 3110, .len = 7, .value = KEY_F16 },
+	{ .name = 3119, .len = 7, .value = KEY_F17 },
+	{ .name = 3128, .len = 7, .value = KEY_F18 },
+	{ .name = 3137, .len = 7, .value = KEY_F19 },
+	{ .name = 1646, .len = 6, .value = KEY_F2 },
+	{ .name = 3146, .len = 7, .value = KEY_F20 },
+	{ .name = 3155, .len = 7, .value = KEY_F21 },
+	{ .name = 3164, .len = 7, .value = KEY_F22 },
+	{ .name = 3173, .len = 7, .value = KEY_F23 },
+	{ .name = 3182, .len = 7, .value = KEY_F24 },
+	{ .name = 1654, .len = 6, .value = KEY_F3 },
+	{ .name = 1662, .len = 6, .value = KEY_F4 },
+	{ .name = 1670, .len = 6, .value = KEY_F5 },
+	{ .name = 1678, .len = 6, .value = KEY_F6 },
+	{ .name = 1686, .len = 6, .value = KEY_F7 },
+	{ .name = 1694, .len = 6, .value = KEY_F8 },
+	{ .name = 1702, .len = 6, .value = KEY_F9 },
+	{ .name = 3294, .len = 15, .value = KEY_FASTFORWARD },
+	{ .name = 7537, .len = 15, .value = KEY_FASTREVERSE },
+	{ .name = 4729, .len = 13, .value = KEY_FAVORITES },
+	{ .name = 2579, .len = 8, .value = KEY_FILE },
+	{ .name = 3428, .len = 11, .value = KEY_FINANCE },
+	{ .name = 2496, .len = 8, .value = KEY_FIND },
+	{ .name = 5177, .len = 9, .value = KEY_FIRST },
+	{ .name = 7769, .len = 17, .value = KEY_FISHING_CHART },
+	{ .name = 5836, .len = 6, .value = KEY_FN },
+	{ .name = 5991, .len = 8, .value = KEY_FN_1 },
+	{ .name = 6001, .len = 8, .value = KEY_FN_2 },
+	{ .name = 6051, .len = 8, .value = KEY_FN_B },
+	{ .name = 6011, .len = 8, .value = KEY_FN_D },
+	{ .name = 6021, .len = 8, .value = KEY_FN_E },
+	{ .name = 5844, .len = 10, .value = KEY_FN_ESC },
+	{ .name = 6031, .len = 8, .value = KEY_FN_F },
+	{ .name = 5856, .len = 9, .value = KEY_FN_F1 },
+	{ .name = 5955, .len = 10, .value = KEY_FN_F10 },
+	{ .name = 5967, .len = 10, .value = KEY_FN_F11 },
+	{ .name = 5979, .len = 10, .value = KEY_FN_F12 },
+	{ .name = 5867, .len = 9, .value = KEY_FN_F2 },
+	{ .name = 5878, .len = 9, .value = KEY_FN_F3 },
+	{ .name = 5889, .len = 9, .value = KEY_FN_F4 },
+	{ .name = 5900, .len = 9, .value = KEY_FN_F5 },
+	{ .name = 5911, .len = 9, .value = KEY_FN_F6 },
+	{ .name = 5922, .len = 9, .value = KEY_FN_F7 },
+	{ .name = 5933, .len = 9, .value = KEY_FN_F8 },
+	{ .name = 5944, .len = 9, .value = KEY_FN_F9 },
+	{ .name = 6061, .len = 18, .value = KEY_FN_RIGHT_SHIFT },
+	{ .name = 6041, .len = 8, .value = KEY_FN_S },
+	{ .name = 2770, .len = 11, .value = KEY_FORWARD },
+	{ .name = 3633, .len = 15, .value = KEY_FORWARDMAIL },
+	{ .name = 5602, .len = 13, .value = KEY_FRAMEBACK },
+	{ .name = 5617, .len = 16, .value = KEY_FRAMEFORWARD },
+	{ .name = 2454, .len = 9, .value = KEY_FRONT },
+	{ .name = 4821, .len = 15, .value = KEY_FULL_SCREEN },
+	{ .name = 1381, .len = 5, .value = KEY_G },
+	{ .name = 5325, .len = 9, .value = KEY_GAMES },
+	{ .name = 4613, .len = 8, .value = KEY_GOTO },
+	{ .name = 5424, .len = 18, .value = KEY_GRAPHICSEDITOR },
+	{ .name = 1447, .len = 9, .value = KEY_GRAVE },
+	{ .name = 5112, .len = 9, .value = KEY_GREEN },
+	{ .name = 1388, .len = 5, .value = KEY_H },
+	{ .name = 2337, .len = 11, .value = KEY_HANGEUL },
+	{ .name = 5764, .len = 16, .value = KEY_HANGUP_PHONE },
+	{ .name = 2350, .len = 9, .value = KEY_HANJA },
+	{ .name = 2515, .len = 8, .value = KEY_HELP },
+	{ .name = 1959, .len = 10, .value = KEY_HENKAN },
+	{ .name = 1945, .len = 12, .value = KEY_HIRAGANA },
+	{ .name = 2102, .len = 8, .value = KEY_HOME },
+	{ .name = 2942, .len = 12, .value = KEY_HOMEPAGE },
+	{ .name = 3337, .len = 6, .value = KEY_HP },
+	{ .name = 1276, .len = 5, .value = KEY_I },
+	{ .name = 5709, .len = 10, .value = KEY_IMAGES },
+	{ .name = 4658, .len = 8, .value = KEY_INFO },
+	{ .name = 2186, .len = 10, .value = KEY_INSERT },
+	{ .name = 5808, .len = 12, .value = KEY_INS_LINE },
+	{ .name = 2921, .len = 7, .value = KEY_ISO },
+	{ .name = 1395, .len = 5, .value = KEY_J },
+	{ .name = 6877, .len = 11, .value = KEY_JOURNAL },
+	{ .name = 1402, .len = 5, .value = KEY_K },
+	{ .name = 1931, .len = 12, .value = KEY_KATAKANA },
+	{ .name = 1971, .len = 20, .value = KEY_KATAKANAHIRAGANA },
+	{ .name = 3578, .len = 16, .value = KEY_KBDILLUMDOWN },
+	{ .name = 3558, .len = 18, .value = KEY_KBDILLUMTOGGLE },
+	{ .name = 3596, .len = 14, .value = KEY_KBDILLUMUP },
+	{ .name = 7254, .len = 25, .value = KEY_KBDINPUTASSIST_ACCEPT },
+	{ .name = 7281, .len = 25, .value = KEY_KBDINPUTASSIST_CANCEL },
+	{ .name = 7169, .len = 23, .value = KEY_KBDINPUTASSIST_NEXT },
+	{ .name = 7224, .len = 28, .value = KEY_KBDINPUTASSIST_NEXTGROUP },
+	{ .name = 7144, .len = 23, .value = KEY_KBDINPUTASSIST_PREV },
+	{ .name = 7194, .len = 28, .value = KEY_KBDINPUTASSIST_PREVGROUP },
+	{ .name = 6973, .len = 19, .value = KEY_KBD_LAYOUT_NEXT },
+	{ .name = 8457, .len = 17, .value = KEY_KBD_LCD_MENU1 },
+	{ .name = 8476, .len = 17, .value = KEY_KBD_LCD_MENU2 },
+	{ .name = 8495, .len = 17, .value = KEY_KBD_LCD_MENU3 },
+	{ .name = 8514, .len = 17, .value = KEY_KBD_LCD_MENU4 },
+	{ .name = 8533, .len = 17, .value = KEY_KBD_LCD_MENU5 },
+	{ .name = 4848, .len = 12, .value = KEY_KEYBOARD },
+	{ .name = 1854, .len = 7, .value = KEY_KP0 },
+	{ .name = 1827, .len = 7, .value = KEY_KP1 },
+	{ .name = 1836, .len = 7, .value = KEY_KP2 },
+	{ .name = 1845, .len = 7, .value = KEY_KP3 },
+	{ .name = 1788, .len = 7, .value = KEY_KP4 },
+	{ .name = 1797, .len = 7, .value = KEY_KP5 },
+	{ .name = 1806, .len = 7, .value = KEY_KP6 },
+	{ .name = 1748, .len = 7, .value = KEY_KP7 },
+	{ .name = 1757, .len = 7, .value = KEY_KP8 },
+	{ .name = 1766, .len = 7, .value = KEY_KP9 },
+	{ .name = 1584, .len = 14, .value = KEY_KPASTERISK },
+	{ .name = 2324, .len = 11, .value = KEY_KPCOMMA },
+	{ .name = 1863, .len = 9, .value = KEY_KPDOT },
+	{ .name = 2022, .len = 11, .value = KEY_KPENTER },
+	{ .name = 2272, .len = 11, .value = KEY_KPEQUAL },
+	{ .name = 2007, .len = 13, .value = KEY_KPJPCOMMA },
+	{ .name = 3029, .len = 15, .value = KEY_KPLEFTPAREN },
+	{ .name = 1775, .len = 11, .value = KEY_KPMINUS },
+	{ .name = 1815, .len = 10, .value = KEY_KPPLUS },
+	{ .name = 2285, .len = 15, .value = KEY_KPPLUSMINUS },
+	{ .name = 3046, .len = 16, .value = KEY_KPRIGHTPAREN },
+	{ .name = 2050, .len = 11, .value = KEY_KPSLASH },
+	{ .name = 1409, .len = 5, .value = KEY_L },
+	{ .name = 4771, .len = 12, .value = KEY_LANGUAGE },
+	{ .name = 5188, .len = 8, .value = KEY_LAST },
+	{ .name = 2132, .len = 8, .value = KEY_LEFT },
+	{ .name = 1600, .len = 11, .value = KEY_LEFTALT },
+	{ .name = 1297, .len = 13, .value = KEY_LEFTBRACE },
+	{ .name = 1339, .len = 12, .value = KEY_LEFTCTRL },
+	{ .name = 2370, .len = 12, .value = KEY_LEFTMETA },
+	{ .name = 1458, .len = 13, .value = KEY_LEFTSHIFT },
+	{ .name = 7351, .len = 13, .value = KEY_LEFT_DOWN },
+	{ .name = 7338, .len = 11, .value = KEY_LEFT_UP },
+	{ .name = 6724, .len = 17, .value = KEY_LIGHTS_TOGGLE },
+	{ .name = 2088, .len = 12, .value = KEY_LINEFEED },
+	{ .name = 5069, .len = 8, .value = KEY_LIST },
+	{ .name = 5568, .len = 10, .value = KEY_LOGOFF },
+	{ .name = 1530, .len = 5, .value = KEY_M },
+	{ .name = 2210, .len = 9, .value = KEY_MACRO },
+	{ .name = 7948, .len = 10, .value = KEY_MACRO1 },
+	{ .name = 8056, .len = 11, .value = KEY_MACRO10 },
+	{ .name = 8069, .len = 11, .value = KEY_MACRO11 },
+	{ .name = 8082, .len = 11, .value = KEY_MACRO12 },
+	{ .name = 8095, .len = 11, .value = KEY_MACRO13 },
+	{ .name = 8108, .len = 11, .value = KEY_MACRO14 },
+	{ .name = 8121, .len = 11, .value = KEY_MACRO15 },
+	{ .name = 8134, .len = 11, .value = KEY_MACRO16 },
+	{ .name = 8147, .len = 11, .value = KEY_MACRO17 },
+	{ .name = 8160, .len = 11, .value = KEY_MACRO18 },
+	{ .name = 8173, .len = 11, .value = KEY_MACRO19 },
+	{ .name = 7960, .len = 10, .value = KEY_MACRO2 },
+	{ .name = 8186, .len = 11, .value = KEY_MACRO20 },
+	{ .name = 8199, .len = 11, .value = KEY_MACRO21 },
+	{ .name = 8212, .len = 11, .value = KEY_MACRO22 },
+	{ .name = 8225, .len = 11, .value = KEY_MACRO23 },
+	{ .name = 8238, .len = 11, .value = KEY_MACRO24 },
+	{ .name = 8251, .len = 11, .value = KEY_MACRO25 },
+	{ .name = 8264, .len = 11, .value = KEY_MACRO26 },
+	{ .name = 8277, .len = 11, .value = KEY_MACRO27 },
+	{ .name = 8290, .len = 11, .value = KEY_MACRO28 },
+	{ .name = 8303, .len = 11, .value = KEY_MACRO29 },
+	{ .name = 7972, .len = 10, .value = KEY_MACRO3 },
+	{ .name = 8316, .len = 11, .value = KEY_MACRO30 },
+	{ .name = 7984, .len = 10, .value = KEY_MACRO4 },
+	{ .name = 7996, .len = 10, .value = KEY_MACRO5 },
+	{ .name = 8008, .len = 10, .value = KEY_MACRO6 },
+	{ .name = 8020, .len = 10, .value = KEY_MACRO7 },
+	{ .name = 8032, .len = 10, .value = KEY_MACRO8 },
+	{ .name = 8044, .len = 10, .value = KEY_MACRO9 },
+	{ .name = 8400, .len = 17, .value = KEY_MACRO_PRESET1 },
+	{ .name = 8419, .len = 17, .value = KEY_MACRO_PRESET2 },
+	{ .name = 8438, .len = 17, .value = KEY_MACRO_PRESET3 },
+	{ .name = 8376, .len = 22, .value = KEY_MACRO_PRESET_CYCLE },
+	{ .name = 8329, .len = 22, .value = KEY_MACRO_RECORD_START },
+	{ .name = 8353, .len = 21, .value = KEY_MACRO_RECORD_STOP },
+	{ .name = 2721, .len = 8, .value = KEY_MAIL },
+	{ .name = 7726, .len = 17, .value = KEY_MARK_WAYPOINT },
+	{ .name = 9383, .len = 7, .value = KEY_MAX },
+	{ .name = 3526, .len = 9, .value = KEY_MEDIA },
+	{ .name = 5653, .len = 16, .value = KEY_MEDIA_REPEAT },
+	{ .name = 7381, .len = 18, .value = KEY_MEDIA_TOP_MENU },
+	{ .name = 5079, .len = 8, .value = KEY_MEMO },
+	{ .name = 2525, .len = 8, .value = KEY_MENU },
+	{ .name = 5518, .len = 13, .value = KEY_MESSENGER },
+	{ .name = 4762, .len = 7, .value = KEY_MHP },
+	{ .name = 3849, .len = 11, .value = KEY_MICMUTE },
+	{ .name = 1181, .len = 9, .value = KEY_MINUS },
+	{ .name = 4838, .len = 8, .value = KEY_MODE },
+	{ .name = 2979, .len = 8, .value = KEY_MOVE },
+	{ .name = 5023, .len = 7, .value = KEY_MP3 },
+	{ .name = 2660, .len = 9, .value = KEY_MSDOS },
+	{ .name = 1993, .len = 12, .value = KEY_MUHENKAN },
+	{ .name = 2221, .len = 8, .value = KEY_MUTE },
+	{ .name = 1523, .len = 5, .value = KEY_N },
+	{ .name = 7754, .len = 13, .value = KEY_NAV_CHART },
+	{ .name = 7913, .len = 12, .value = KEY_NAV_INFO },
+	{ .name = 3064, .len = 7, .value = KEY_NEW },
+	{ .name = 5476, .len = 8, .value = KEY_NEWS },
+	{ .name = 5206, .len = 8, .value = KEY_NEXT },
+	{ .name = 2827, .len = 12, .value = KEY_NEXTSONG },
+	{ .name = 7657, .len = 16, .value = KEY_NEXT_ELEMENT },
+	{ .name = 7462, .len = 17, .value = KEY_NEXT_FAVORITE },
+	{ .name = 5721, .len = 23, .value = KEY_NOTIFICATION_CENTER },
+	{ .name = 6222, .len = 13, .value = KEY_NUMERIC_0 },
+	{ .name = 6237, .len = 13, .value = KEY_NUMERIC_1 },
+	{ .name = 7401, .len = 14, .value = KEY_NUMERIC_11 },
+	{ .name = 7417, .len = 14, .value = KEY_NUMERIC_12 },
+	{ .name = 6252, .len = 13, .value = KEY_NUMERIC_2 },
+	{ .name = 6267, .len = 13, .value = KEY_NUMERIC_3 },
+	{ .name = 6282, .len = 13, .value = KEY_NUMERIC_4 },
+	{ .name = 6297, .len = 13, .value = KEY_NUMERIC_5 },
+	{ .name = 6312, .len = 13, .value = KEY_NUMERIC_6 },
+	{ .name = 6327, .len = 13, .value = KEY_NUMERIC_7 },
+	{ .name = 6342, .len = 13, .value = KEY_NUMERIC_8 },
+	{ .name = 6357, .len = 13, .value = KEY_NUMERIC_9 },
+	{ .name = 6409, .len = 13, .value = KEY_NUMERIC_A },
+	{ .name = 6424, .len = 13, .value = KEY_NUMERIC_B },
+	{ .name = 6439, .len = 13, .value = KEY_NUMERIC_C },
+	{ .name = 6454, .len = 13, .value = KEY_NUMERIC_D },
+	{ .name = 6390, .len = 17, .value = KEY_NUMERIC_POUND },
+	{ .name = 6372, .len = 16, .value = KEY_NUMERIC_STAR },
+	{ .name = 1719, .len = 11, .value = KEY_NUMLOCK },
+	{ .name = 1283, .len = 5, .value = KEY_O },
+	{ .name = 4593, .len = 6, .value = KEY_OK },
+	{ .name = 7581, .len = 21, .value = KEY_ONSCREEN_KEYBOARD },
+	{ .name = 2475, .len = 8, .value = KEY_OPEN },
+	{ .name = 4646, .len = 10, .value = KEY_OPTION },
+	{ .name = 1290, .len = 5, .value = KEY_P },
+	{ .name = 2172, .len = 12, .value = KEY_PAGEDOWN },
+	{ .name = 2120, .len = 10, .value = KEY_PAGEUP },
+	{ .name = 2485, .len = 9, .value = KEY_PASTE },
+	{ .name = 2302, .len = 9, .value = KEY_PAUSE },
+	{ .name = 3203, .len = 11, .value = KEY_PAUSECD },
+	{ .name = 7498, .len = 16, .value = KEY_PAUSE_RECORD },
+	{ .name = 4880, .len = 6, .value = KEY_PC },
+	{ .name = 2910, .len = 9, .value = KEY_PHONE },
+	{ .name = 5746, .len = 16, .value = KEY_PICKUP_PHONE },
+	{ .name = 3284, .len = 8, .value = KEY_PLAY },
+	{ .name = 3191, .len = 10, .value = KEY_PLAYCD },
+	{ .name = 4983, .len = 10, .value = KEY_PLAYER },
+	{ .name = 2841, .len = 13, .value = KEY_PLAYPAUSE },
+	{ .name = 2261, .len = 9, .value = KEY_POWER },
+	{ .name = 4634, .len = 10, .value = KEY_POWER2 },
+	{ .name = 5444, .len = 16, .value = KEY_PRESENTATION },
+	{ .name = 5263, .len = 12, .value = KEY_PREVIOUS },
+	{ .name = 2856, .len = 16, .value = KEY_PREVIOUSSONG },
+	{ .name = 7675, .len = 20, .value = KEY_PREVIOUS_ELEMENT },
+	{ .name = 3326, .len = 9, .value = KEY_PRINT },
+	{ .name = 7604, .len = 25, .value = KEY_PRIVACY_SCREEN_TOGGLE },
+	{ .name = 2629, .len = 9, .value = KEY_PROG1 },
+	{ .name = 2640, .len = 9, .value = KEY_PROG2 },
+	{ .name = 3216, .len = 9, .value = KEY_PROG3 },
+	{ .name = 3227, .len = 9, .value = KEY_PROG4 },
+	{ .name = 4703, .len = 11, .value = KEY_PROGRAM },
+	{ .name = 2433, .len = 9, .value = KEY_PROPS },
+	{ .name = 4753, .len = 7, .value = KEY_PVR },
+	{ .name = 1227, .len = 5, .value = KEY_Q },
+	{ .name = 3368, .len = 12, .value = KEY_QUESTION },
+	{ .name = 1248, .len = 5, .value = KEY_R },
+	{ .name = 7834, .len = 17, .value = KEY_RADAR_OVERLAY },
+	{ .name = 4961, .len = 9, .value = KEY_RADIO },
+	{ .name = 2886, .len = 10, .value = KEY_RECORD },
+	{ .name = 5103, .len = 7, .value = KEY_RED },
+	{ .name = 3073, .len = 8, .value = KEY_REDO },
+	{ .name = 2956, .len = 11, .value = KEY_REFRESH },
+	{ .name = 3622, .len = 9, .value = KEY_REPLY },
+	{ .name = 1088, .len = 12, .value = KEY_RESERVED },
+	{ .name = 5216, .len = 11, .value = KEY_RESTART },
+	{ .name = 2898, .len = 10, .value = KEY_REWIND },
+	{ .name = 3837, .len = 10, .value = KEY_RFKILL },
+	{ .name = 2142, .len = 9, .value = KEY_RIGHT },
+	{ .name = 2074, .len = 12, .value = KEY_RIGHTALT },
+	{ .name = 1312, .len = 14, .value = KEY_RIGHTBRACE },
+	{ .name = 2035, .len = 13, .value = KEY_RIGHTCTRL },
+	{ .name = 2384, .len = 13, .value = KEY_RIGHTMETA },
+	{ .name = 1568, .len = 14, .value = KEY_RIGHTSHIFT },
+	{ .name = 7322, .len = 14, .value = KEY_RIGHT_DOWN },
+	{ .name = 7308, .len = 12, .value = KEY_RIGHT_UP },
+	{ .name = 1923, .len = 6, .value = KEY_RO },
+	{ .name = 7366, .len = 13, .value = KEY_ROOT_MENU },
+	{ .name = 2683, .len = 18, .value = KEY_ROTATE_DISPLAY },
+	{ .name = 6818, .len = 22, .value = KEY_ROTATE_LOCK_TOGGLE },
+	{ .name = 1360, .len = 5, .value = KEY_S },
+	{ .name = 4924, .len = 7, .value = KEY_SAT },
+	{ .name = 4933, .len = 8, .value = KEY_SAT2 },
+	{ .name = 3650, .len = 8, .value = KEY_SAVE },
+	{ .name = 2313, .len = 9, .value = KEY_SCALE },
+	{ .name = 6923, .len = 15, .value = KEY_SCREENSAVER },
+	{ .name = 3013, .len = 14, .value = KEY_SCROLLDOWN },
+	{ .name = 1732, .len = 14, .value = KEY_SCROLLLOCK },
+	{ .name = 2999, .len = 12, .value = KEY_SCROLLUP },
+	{ .name = 3403, .len = 10, .value = KEY_SEARCH },
+	{ .name = 4601, .len = 10, .value = KEY_SELECT },
+	{ .name = 7631, .len = 24, .value = KEY_SELECTIVE_SCREENSHOT },
+	{ .name = 1416, .len = 13, .value = KEY_SEMICOLON },
+	{ .name = 3612, .len = 8, .value = KEY_SEND },
+	{ .name = 2589, .len = 12, .value = KEY_SENDFILE },
+	{ .name = 2545, .len = 9, .value = KEY_SETUP },
+	{ .name = 3452, .len = 8, .value = KEY_SHOP },
+	{ .name = 5239, .len = 11, .value = KEY_SHUFFLE },
+	{ .name = 7895, .len = 16, .value = KEY_SIDEVU_SONAR },
+	{ .name = 7788, .len = 22, .value = KEY_SINGLE_RANGE_RADAR },
+	{ .name = 1557, .len = 9, .value = KEY_SLASH },
+	{ .name = 2556, .len = 9, .value = KEY_SLEEP },
+	{ .name = 5229, .len = 8, .value = KEY_SLOW },
+	{ .name = 7554, .len = 15, .value = KEY_SLOWREVERSE },
+	{ .name = 7745, .len = 7, .value = KEY_SOS },
+	{ .name = 3357, .len = 9, .value = KEY_SOUND },
+	{ .name = 1613, .len = 9, .value = KEY_SPACE },
+	{ .name = 5552, .len = 14, .value = KEY_SPELLCHECK },
+	{ .name = 3441, .len = 9, .value = KEY_SPORT },
+	{ .name = 5407, .len = 15, .value = KEY_SPREADSHEET },
+	{ .name = 2412, .len = 8, .value = KEY_STOP },
+	{ .name = 2874, .len = 10, .value = KEY_STOPCD },
+	{ .name = 7481, .len = 15, .value = KEY_STOP_RECORD },
+	{ .name = 4796, .len = 12, .value = KEY_SUBTITLE },
+	{ .name = 3260, .len = 11, .value = KEY_SUSPEND },
+	{ .name = 3537, .len = 19, .value = KEY_SWITCHVIDEOMODE },
+	{ .name = 2063, .len = 9, .value = KEY_SYSRQ },
+	{ .name = 1255, .len = 5, .value = KEY_T },
+	{ .name = 1218, .len = 7, .value = KEY_TAB },
+	{ .name = 4951, .len = 8, .value = KEY_TAPE },
+	{ .name = 6860, .len = 15, .value = KEY_TASKMANAGER },
+	{ .name = 5289, .len = 8, .value = KEY_TEEN },
+	{ .name = 4995, .len = 8, .value = KEY_TEXT },
+	{ .name = 4668, .len = 8, .value = KEY_TIME },
+	{ .name = 4785, .len = 9, .value = KEY_TITLE },
+	{ .name = 6541, .len = 16, .value = KEY_TOUCHPAD_OFF },
+	{ .name = 6524, .len = 15, .value = KEY_TOUCHPAD_ON },
+	{ .name = 6503, .len = 19, .value = KEY_TOUCHPAD_TOGGLE },
+	{ .name = 7853, .len = 21, .value = KEY_TRADITIONAL_SONAR },
+	{ .name = 4972, .len = 9, .value = KEY_TUNER },
+	{ .name = 4888, .len = 6, .value = KEY_TV },
+	{ .name = 4896, .len = 7, .value = KEY_TV2 },
+	{ .name = 5299, .len = 8, .value = KEY_TWEN },
+	{ .name = 1269, .len = 5, .value = KEY_U },
+	{ .name = 2444, .len = 8, .value = KEY_UNDO },
+	{ .name = 3722, .len = 11, .value = KEY_UNKNOWN },
+	{ .name = 7525, .len = 10, .value = KEY_UNMUTE },
+	{ .name = 2112, .len = 6, .value = KEY_UP },
+	{ .name = 3713, .len = 7, .value = KEY_UWB },
+	{ .name = 1509, .len = 5, .value = KEY_V },
+	{ .name = 4905, .len = 7, .value = KEY_VCR },
+	{ .name = 4914, .len = 8, .value = KEY_VCR2 },
+	{ .name = 4678, .len = 10, .value = KEY_VENDOR },
+	{ .name = 5043, .len = 9, .value = KEY_VIDEO },
+	{ .name = 5309, .len = 14, .value = KEY_VIDEOPHONE },
+	{ .name = 3735, .len = 14, .value = KEY_VIDEO_NEXT },
+	{ .name = 3751, .len = 14, .value = KEY_VIDEO_PREV },
+	{ .name = 7516, .len = 7, .value = KEY_VOD },
+	{ .name = 6940, .len = 16, .value = KEY_VOICECOMMAND },
+	{ .name = 5486, .len = 13, .value = KEY_VOICEMAIL },
+	{ .name = 2231, .len = 14, .value = KEY_VOLUMEDOWN },
+	{ .name = 2247, .len = 12, .value = KEY_VOLUMEUP },
+	{ .name = 1234, .len = 5, .value = KEY_W },
+	{ .name = 2567, .len = 10, .value = KEY_WAKEUP },
+	{ .name = 3703, .len = 8, .value = KEY_WLAN },
+	{ .name = 5376, .len = 17, .value = KEY_WORDPROCESSOR },
+	{ .name = 6487, .len = 14, .value = KEY_WPS_BUTTON },
+	{ .name = 3827, .len = 8, .value = KEY_WWAN },
+	{ .name = 2651, .len = 7, .value = KEY_WWW },
+	{ .name = 1495, .len = 5, .value = KEY_X },
+	{ .name = 2619, .len = 8, .value = KEY_XFER },
+	{ .name = 1262, .len = 5, .value = KEY_Y },
+	{ .name = 5123, .len = 10, .value = KEY_YELLOW },
+	{ .name = 2361, .len = 7, .value = KEY_YEN },
+	{ .name = 1488, .len = 5, .value = KEY_Z },
+	{ .name = 1874, .len = 18, .value = KEY_ZENKAKUHANKAKU },
+	{ .name = 5336, .len = 10, .value = KEY_ZOOMIN },
+	{ .name = 5348, .len = 11, .value = KEY_ZOOMOUT },
+	{ .name = 5361, .len = 13, .value = KEY_ZOOMRESET },
+	{ .name = 9402, .len = 9, .value = LED_CAPSL },
+	{ .name = 9503, .len = 12, .value = LED_CHARGING },
+	{ .name = 9426, .len = 11, .value = LED_COMPOSE },
+	{ .name = 9439, .len = 8, .value = LED_KANA },
+	{ .name = 9493, .len = 8, .value = LED_MAIL },
+	{ .name = 9517, .len = 7, .value = LED_MAX },
+	{ .name = 9483, .len = 8, .value = LED_MISC },
+	{ .name = 9473, .len = 8, .value = LED_MUTE },
+	{ .name = 9392, .len = 8, .value = LED_NUML },
+	{ .name = 9413, .len = 11, .value = LED_SCROLLL },
+	{ .name = 9449, .len = 9, .value = LED_SLEEP },
+	{ .name = 9460, .len = 11, .value = LED_SUSPEND },
+	{ .name = 9592, .len = 11, .value = MSC_GESTURE },
+	{ .name = 9639, .len = 7, .value = MSC_MAX },
+	{ .name = 9578, .len = 12, .value = MSC_PULSELED },
+	{ .name = 9605, .len = 7, .value = MSC_RAW },
+	{ .name = 9614, .len = 8, .value = MSC_SCAN },
+	{ .name = 9566, .len = 10, .value = MSC_SERIAL },
+	{ .name = 9624, .len = 13, .value = MSC_TIMESTAMP },
+	{ .name = 412, .len = 8, .value = REL_DIAL },
+	{ .name = 400, .len = 10, .value = REL_HWHEEL },
+	{ .name = 475, .len = 17, .value = REL_HWHEEL_HI_RES },
+	{ .name = 494, .len = 7, .value = REL_MAX },
+	{ .name = 433, .len = 8, .value = REL_MISC },
+	{ .name = 443, .len = 12, .value = REL_RESERVED },
+	{ .name = 376, .len = 6, .value = REL_RX },
+	{ .name = 384, .len = 6, .value = REL_RY },
+	{ .name = 392, .len = 6, .value = REL_RZ },
+	{ .name = 422, .len = 9, .value = REL_WHEEL },
+	{ .name = 457, .len = 16, .value = REL_WHEEL_HI_RES },
+	{ .name = 355, .len = 5, .value = REL_X },
+	{ .name = 362, .len = 5, .value = REL_Y },
+	{ .name = 369, .len = 5, .value = REL_Z },
+	{ .name = 10235, .len = 9, .value = REP_DELAY },
+	{ .name = 10286, .len = 7, .value = REP_MAX },
+	{ .name = 10246, .len = 10, .value = REP_PERIOD },
+	{ .name = 9537, .len = 8, .value = SND_BELL },
+	{ .name = 9526, .len = 9, .value = SND_CLICK },
+	{ .name = 9557, .len = 7, .value = SND_MAX },
+	{ .name = 9547, .len = 8, .value = SND_TONE },
+	{ .name = 9803, .len = 20, .value = SW_CAMERA_LENS_COVER },
+	{ .name = 9730, .len = 7, .value = SW_DOCK },
+	{ .name = 9842, .len = 18, .value = SW_FRONT_PROXIMITY },
+	{ .name = 9672, .len = 19, .value = SW_HEADPHONE_INSERT },
+	{ .name = 9758, .len = 23, .value = SW_JACK_PHYSICAL_INSERT },
+	{ .name = 9825, .len = 15, .value = SW_KEYPAD_SLIDE },
+	{ .name = 9648, .len = 6, .value = SW_LID },
+	{ .name = 9878, .len = 16, .value = SW_LINEIN_INSERT },
+	{ .name = 9739, .len = 17, .value = SW_LINEOUT_INSERT },
+	{ .name = 9929, .len = 16, .value = SW_MACHINE_COVER },
+	{ .name = 10295, .len = 6, .value = SW_MAX },
+	{ .name = 9708, .len = 20, .value = SW_MICROPHONE_INSERT },
+	{ .name = 9896, .len = 14, .value = SW_MUTE_DEVICE },
+	{ .name = 9912, .len = 15, .value = SW_PEN_INSERTED },
+	{ .name = 9693, .len = 13, .value = SW_RFKILL_ALL },
+	{ .name = 9862, .len = 14, .value = SW_ROTATE_LOCK },
+	{ .name = 9656, .len = 14, .value = SW_TABLET_MODE },
+	{ .name = 9783, .len = 18, .value = SW_VIDEOOUT_INSERT },
+	{ .name = 10186, .len = 10, .value = SYN_CONFIG },
+	{ .name = 10213, .len = 11, .value = SYN_DROPPED },
+	{ .name = 10226, .len = 7, .value = SYN_MAX },
+	{ .name = 10198, .len = 13, .value = SYN_MT_REPORT },
+	{ .name = 10174, .len = 10, .value = SYN_REPORT },
+};
+
+static const short code_names_hash_g[] = {
+	-744, -742, 0, 2, 1, 0, 0, -739, 0, -733, -729, 1,
+	0, 0, 0, 0, -721, 0, 1, -720, 2, -718, 0, -716,
+	0, -714, 4, -713, -709, 0, -704, 0, 2, -701, 0, 1,
+	0, 0, -699, 0, 0, 0, -698, -697, -696, 3, -691, -687,
+	0, 0, 3, 0, -686, 1, -683, 1, -682, 2, 4, 0,
+	4, -681, 2, 3, 5, -680, 0, 2, -679, -678, 0, 1,
+	0, 0, 0, 1, -674, -672, -669, 0, -665, -664, -661, 0,
+	0, 0, -660, -658, 1, 0, -657, -656, -655, 0, 2, 2,
+	1, 1, 0, 2, -654, -650, 2, -648, 0, 0, 0, -645,
+	-643, 0, 0, -642, -640, 0, 1, 5, -639, 0, -638, 1,
+	0, -635, 1, 0, -634, -632, 1, 0, 0, -628, -627, -623,
+	1, 0, 1, -620, -616, -613, -611, -610, -609, 0, 1, 8,
+	1, 0, 1, 0, 0, 0, 3, 0, 2, 0, 0, -603,
+	3, -599, 0, 0, -591, -590, -589, 0, -583, 0, 5, -576,
+	-575, -573, 0, 3, 1, 0, 2, 7, -571, -569, -568, 1,
+	0, -567, 4, 2, -566, 1, -563, -561, 0, 0, -559, 1,
+	-556, 0, -554, 0, -553, 1, 4, 2, 0, 0, 0, -552,
+	0, 0, -551, 0, -550, -548, 0, -542, 0, -534, 0, 5,
+	3, 3, 0, -533, -528, -526, -521, 2, -520, 0, 1, -516,
+	-514, 0, 1, -513, 0, -511, 0, -510, -509, 1, 0, 0,
+	0, 0, -501, -498, 4, 1, -496, 0, 0, 1, 0, 0,
+	0, -494, -489, 0, 0, 3, 0, -486, 0, 0, -485, 0,
+	1, -484, 4, -481, -480, -477, -475, -473, -472, 0, 6, 1,
+	0, -467, -456, -455, -454, -450, -449, -444, 1, 0, 1, 0,
+	-441, 0, 0, 0, 1, -437, 0, -429, 3, -428, -426, -425,
+	-424, 0, 6, -417, 0, 0, 0, 1, -415, 0, 0, 3,
+	-414, -413, -412, 0, 0, -410, 0, 0, 0, -409, 1, -406,
+	-405, -400, 1, 2, 0, -398, -396, -394, 0, -391, -390, 0,
+	1, 0, 3, 0, 0, 0, -389, -386, 0, -385, 0, -384,
+	-382, -380, -377, 0, 2, 0, -372, -365, 4, 0, -362, 0,
+	2, 0, 0, -359, 0, 1, 1, 5, 1, 2, 0, -358,
+	0, 0, 2, -357, 1, -356, -355, 0, 6, -353, 0, 0,
+	6, 0, 0, 5, 3, 1, 4, -352, 0, -351, 0, -348,
+	0, 0, 0, 1, -346, -342, 2, 9, 4, 1, -340, 0,
+	4, -339, 0, -334, 3, -331, 0, -330, -325, 0, 0, 0,
+	-324, -322, 9, 0, -321, 0, 1, 0, 0, 1, -319, 4,
+	0, -318, -316, 1, -313, -309, -306, 0, 0, -304, 5, 3,
+	0, -302, 0, 2, 2, 2, -297, 0, 1, -290, 0, 0,
+	0, 4, 5, 0, 0, 0, 0, 0, 0, -289, 0, 6,
+	0, 4, -288, -286, -285, 5, -284, 1, -283, 3, -281, 2,
+	-280, 3, -273, 0, 0, -267, 1, 0, 3, -264, 0, 0,
+	0, 0, -262, 2, 1, 3, -253, 0, 3, 0, 1, 0,
+	5, -252, 0, -245, -240, -238, -234, 1, 0, -230, 0, -228,
+	0, 4, -226, 0, -224, -223, 0, -221, -220, 0, 2, -216,
+	-214, 0, 0, -210, 0, 0, 16, 2, -208, 0, 2, 0,
+	-207, 0, -205, -204, -201, 0, 0, 1, 0, -200, 1, 1,
+	2, 0, 0, 0, -199, 0, 2, 0, 0, 0, 5, -198,
+	-196, -195, -194, 1, -193, -186, 0, 0, -180, 4, 3, 2,
+	0, -177, 1, 0, -176, -175, -173, -172, 2, -171, -168, 0,
+	-159, 0, 0, 5, 2, -157, -152, 0, -151, -149, 0, 0,
+	-147, -145, -144, -143, -141, -138, -131, 0, 0, 0, 0, -130,
+	-128, -127, 0, -126, 0, 1, 2, 0, 5, 0, 0, 3,
+	-123, 0, 1, -119, 0, 0, 0, -114, 2, 5, 0, 0,
+	-113, 0, 5, 1, 0, -106, 0, -104, 0, 4, 1, 3,
+	3, 0, 2, -103, 4, 0, 0, -100, 2, 0, -99, 16,
+	0, -97, -96, 0, 2, 1, -95, 0, -91, -89, -87, 0,
+	-82, 0, 0, 3, -80, 1, 0, 0, -77, -76, 0, -72,
+	0, 1, 1, 0, -69, 0, -67, 0, -66, -63, 1, 0,
+	3, -59, 0, -56, 0, 0, 1, -55, 0, -51, -46, 0,
+	0, -41, 1, -39, 0, 0, 5, -35, 0, -34, -31, -25,
+	0, -18, -15, 2, -12, 1, 0, 4, 2, 1, 8, -11,
+	4, -10, -8, 0, -6, 0, -3, -2, 4, 8, 0, 0,
+};
+
+static const unsigned short code_names_hash_index[] = {
+	324, 664, 206, 739, 122, 202, 196, 665, 497, 241, 305, 18,
+	511, 609, 573, 354, 675, 161, 415, 219, 14, 30, 729, 307,
+	522, 172, 518, 105, 580, 529, 63, 397, 68, 221, 602, 434,
+	491, 4, 191, 75, 698, 505, 325, 629, 426, 614, 335, 712,
+	466, 189, 449, 690, 647, 224, 588, 261, 1, 3, 289, 684,
+	194, 236, 413, 134, 418, 295, 643, 352, 173, 725, 266, 738,
+	7, 501, 358, 566, 8, 471, 582, 82, 111, 292, 435, 455,
+	214, 323, 274, 714, 53, 432, 15, 175, 517, 557, 583, 671,
+	545, 31, 558, 703, 520, 345, 299, 50, 135, 360, 24, 66,
+	406, 667, 732, 177, 147, 726, 452, 318, 199, 264, 584, 710,
+	265, 192, 382, 549, 249, 114, 568, 632, 321, 429, 240, 454,
+	490, 656, 423, 359, 692, 519, 119, 330, 343, 450, 215, 39,
+	526, 242, 244, 288, 55, 334, 233, 547, 209, 715, 367, 198,
+	509, 734, 608, 393, 327, 124, 112, 262, 640, 229, 487, 394,
+	639, 154, 365, 494, 412, 542, 623, 693, 113, 742, 155, 271,
+	525, 56, 29, 294, 590, 428, 622, 248, 538, 120, 441, 25,
+	410, 283, 201, 49, 663, 356, 276, 257, 373, 83, 363, 626,
+	531, 333, 524, 579, 472, 26, 255, 395, 644, 572, 503, 212,
+	548, 203, 89, 375, 77, 45, 344, 91, 319, 433, 417, 607,
+	220, 158, 672, 168, 702, 170, 103, 616, 0, 282, 239, 475,
+	329, 128, 400, 627, 167, 541, 71, 310, 293, 361, 200, 652,
+	391, 102, 153, 695, 131, 668, 719, 149, 419, 500, 322, 593,
+	237, 597, 743, 316, 709, 388, 353, 592, 565, 78, 453, 534,
+	384, 281, 259, 670, 544, 108, 303, 645, 619, 216, 332, 10,
+	708, 737, 642, 437, 205, 17, 676, 250, 686, 302, 567, 21,
+	389, 550, 731, 515, 79, 595, 414, 116, 447, 674, 650, 85,
+	469, 238, 32, 598, 723, 182, 431, 165, 99, 628, 535, 510,
+	677, 486, 390, 106, 507, 273, 476, 33, 2, 362, 12, 178,
+	521, 425, 701, 123, 138, 369, 195, 381, 54, 107, 225, 559,
+	634, 351, 377, 20, 6, 230, 666, 465, 585, 555, 226, 300,
+	575, 27, 181, 658, 61, 357, 339, 311, 445, 493, 696, 341,
+	409, 440, 401, 574, 648, 460, 186, 296, 613, 371, 660, 562,
+	346, 581, 681, 93, 587, 304, 88, 392, 536, 306, 121, 678,
+	601, 669, 539, 350, 347, 127, 337, 336, 403, 267, 342, 420,
+	564, 258, 398, 187, 246, 688, 624, 253, 571, 563, 720, 625,
+	164, 532, 706, 553, 659, 256, 427, 80, 444, 217, 730, 594,
+	366, 272, 185, 516, 162, 386, 606, 722, 208, 376, 174, 270,
+	95, 651, 687, 713, 247, 374, 370, 700, 495, 530, 569, 528,
+	560, 513, 52, 19, 483, 179, 268, 125, 612, 115, 464, 163,
+	126, 234, 144, 638, 227, 254, 721, 372, 62, 44, 184, 482,
+	67, 37, 551, 355, 152, 458, 308, 118, 47, 704, 492, 635,
+	87, 508, 260, 591, 462, 157, 132, 313, 724, 109, 618, 477,
+	485, 331, 685, 41, 73, 540, 222, 137, 64, 70, 34, 58,
+	378, 682, 637, 689, 146, 16, 98, 631, 104, 142, 364, 683,
+	523, 484, 190, 42, 502, 301, 40, 396, 473, 543, 641, 600,
+	527, 84, 436, 467, 385, 655, 59, 166, 577, 223, 605, 653,
+	278, 705, 576, 448, 251, 442, 741, 9, 5, 86, 211, 468,
+	654, 733, 297, 11, 422, 160, 416, 481, 404, 285, 451, 51,
+	716, 204, 298, 28, 552, 22, 379, 60, 228, 711, 707, 488,
+	197, 430, 408, 326, 338, 599, 65, 69, 699, 456, 136, 275,
+	439, 38, 207, 499, 277, 133, 459, 328, 680, 129, 498, 314,
+	694, 383, 245, 546, 387, 736, 94, 148, 315, 479, 348, 35,
+	457, 735, 140, 399, 141, 218, 578, 407, 662, 478, 309, 718,
+	156, 633, 13, 320, 610, 630, 57, 661, 561, 235, 159, 340,
+	171, 504, 97, 180, 611, 646, 533, 620, 150, 603, 438, 717,
+	280, 470, 263, 586, 143, 617, 461, 101, 402, 117, 604, 480,
+	269, 380, 46, 691, 287, 100, 349, 130, 443, 43, 76, 463,
+	92, 728, 290, 727, 649, 589, 312, 424, 405, 556, 36, 317,
+	243, 110, 570, 621, 23, 96, 48, 446, 210, 512, 74, 657,
+	90, 673, 139, 72, 537, 740, 231, 291, 496, 188, 279, 284,
+	474, 151, 421, 81, 286, 506, 176, 193, 514, 183, 679, 411,
+	213, 636, 615, 489, 596, 252, 697, 232, 145, 554, 169, 368,
 };
 
 static const struct name_entry prop_names[] = {
-	{ .name = "INPUT_PROP_ACCELEROMETER", .value = INPUT_PROP_ACCELEROMETER },
-	{ .name = "INPUT_PROP_BUTTONPAD", .value = INPUT_PROP_BUTTONPAD },
-	{ .name = "INPUT_PROP_DIRECT", .value = INPUT_PROP_DIRECT },
-	{ .name = "INPUT_PROP_MAX", .value = INPUT_PROP_MAX },
-	{ .name = "INPUT_PROP_POINTER", .value = INPUT_PROP_POINTER },
-	{ .name = "INPUT_PROP_POINTING_STICK", .value = INPUT_PROP_POINTING_STICK },
-	{ .name = "INPUT_PROP_SEMI_MT", .value = INPUT_PROP_SEMI_MT },
-	{ .name = "INPUT_PROP_TOPBUTTONPAD", .value = INPUT_PROP_TOPBUTTONPAD },
+	{ .name = 243, .len = 24, .value = INPUT_PROP_ACCELEROMETER },
+	{ .name = 149, .len = 20, .value = INPUT_PROP_BUTTONPAD },
+	{ .name = 130, .len = 17, .value = INPUT_PROP_DIRECT },
+	{ .name = 269, .len = 14, .value = INPUT_PROP_MAX },
+	{ .name = 110, .len = 18, .value = INPUT_PROP_POINTER },
+	{ .name = 216, .len = 25, .value = INPUT_PROP_POINTING_STICK },
+	{ .name = 171, .len = 18, .value = INPUT_PROP_SEMI_MT },
+	{ .name = 191, .len = 23, .value = INPUT_PROP_TOPBUTTONPAD },
+};
+
+static const short prop_names_hash_g[] = {
+	-8, 1, -7, -6, -4, -3, 0, -2,
+};
+
+static const unsigned short prop_names_hash_index[] = {
+	4, 5, 3, 6, 2, 7, 1, 0,
 };
 
+static inline int
+event_type_from_prefix(const char *name, size_t len)
+{
+	if (len == 0)
+		return -1;
+
+	switch (name[0]) {
+	case 'A':
+		if (len >= 4 && memcmp(name, "ABS_", 4) == 0)
+			return EV_ABS;
+		break;
+	case 'B':
+		if (len >= 4 && memcmp(name, "BTN_", 4) == 0)
+			return EV_KEY;
+		break;
+	case 'F':
+		if (len >= 10 && memcmp(name, "FF_STATUS_", 10) == 0)
+			return EV_FF_STATUS;
+		if (len >= 3 && memcmp(name, "FF_", 3) == 0)
+			return EV_FF;
+		break;
+	case 'K':
+		if (len >= 4 && memcmp(name, "KEY_", 4) == 0)
+			return EV_KEY;
+		break;
+	case 'L':
+		if (len >= 4 && memcmp(name, "LED_", 4) == 0)
+			return EV_LED;
+		break;
+	case 'M':
+		if (len >= 4 && memcmp(name, "MSC_", 4) == 0)
+			return EV_MSC;
+		break;
+	case 'P':
+		if (len >= 4 && memcmp(name, "PWR_", 4) == 0)
+			return EV_PWR;
+		break;
+	case 'R':
+		if (len >= 4 && memcmp(name, "REL_", 4) == 0)
+			return EV_REL;
+		if (len >= 4 && memcmp(name, "REP_", 4) == 0)
+			return EV_REP;
+		break;
+	case 'S':
+		if (len >= 4 && memcmp(name, "SYN_", 4) == 0)
+			return EV_SYN;
+		if (len >= 4 && memcmp(name, "SND_", 4) == 0)
+			return EV_SND;
+		if (len >= 3 && memcmp(name, "SW_", 3) == 0)
+			return EV_SW;
+		break;
+	}
+
+	return -1;
+}
+
 #endif /* EVENT_NAMES_H */
@@ -0,0 +1,304 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+
+#include "libevdev-int.h"
+#include "libevdev-util.h"
+#include "libevdev.h"
+
+/* All members must be arrays of unsigned long, the set operations treat
+ * the struct as one contiguous array of words.
+ */
+struct libevdev_capset {
+	unsigned long key_bits[NLONGS(KEY_CNT)];
+	unsigned long rel_bits[NLONGS(REL_CNT)];
+	unsigned long abs_bits[NLONGS(ABS_CNT)];
+	unsigned long led_bits[NLONGS(LED_CNT)];
+	unsigned long msc_bits[NLONGS(MSC_CNT)];
+	unsigned long sw_bits[NLONGS(SW_CNT)];
+	unsigned long ff_bits[NLONGS(FF_CNT)];
+	unsigned long rep_bits[NLONGS(REP_CNT)];
+	unsigned long snd_bits[NLONGS(SND_CNT)];
+	unsigned long props[NLONGS(INPUT_PROP_CNT)];
+};
+
+#define CAPSET_NLONGS (sizeof(struct libevdev_capset) / sizeof(unsigned long))
+
+static inline unsigned long *
+capset_words(struct libevdev_capset *set)
+{
+	return (unsigned long *)set;
+}
+
+static inline const unsigned long *
+capset_words_const(const struct libevdev_capset *set)
+{
+	return (const unsigned long *)set;
+}
+
+#define max_mask(uc, lc) \
+	case EV_##uc: \
+			*mask = set->lc##_bits; \
+			max = libevdev_event_type_get_max(type); \
+		break;
+
+static inline int
+capset_mask_const(const struct libevdev_capset *set, unsigned int type,
+		  const unsigned long **mask)
+{
+	int max;
+
+	switch(type) {
+		max_mask(ABS, abs);
+		max_mask(REL, rel);
+		max_mask(KEY, key);
+		max_mask(LED, led);
+		max_mask(MSC, msc);
+		max_mask(SW, sw);
+		max_mask(FF, ff);
+		max_mask(REP, rep);
+		max_mask(SND, snd);
+		default:
+		     max = -1;
+		     break;
+	}
+
+	return max;
+}
+
+#undef max_mask
+
+/* set is writable, so the mask returned for it is too */
+static inline int
+capset_mask(struct libevdev_capset *set, unsigned int type,
+	    unsigned long **mask)
+{
+	return capset_mask_const(set, type, (const unsigned long **)mask);
+}
+
+LIBEVDEV_EXPORT struct libevdev_capset *
+libevdev_capset_new(void)
+{
+	return calloc(1, sizeof(struct libevdev_capset));
+}
+
+LIBEVDEV_EXPORT struct libevdev_capset *
+libevdev_capset_new_from_device(const struct libevdev *dev)
+{
+	struct libevdev_capset *set;
+	unsigned int type;
+
+	lazy_load(dev, LAZY_CAPS);
+
+	set = libevdev_capset_new();
+	if (!set)
+		return NULL;
+
+	for (type = 0; type <= EV_MAX; type++) {
+		const unsigned long *devmask;
+		unsigned long *mask;
+		int max;
+
+		if (!libevdev_has_event_type(dev, type))
+			continue;
+
+		max = capset_mask(set, type, &mask);
+		if (max == -1)
+			continue;
+
+		type_to_mask_const(dev, type, &devmask);
+		memcpy(mask, devmask, NLONGS(max + 1) * sizeof(*mask));
+	}
+
+	memcpy(set->props, dev->props, sizeof(set->props));
+
+	return set;
+}
+
+LIBEVDEV_EXPORT void
+libevdev_capset_free(struct libevdev_capset *set)
+{
+	free(set);
+}
+
+LIBEVDEV_EXPORT int
+libevdev_capset_enable_event_code(struct libevdev_capset *set,
+				  unsigned int type, unsigned int code)
+{
+	unsigned long *mask;
+	int max;
+
+	max = capset_mask(set, type, &mask);
+	if (max == -1 || code > (unsigned int)max)
+		return -1;
+
+	set_bit(mask, code);
+
+	return 0;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_capset_disable_event_code(struct libevdev_capset *set,
+				   unsigned int type, unsigned int code)
+{
+	unsigned long *mask;
+	int max;
+
+	max = capset_mask(set, type, &mask);
+	if (max == -1 || code > (unsigned int)max)
+		return -1;
+
+	clear_bit(mask, code);
+
+	return 0;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_capset_has_event_code(const struct libevdev_capset *set,
+			       unsigned int type, unsigned int code)
+{
+	const unsigned long *mask;
+	int max;
+
+	max = capset_mask_const(set, type, &mask);
+	if (max == -1 || code > (unsigned int)max)
+		return 0;
+
+	return bit_is_set(mask, code);
+}
+
+LIBEVDEV_EXPORT int
+libevdev_capset_enable_property(struct libevdev_capset *set, unsigned int prop)
+{
+	if (prop > INPUT_PROP_MAX)
+		return -1;
+
+	set_bit(set->props, prop);
+
+	return 0;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_capset_disable_property(struct libevdev_capset *set, unsigned int prop)
+{
+	if (prop > INPUT_PROP_MAX)
+		return -1;
+
+	clear_bit(set->props, prop);
+
+	return 0;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_capset_has_property(const struct libevdev_capset *set, unsigned int prop)
+{
+	return prop <= INPUT_PROP_MAX && bit_is_set(set->props, prop);
+}
+
+LIBEVDEV_EXPORT void
+libevdev_capset_union(struct libevdev_capset *set,
+		      const struct libevdev_capset *other)
+{
+	unsigned long *a = capset_words(set);
+	const unsigned long *b = capset_words_const(other);
+	size_t i;
+
+	for (i = 0; i < CAPSET_NLONGS; i++)
+		a[i] |= b[i];
+}
+
+LIBEVDEV_EXPORT void
+libevdev_capset_intersect(struct libevdev_capset *set,
+			  const struct libevdev_capset *other)
+{
+	unsigned long *a = capset_words(set);
+	const unsigned long *b = capset_words_const(other);
+	size_t i;
+
+	for (i = 0; i < CAPSET_NLONGS; i++)
+		a[i] &= b[i];
+}
+
+LIBEVDEV_EXPORT int
+libevdev_capset_is_subset(const struct libevdev_capset *set,
+			  const struct libevdev_capset *other)
+{
+	const unsigned long *a = capset_words_const(set);
+	const unsigned long *b = capset_words_const(other);
+	size_t i;
+
+	for (i = 0; i < CAPSET_NLONGS; i++) {
+		if (a[i] & ~b[i])
+			return 0;
+	}
+
+	return 1;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_capset_is_disjoint(const struct libevdev_capset *set,
+			    const struct libevdev_capset *other)
+{
+	const unsigned long *a = capset_words_const(set);
+	const unsigned long *b = capset_words_const(other);
+	size_t i;
+
+	for (i = 0; i < CAPSET_NLONGS; i++) {
+		if (a[i] & b[i])
+			return 0;
+	}
+
+	return 1;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_capset_equal(const struct libevdev_capset *set,
+		      const struct libevdev_capset *other)
+{
+	return memcmp(set, other, sizeof(*set)) == 0;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_capset_count(const struct libevdev_capset *set)
+{
+	const unsigned long *a = capset_words_const(set);
+	unsigned int count = 0;
+	size_t i;
+
+	for (i = 0; i < CAPSET_NLONGS; i++)
+		count += popcount_long(a[i]);
+
+	return count;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_capset_next_event_code(const struct libevdev_capset *set,
+				unsigned int type, unsigned int code)
+{
+	const unsigned long *mask;
+	unsigned long word;
+	unsigned int idx, nlongs;
+	int max;
+
+	max = capset_mask_const(set, type, &mask);
+	if (max == -1 || code > (unsigned int)max)
+		return -1;
+
+	nlongs = NLONGS(max + 1);
+	idx = code / LONG_BITS;
+	/* mask off the bits below code in the first word */
+	word = mask[idx] & (~0UL << (code % LONG_BITS));
+
+	while (!word) {
+		if (++idx >= nlongs)
+			return -1;
+		word = mask[idx];
+	}
+
+	return idx * LONG_BITS + ctz_long(word);
+}
@@ -52,6 +52,45 @@ struct logdata {
 	void *userdata;					/** user-defined data pointer */
 };
 
+#define DEFERRED_LOG_SIZE 16 /* must be a power of two */
+#define DEFERRED_LOG_MSG_LEN 192
+
+struct deferred_log_entry {
+	enum libevdev_log_priority priority;
+	const char *file;
+	int line;
+	const char *func;
+	char msg[DEFERRED_LOG_MSG_LEN];
+};
+
+/**
+ * Internal only: single-producer single-consumer ring of log messages,
+ * filled in realtime mode instead of calling the log handler. The
+ * producer is whoever calls into libevdev for this device (usually the
+ * thread calling libevdev_next_event()), the consumer is
+ * libevdev_dispatch_deferred_log(). head and tail are free-running
+ * counters, accessed with atomics only.
+ */
+struct deferred_log {
+	struct deferred_log_entry entries[DEFERRED_LOG_SIZE];
+	unsigned int head; /**< next entry to write, written by the producer only */
+	unsigned int tail; /**< next entry to read, written by the consumer only */
+	unsigned int ndropped; /**< messages lost because the ring was full */
+};
+
+/**
+ * Device data that is fetched from the kernel on first access if the
+ * device was initialized with LIBEVDEV_INIT_FLAG_LAZY. Each category
+ * depends on the ones before it.
+ */
+enum lazy_category {
+	LAZY_CAPS = (1 << 0),	/**< event, property and repeat bits */
+	LAZY_ABS = (1 << 1),	/**< absinfo and the slot layout */
+	LAZY_STATE = (1 << 2),	/**< key, led, switch and slot state */
+	LAZY_QUEUE = (1 << 3),	/**< the event queue */
+	LAZY_ALL = LAZY_CAPS | LAZY_ABS | LAZY_STATE | LAZY_QUEUE,
+};
+
 struct libevdev {
 	int fd;
 	bool initialized;
@@ -71,6 +110,7 @@ struct libevdev {
 	unsigned long rep_bits[NLONGS(REP_CNT)]; /* convenience, always 1 */
 	unsigned long ff_bits[NLONGS(FF_CNT)];
 	unsigned long snd_bits[NLONGS(SND_CNT)];
+	unsigned int device_class; /**< cached, see update_device_class() */
 	unsigned long key_values[NLONGS(KEY_CNT)];
 	unsigned long led_values[NLONGS(LED_CNT)];
 	unsigned long sw_values[NLONGS(SW_CNT)];
@@ -91,6 +131,11 @@ struct libevdev {
 	struct timeval last_event_time;
 
 	struct logdata log;
+	bool realtime; /**< defer logging, see libevdev_set_realtime_mode() */
+	struct deferred_log *deferred_log; /**< allocated in realtime mode only */
+
+	unsigned int lazy_pending; /**< enum lazy_category not fetched yet */
+	int lazy_error; /**< the first failed lazy fetch, logged once */
 };
 
 #define log_msg_cond(dev, priority, ...) \
@@ -112,6 +157,24 @@ _libevdev_log_msg(const struct libevdev *dev,
 extern enum libevdev_log_priority
 _libevdev_log_priority(const struct libevdev *dev);
 
+extern int
+_libevdev_lazy_fetch(const struct libevdev *dev, unsigned int what);
+
+/**
+ * Make sure the given categories of device data have been fetched, see
+ * enum lazy_category. A no-op unless the device was initialized with
+ * LIBEVDEV_INIT_FLAG_LAZY.
+ *
+ * @return 0 on success or a negative errno on failure
+ */
+static inline int
+lazy_load(const struct libevdev *dev, unsigned int what)
+{
+	if (unlikely(dev->lazy_pending & what))
+		return _libevdev_lazy_fetch(dev, what);
+	return 0;
+}
+
 static inline void
 init_event(struct libevdev *dev, struct input_event *ev, int type, int code, int value)
 {
@@ -0,0 +1,394 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+#include "config.h"
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+
+#include "libevdev-int.h"
+#include "libevdev-monitor.h"
+#include "libevdev-util.h"
+#include "libevdev.h"
+
+#define DEFAULT_DIRECTORY "/dev/input"
+
+struct libevdev_monitor {
+	int fd;
+	char *directory;
+	int open_flags;
+	unsigned int init_flags;
+	libevdev_monitor_func_t func;
+	void *data;
+
+	/* the event node numbers reported as added */
+	unsigned int *known;
+	size_t nknown;
+	size_t known_size;
+
+	/* an error lost some changes, rescan on the next dispatch */
+	bool rescan;
+};
+
+/**
+ * @return the N in eventN, or -1 if name is not an event node
+ */
+static int
+event_node_number(const char *name)
+{
+	const char *p;
+	long n = 0;
+
+	if (strncmp(name, "event", 5) != 0 || name[5] == '\0')
+		return -1;
+
+	for (p = name + 5; *p; p++) {
+		if (*p < '0' || *p > '9')
+			return -1;
+		n = n * 10 + (*p - '0');
+		if (n > INT_MAX)
+			return -1;
+	}
+
+	return n;
+}
+
+static ssize_t
+find_known(const struct libevdev_monitor *monitor, unsigned int number)
+{
+	size_t i;
+
+	for (i = 0; i < monitor->nknown; i++) {
+		if (monitor->known[i] == number)
+			return i;
+	}
+
+	return -1;
+}
+
+static int
+add_known(struct libevdev_monitor *monitor, unsigned int number)
+{
+	if (monitor->nknown == monitor->known_size) {
+		size_t size = max(monitor->known_size * 2, (size_t)16);
+		unsigned int *known;
+
+		known = realloc(monitor->known, size * sizeof(*known));
+		if (!known)
+			return -ENOMEM;
+		monitor->known = known;
+		monitor->known_size = size;
+	}
+
+	monitor->known[monitor->nknown++] = number;
+
+	return 0;
+}
+
+static void
+remove_known(struct libevdev_monitor *monitor, size_t idx)
+{
+	monitor->known[idx] = monitor->known[--monitor->nknown];
+}
+
+/**
+ * Open and initialize the given node and pass it to the caller.
+ *
+ * @return 1 if the callback was invoked, 0 if the node could not be
+ * opened or initialized, or a negative errno on failure
+ */
+static int
+monitor_add(struct libevdev_monitor *monitor, const char *name)
+{
+	char path[PATH_MAX];
+	struct libevdev *dev;
+	int number;
+	int fd;
+	int rc;
+
+	number = event_node_number(name);
+	if (number < 0 || find_known(monitor, number) >= 0)
+		return 0;
+
+	snprintf(path, sizeof(path), "%s/%s", monitor->directory, name);
+
+	fd = open(path, monitor->open_flags | O_CLOEXEC);
+	if (fd < 0) {
+		/* EACCES is expected until the permissions are set up,
+		 * we retry on IN_ATTRIB */
+		if (errno != EACCES)
+			log_info(NULL, "%s: failed to open: %s\n", path, strerror(errno));
+		return 0;
+	}
+
+	rc = libevdev_new_from_fd_with_flags(fd, monitor->init_flags, &dev);
+	if (rc < 0) {
+		log_info(NULL, "%s: failed to initialize: %s\n", path, strerror(-rc));
+		close(fd);
+		return 0;
+	}
+
+	rc = add_known(monitor, number);
+	if (rc < 0) {
+		libevdev_free(dev);
+		close(fd);
+		return rc;
+	}
+
+	monitor->func(monitor, LIBEVDEV_MONITOR_ADDED, path, dev, monitor->data);
+
+	return 1;
+}
+
+static int
+monitor_remove(struct libevdev_monitor *monitor, const char *name)
+{
+	char path[PATH_MAX];
+	ssize_t idx;
+	int number;
+
+	number = event_node_number(name);
+	if (number < 0)
+		return 0;
+
+	idx = find_known(monitor, number);
+	if (idx < 0)
+		return 0;
+
+	remove_known(monitor, idx);
+
+	snprintf(path, sizeof(path), "%s/%s", monitor->directory, name);
+	monitor->func(monitor, LIBEVDEV_MONITOR_REMOVED, path, NULL, monitor->data);
+
+	return 1;
+}
+
+/**
+ * Compare the directory against the known nodes, report nodes that
+ * disappeared as removed (if report_removed is true) and new nodes as
+ * added.
+ */
+static int
+monitor_scan(struct libevdev_monitor *monitor, bool report_removed)
+{
+	DIR *dir;
+	struct dirent *entry;
+	bool *present = NULL;
+	size_t nknown = monitor->nknown;
+	int count = 0;
+	int rc;
+	size_t i;
+
+	dir = opendir(monitor->directory);
+	if (!dir)
+		return -errno;
+
+	if (report_removed && nknown > 0) {
+		present = calloc(nknown, sizeof(*present));
+		if (!present) {
+			closedir(dir);
+			return -ENOMEM;
+		}
+	}
+
+	while ((entry = readdir(dir))) {
+		int number = event_node_number(entry->d_name);
+		ssize_t idx;
+
+		if (number < 0)
+			continue;
+
+		/* new nodes are appended, so the first nknown indices
+		 * don't change during the scan */
+		idx = find_known(monitor, number);
+		if (idx >= 0) {
+			if (present && (size_t)idx < nknown)
+				present[idx] = true;
+			continue;
+		}
+
+		rc = monitor_add(monitor, entry->d_name);
+		if (rc < 0) {
+			count = rc;
+			goto out;
+		}
+		count += rc;
+	}
+
+	if (present) {
+		char name[32];
+
+		/* backwards, remove_known() moves the last entry into
+		 * the removed one's place */
+		for (i = nknown; i-- > 0;) {
+			if (present[i])
+				continue;
+			snprintf(name, sizeof(name), "event%u", monitor->known[i]);
+			count += monitor_remove(monitor, name);
+		}
+	}
+
+out:
+	free(present);
+	closedir(dir);
+	return count;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_monitor_new(const char *directory,
+		     int open_flags,
+		     unsigned int init_flags,
+		     libevdev_monitor_func_t func,
+		     void *data,
+		     struct libevdev_monitor **monitor)
+{
+#ifdef __linux__
+	struct libevdev_monitor *m;
+	int rc;
+
+	if (!func) {
+		log_bug(NULL, "monitor callback must not be NULL\n");
+		return -EINVAL;
+	}
+
+	m = calloc(1, sizeof(*m));
+	if (!m)
+		return -ENOMEM;
+
+	m->fd = -1;
+	m->open_flags = open_flags;
+	m->init_flags = init_flags;
+	m->func = func;
+	m->data = data;
+	m->directory = strdup(directory ? directory : DEFAULT_DIRECTORY);
+	if (!m->directory) {
+		rc = -ENOMEM;
+		goto error;
+	}
+
+	m->fd = inotify_init1(IN_NONBLOCK|IN_CLOEXEC);
+	if (m->fd < 0) {
+		rc = -errno;
+		goto error;
+	}
+
+	rc = inotify_add_watch(m->fd, m->directory,
+			       IN_CREATE|IN_DELETE|IN_ATTRIB|IN_MOVED_TO|IN_MOVED_FROM);
+	if (rc < 0) {
+		rc = -errno;
+		goto error;
+	}
+
+	*monitor = m;
+
+	return 0;
+
+error:
+	libevdev_monitor_free(m);
+	return rc;
+#else
+	return -ENOSYS;
+#endif
+}
+
+LIBEVDEV_EXPORT void
+libevdev_monitor_free(struct libevdev_monitor *monitor)
+{
+	if (!monitor)
+		return;
+
+	if (monitor->fd >= 0)
+		close(monitor->fd);
+	free(monitor->directory);
+	free(monitor->known);
+	free(monitor);
+}
+
+LIBEVDEV_EXPORT int
+libevdev_monitor_get_fd(const struct libevdev_monitor *monitor)
+{
+	return monitor->fd;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_monitor_enumerate(struct libevdev_monitor *monitor)
+{
+	return monitor_scan(monitor, false);
+}
+
+LIBEVDEV_EXPORT int
+libevdev_monitor_dispatch(struct libevdev_monitor *monitor)
+{
+#ifdef __linux__
+	char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+	bool pending = false;
+	int count = 0;
+	int error = 0;
+	ssize_t len;
+
+	if (monitor->rescan) {
+		int rc = monitor_scan(monitor, true);
+
+		if (rc < 0)
+			return rc;
+		monitor->rescan = false;
+		count = rc;
+		pending = true;
+	}
+
+	while ((len = read(monitor->fd, buf, sizeof(buf))) > 0) {
+		char *ptr = buf;
+
+		pending = true;
+
+		while (ptr < buf + len) {
+			const struct inotify_event *event = (const void *)ptr;
+			int rc = 0;
+
+			ptr += sizeof(*event) + event->len;
+
+			if (event->mask & IN_Q_OVERFLOW)
+				rc = monitor_scan(monitor, true);
+			else if (event->len == 0)
+				continue;
+			else if (event->mask & (IN_DELETE|IN_MOVED_FROM))
+				rc = monitor_remove(monitor, event->name);
+			else if (event->mask & (IN_CREATE|IN_ATTRIB|IN_MOVED_TO))
+				rc = monitor_add(monitor, event->name);
+
+			/* the rest of the buffer is lost if we stop here,
+			 * keep going and catch up with a rescan */
+			if (rc < 0) {
+				if (!error)
+					error = rc;
+				monitor->rescan = true;
+				continue;
+			}
+			count += rc;
+		}
+	}
+
+	if (len < 0 && errno != EAGAIN)
+		return -errno;
+
+	if (error)
+		return error;
+
+	if (!pending)
+		return -EAGAIN;
+
+	return count;
+#else
+	return -ENOSYS;
+#endif
+}
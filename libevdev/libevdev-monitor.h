@@ -0,0 +1,189 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+#ifndef LIBEVDEV_MONITOR_H
+#define LIBEVDEV_MONITOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <libevdev/libevdev.h>
+
+struct libevdev_monitor;
+
+/**
+ * @defgroup monitor Device hotplug monitoring
+ *
+ * A simple monitor for evdev device nodes being added and removed, for
+ * systems without udev. The monitor watches a directory (usually
+ * /dev/input) with inotify, opens and initializes each new event node and
+ * passes the initialized device to the caller's callback.
+ *
+ * @code
+ * static void
+ * device_changed(struct libevdev_monitor *monitor,
+ *                enum libevdev_monitor_event event,
+ *                const char *devnode,
+ *                struct libevdev *dev,
+ *                void *data)
+ * {
+ *     if (event == LIBEVDEV_MONITOR_ADDED) {
+ *         printf("added %s: %s\n", devnode, libevdev_get_name(dev));
+ *         add_device_to_my_list(dev);
+ *     } else {
+ *         printf("removed %s\n", devnode);
+ *         remove_device_from_my_list(devnode);
+ *     }
+ * }
+ *
+ * ...
+ * rc = libevdev_monitor_new(NULL, O_RDONLY|O_NONBLOCK, 0,
+ *                           device_changed, NULL, &monitor);
+ * libevdev_monitor_enumerate(monitor);
+ *
+ * fds[0].fd = libevdev_monitor_get_fd(monitor);
+ * fds[0].events = POLLIN;
+ * while (poll(fds, 1, -1) > 0)
+ *     libevdev_monitor_dispatch(monitor);
+ * @endcode
+ *
+ * Device nodes are opened and initialized one at a time from within
+ * libevdev_monitor_enumerate() and libevdev_monitor_dispatch(). Callers
+ * handling many devices may use LIBEVDEV_INIT_FLAG_LAZY to make the
+ * initialization cheap.
+ *
+ * The monitor is only available on Linux, elsewhere
+ * libevdev_monitor_new() fails with -ENOSYS.
+ */
+
+/**
+ * @ingroup monitor
+ */
+enum libevdev_monitor_event {
+	LIBEVDEV_MONITOR_ADDED = 1,	/**< A device node was added */
+	LIBEVDEV_MONITOR_REMOVED	/**< A device node was removed */
+};
+
+/**
+ * @ingroup monitor
+ *
+ * Callback for device nodes being added or removed.
+ *
+ * For LIBEVDEV_MONITOR_ADDED, dev is a device initialized from a newly
+ * opened fd. The caller takes ownership of both, i.e. must eventually
+ * close libevdev_get_fd() and free the device with libevdev_free().
+ *
+ * For LIBEVDEV_MONITOR_REMOVED, dev is NULL. Only nodes previously
+ * reported as added are reported as removed.
+ *
+ * @param monitor The monitor
+ * @param event Whether the node was added or removed
+ * @param devnode The full path to the device node, e.g. /dev/input/event3.
+ * The string is only valid for the duration of the callback.
+ * @param dev For LIBEVDEV_MONITOR_ADDED the initialized device, otherwise
+ * NULL
+ * @param data The data pointer passed to libevdev_monitor_new()
+ */
+typedef void (*libevdev_monitor_func_t)(struct libevdev_monitor *monitor,
+					enum libevdev_monitor_event event,
+					const char *devnode,
+					struct libevdev *dev,
+					void *data);
+
+/**
+ * @ingroup monitor
+ *
+ * Create a new monitor for the given directory. The monitor starts
+ * watching immediately, existing devices are only reported after a call
+ * to libevdev_monitor_enumerate().
+ *
+ * @param directory The directory to monitor, or NULL for /dev/input
+ * @param open_flags The flags passed to open() for each new device node,
+ * e.g. O_RDONLY|O_NONBLOCK. O_CLOEXEC is always added.
+ * @param init_flags A bitmask of enum libevdev_init_flag used to
+ * initialize each new device, see libevdev_set_fd_with_flags()
+ * @param func The callback invoked for each added or removed device
+ * @param data Caller-specific data passed to the callback
+ * @param[out] monitor Set to the newly allocated monitor
+ *
+ * @return 0 on success or a negative errno on failure
+ *
+ * @since 1.14
+ */
+int libevdev_monitor_new(const char *directory,
+			 int open_flags,
+			 unsigned int init_flags,
+			 libevdev_monitor_func_t func,
+			 void *data,
+			 struct libevdev_monitor **monitor);
+
+/**
+ * @ingroup monitor
+ *
+ * Stop monitoring and free all resources associated with the monitor.
+ * Devices already passed to the caller are not affected.
+ *
+ * @param monitor The monitor to free, may be NULL
+ *
+ * @since 1.14
+ */
+void libevdev_monitor_free(struct libevdev_monitor *monitor);
+
+/**
+ * @ingroup monitor
+ *
+ * @param monitor The monitor
+ *
+ * @return The file descriptor to poll for readability. When readable,
+ * call libevdev_monitor_dispatch(). The fd is non-blocking and must not
+ * be closed by the caller.
+ *
+ * @since 1.14
+ */
+int libevdev_monitor_get_fd(const struct libevdev_monitor *monitor);
+
+/**
+ * @ingroup monitor
+ *
+ * Report all event nodes currently present in the directory as added. Nodes
+ * that have already been reported are skipped, so this function may be
+ * called more than once.
+ *
+ * @param monitor The monitor
+ *
+ * @return The number of devices reported or a negative errno on failure
+ *
+ * @since 1.14
+ */
+int libevdev_monitor_enumerate(struct libevdev_monitor *monitor);
+
+/**
+ * @ingroup monitor
+ *
+ * Process pending changes to the directory and invoke the callback for
+ * each added or removed device node.
+ *
+ * A node that cannot be opened when it appears (e.g. because its
+ * permissions have not been set up yet) is retried whenever its
+ * attributes change.
+ *
+ * @param monitor The monitor
+ *
+ * @return The number of callbacks invoked, or a negative errno on failure.
+ * -EAGAIN is returned if there were no pending changes. On failure, the
+ * remaining changes are still processed, and the directory is rescanned
+ * on the next call to catch up with any change that was missed. The
+ * callback may have been invoked even if an error is returned.
+ *
+ * @since 1.14
+ */
+int libevdev_monitor_dispatch(struct libevdev_monitor *monitor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBEVDEV_MONITOR_H */
@@ -5,6 +5,8 @@
 
 #include "config.h"
 #include <errno.h>
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
@@ -20,36 +22,61 @@ struct name_lookup {
 	size_t len;
 };
 
-static int cmp_entry(const void *vlookup, const void *ventry)
+/* Must match name_hash() in make-event-names.py */
+static inline uint32_t
+name_hash(uint32_t seed, const char *name, size_t len)
 {
-	const struct name_lookup *lookup = vlookup;
-	const struct name_entry *entry = ventry;
-	int r;
+	uint32_t h = 0x811c9dc5 ^ seed;
+	size_t i;
 
-	r = strncmp(lookup->name, entry->name, lookup->len);
-	if (!r) {
-		if (entry->name[lookup->len])
-			r = -1;
-		else
-			r = 0;
+	for (i = 0; i < len; i++) {
+		h ^= (unsigned char)name[i];
+		h *= 0x01000193;
 	}
 
-	return r;
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35;
+	h ^= h >> 16;
+
+	return h;
 }
 
+/**
+ * Look up the name in one of the generated tables. Each table comes with
+ * a minimal perfect hash: array##_hash_g maps the bucket of the name to
+ * either a seed for the second hash or, if negative, directly to a slot,
+ * array##_hash_index maps the slot to the table entry. Names not in the
+ * table hash to some entry too, so the name is compared at the end.
+ */
 static const struct name_entry*
-lookup_name(const struct name_entry *array, size_t asize,
-	    struct name_lookup *lookup)
+lookup_hashed(const struct name_entry *array, const short *g,
+	      const unsigned short *index, size_t asize,
+	      const struct name_lookup *lookup)
 {
 	const struct name_entry *entry;
-
-	entry = bsearch(lookup, array, asize, sizeof(*array), cmp_entry);
-	if (!entry)
+	uint32_t slot;
+	int d;
+
+	d = g[name_hash(0, lookup->name, lookup->len) % asize];
+	if (d < 0)
+		slot = -d - 1;
+	else
+		slot = name_hash(d, lookup->name, lookup->len) % asize;
+
+	entry = &array[index[slot]];
+	if (entry->len != lookup->len ||
+	    memcmp(lookup->name, &names_blob[entry->name], lookup->len) != 0)
 		return NULL;
 
 	return entry;
 }
 
+#define lookup_name(array, lookup) \
+	lookup_hashed(array, array##_hash_g, array##_hash_index, \
+		      ARRAY_LENGTH(array), lookup)
+
 LIBEVDEV_EXPORT int
 libevdev_event_type_from_name(const char *name)
 {
@@ -65,40 +92,11 @@ libevdev_event_type_from_name_n(const char *name, size_t len)
 	lookup.name = name;
 	lookup.len = len;
 
-	entry = lookup_name(ev_names, ARRAY_LENGTH(ev_names), &lookup);
+	entry = lookup_name(ev_names, &lookup);
 
 	return entry ? (int)entry->value : -1;
 }
 
-static int type_from_prefix(const char *name, ssize_t len)
-{
-	const char *e;
-	size_t i;
-	ssize_t l;
-
-	/* MAX_ is not allowed, even though EV_MAX exists */
-	if (startswith(name, len, "MAX_", 4))
-		return -1;
-	/* BTN_ is special as there is no EV_BTN type */
-	if (startswith(name, len, "BTN_", 4))
-		return EV_KEY;
-	/* FF_STATUS_ is special as FF_ is a prefix of it, so test it first */
-	if (startswith(name, len, "FF_STATUS_", 10))
-		return EV_FF_STATUS;
-
-	for (i = 0; i < ARRAY_LENGTH(ev_names); ++i) {
-		/* skip EV_ prefix so @e is suffix of [EV_]XYZ */
-		e = &ev_names[i].name[3];
-		l = strlen(e);
-
-		/* compare prefix and test for trailing _ */
-		if (len > l && startswith(name, len, e, l) && name[l] == '_')
-			return ev_names[i].value;
-	}
-
-	return -1;
-}
-
 LIBEVDEV_EXPORT int
 libevdev_event_code_from_name(unsigned int type, const char *name)
 {
@@ -113,7 +111,7 @@ libevdev_event_code_from_name_n(unsigned int type, const char *name, size_t len)
 	int real_type;
 
 	/* verify that @name is really of type @type */
-	real_type = type_from_prefix(name, len);
+	real_type = event_type_from_prefix(name, len);
 	if (real_type < 0 || (unsigned int)real_type != type)
 		return -1;
 
@@ -121,7 +119,7 @@ libevdev_event_code_from_name_n(unsigned int type, const char *name, size_t len)
 	lookup.name = name;
 	lookup.len = len;
 
-	entry = lookup_name(code_names, ARRAY_LENGTH(code_names), &lookup);
+	entry = lookup_name(code_names, &lookup);
 
 	return entry ? (int)entry->value : -1;
 }
@@ -144,7 +142,7 @@ libevdev_event_value_from_name_n(unsigned int type, unsigned int code, const cha
 	lookup.name = name;
 	lookup.len = len;
 
-	entry = lookup_name(tool_type_names, ARRAY_LENGTH(tool_type_names), &lookup);
+	entry = lookup_name(tool_type_names, &lookup);
 
 	return entry ? (int)entry->value : -1;
 }
@@ -164,7 +162,7 @@ libevdev_property_from_name_n(const char *name, size_t len)
 	lookup.name = name;
 	lookup.len = len;
 
-	entry = lookup_name(prop_names, ARRAY_LENGTH(prop_names), &lookup);
+	entry = lookup_name(prop_names, &lookup);
 
 	return entry ? (int)entry->value : -1;
 }
@@ -185,7 +183,7 @@ libevdev_event_code_from_code_name_n(const char *name, size_t len)
 	lookup.name = name;
 	lookup.len = len;
 
-	entry = lookup_name(code_names, ARRAY_LENGTH(code_names), &lookup);
+	entry = lookup_name(code_names, &lookup);
 
 	return entry ? (int)entry->value : -1;
 }
@@ -207,7 +205,167 @@ libevdev_event_type_from_code_name_n(const char *name, size_t len)
 	lookup.name = name;
 	lookup.len = len;
 
-	entry = lookup_name(code_names, ARRAY_LENGTH(code_names), &lookup);
+	entry = lookup_name(code_names, &lookup);
+
+	return entry ? event_type_from_prefix(name, len) : -1;
+}
+
+LIBEVDEV_EXPORT size_t
+libevdev_event_codes_from_code_names(const char * const *names, size_t count,
+				     int *types, int *codes)
+{
+	size_t found = 0;
+	size_t i;
+
+	for (i = 0; i < count; i++) {
+		struct name_lookup lookup;
+		const struct name_entry *entry;
+		int type = -1, code = -1;
+
+		lookup.name = names[i];
+		lookup.len = strlen(names[i]);
+
+		entry = lookup_name(code_names, &lookup);
+		if (entry) {
+			type = event_type_from_prefix(lookup.name, lookup.len);
+			code = entry->value;
+			found++;
+		}
+
+		if (types)
+			types[i] = type;
+		codes[i] = code;
+	}
+
+	return found;
+}
+
+LIBEVDEV_EXPORT size_t
+libevdev_event_codes_get_names(const unsigned int *types,
+			       const unsigned int *codes,
+			       size_t count,
+			       const char **names)
+{
+	size_t found = 0;
+	size_t i;
+
+	for (i = 0; i < count; i++) {
+		unsigned short offset = 0;
+
+		if (types[i] <= EV_MAX && ev_max[types[i]] != -1 &&
+		    codes[i] <= (unsigned int)ev_max[types[i]])
+			offset = code_map[event_type_map[types[i]] + codes[i]];
+
+		names[i] = name_from_offset(offset);
+		if (offset)
+			found++;
+	}
+
+	return found;
+}
+
+struct format_buffer {
+	char *buf;
+	size_t size;
+	size_t len; /* may exceed size, like snprintf */
+};
+
+static inline void
+format_append(struct format_buffer *b, const char *str, size_t len)
+{
+	if (b->len < b->size)
+		memcpy(b->buf + b->len, str, min(len, b->size - b->len));
+	b->len += len;
+}
+
+static inline void
+format_char(struct format_buffer *b, char c)
+{
+	if (b->len < b->size)
+		b->buf[b->len] = c;
+	b->len++;
+}
+
+/* Append the decimal value, zero-padded to at least width digits */
+static void
+format_uint(struct format_buffer *b, unsigned long value, size_t width)
+{
+	char digits[24];
+	size_t n = 0;
+
+	do {
+		digits[sizeof(digits) - ++n] = '0' + value % 10;
+		value /= 10;
+	} while (value || n < width);
+
+	format_append(b, &digits[sizeof(digits) - n], n);
+}
+
+static void
+format_int(struct format_buffer *b, long value)
+{
+	if (value < 0) {
+		format_char(b, '-');
+		format_uint(b, -(unsigned long)value, 0);
+	} else {
+		format_uint(b, value, 0);
+	}
+}
+
+/* Append the name, or the number if offset is 0 (i.e. no name) */
+static void
+format_name(struct format_buffer *b, unsigned short offset,
+	    unsigned int value, unsigned int flags)
+{
+	if (!offset) {
+		format_uint(b, value, 0);
+		return;
+	}
+
+	format_append(b, name_from_offset(offset), name_length(offset));
+	if (flags & LIBEVDEV_FORMAT_FLAG_NUMERIC) {
+		format_char(b, '(');
+		format_uint(b, value, 0);
+		format_char(b, ')');
+	}
+}
+
+LIBEVDEV_EXPORT int
+libevdev_event_format(char *buf, size_t len,
+		      const struct input_event *ev,
+		      unsigned int flags)
+{
+	struct format_buffer b = { buf, len, 0 };
+	unsigned short type_name = 0, code_name = 0;
+	int max;
+
+	if (flags & ~(LIBEVDEV_FORMAT_FLAG_TIMESTAMP|LIBEVDEV_FORMAT_FLAG_NUMERIC)) {
+		log_bug(NULL, "invalid flags %#x\n", flags);
+		return -EINVAL;
+	}
+
+	if (ev->type <= EV_MAX) {
+		type_name = ev_map[ev->type];
+		max = ev_max[ev->type];
+		if (max != -1 && ev->code <= max)
+			code_name = code_map[event_type_map[ev->type] + ev->code];
+	}
+
+	if (flags & LIBEVDEV_FORMAT_FLAG_TIMESTAMP) {
+		format_int(&b, ev->input_event_sec);
+		format_char(&b, '.');
+		format_uint(&b, ev->input_event_usec, 6);
+		format_char(&b, ' ');
+	}
+
+	format_name(&b, type_name, ev->type, flags);
+	format_char(&b, ' ');
+	format_name(&b, code_name, ev->code, flags);
+	format_char(&b, ' ');
+	format_int(&b, ev->value);
+
+	if (len > 0)
+		buf[min(b.len, len - 1)] = '\0';
 
-	return entry ? type_from_prefix(name, len) : -1;
+	return min(b.len, (size_t)INT_MAX);
 }
@@ -3,11 +3,38 @@
  * Copyright © 2013 Red Hat, Inc.
  */
 
+#include "libevdev-uinput.h"
+
+/* a state change made by the frame being committed, undone if the
+ * write fails */
+struct uinput_frame_undo {
+	unsigned short type;
+	unsigned short code;
+	int slot; /**< -1 for anything but ABS_MT_* values */
+	int value; /**< the previous value */
+};
+
 struct libevdev_uinput {
 	int fd; /**< file descriptor to uinput */
 	int fd_is_managed; /**< do we need to close it? */
 	char *name; /**< device name */
 	char *syspath; /**< /sys path */
 	char *devnode; /**< device node */
-	time_t ctime[2]; /**< before/after UI_DEV_CREATE */
+	char *phys; /**< unique phys to find the device without UI_GET_SYSNAME */
+
+	struct libevdev *state; /**< device state as emitted by frame commits */
+	struct input_event *frame; /**< events added since the last commit */
+	size_t frame_len;
+	size_t frame_size;
+	struct input_event *frame_out; /**< [frame_size * 2 + 1] filtered events */
+	struct uinput_frame_undo *frame_undo; /**< [frame_size * 2] */
+
+	int loopback_fd; /**< our own reader on devnode for kernel timestamps */
+	struct input_event *replay; /**< events of the frame being replayed */
+	size_t replay_size;
+	bool replay_started;
+	int64_t replay_base_us; /**< recorded time of the first replayed frame */
+
+	libevdev_uinput_ff_func_t ff_func;
+	void *ff_data;
 };
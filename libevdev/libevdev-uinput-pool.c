@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+#include "config.h"
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libevdev-int.h"
+#include "libevdev-uinput-int.h"
+#include "libevdev-uinput.h"
+#include "libevdev-util.h"
+#include "libevdev.h"
+
+struct pool_entry {
+	uint64_t fingerprint;
+	struct libevdev_uinput *uinput;
+};
+
+struct libevdev_uinput_pool {
+	unsigned int max_idle;
+
+	/* idle devices, most recently released last */
+	struct pool_entry *idle;
+	size_t nidle;
+	size_t idle_size;
+};
+
+static inline uint64_t
+fnv1a(uint64_t hash, const void *data, size_t len)
+{
+	const unsigned char *p = data;
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		hash ^= p[i];
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+/**
+ * Everything libevdev_uinput_create_from_device() passes to the kernel:
+ * name, ids, capabilities and the axis ranges. Axis values are not part
+ * of the fingerprint.
+ */
+static uint64_t
+fingerprint(const struct libevdev *dev)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	const char *name = libevdev_get_name(dev);
+	unsigned int code;
+
+	hash = fnv1a(hash, name, strlen(name) + 1);
+	hash = fnv1a(hash, &dev->ids, sizeof(dev->ids));
+	hash = fnv1a(hash, dev->bits, sizeof(dev->bits));
+	hash = fnv1a(hash, dev->props, sizeof(dev->props));
+	hash = fnv1a(hash, dev->key_bits, sizeof(dev->key_bits));
+	hash = fnv1a(hash, dev->rel_bits, sizeof(dev->rel_bits));
+	hash = fnv1a(hash, dev->abs_bits, sizeof(dev->abs_bits));
+	hash = fnv1a(hash, dev->led_bits, sizeof(dev->led_bits));
+	hash = fnv1a(hash, dev->msc_bits, sizeof(dev->msc_bits));
+	hash = fnv1a(hash, dev->sw_bits, sizeof(dev->sw_bits));
+	hash = fnv1a(hash, dev->ff_bits, sizeof(dev->ff_bits));
+	hash = fnv1a(hash, dev->snd_bits, sizeof(dev->snd_bits));
+
+	for (code = 0; code <= ABS_MAX; code++) {
+		const struct input_absinfo *abs = &dev->abs_info[code];
+
+		if (!bit_is_set(dev->abs_bits, code))
+			continue;
+
+		hash = fnv1a(hash, &abs->minimum, sizeof(abs->minimum));
+		hash = fnv1a(hash, &abs->maximum, sizeof(abs->maximum));
+		hash = fnv1a(hash, &abs->fuzz, sizeof(abs->fuzz));
+		hash = fnv1a(hash, &abs->flat, sizeof(abs->flat));
+		hash = fnv1a(hash, &abs->resolution, sizeof(abs->resolution));
+	}
+
+	return hash;
+}
+
+static bool
+same_device(const struct libevdev *a, const struct libevdev *b)
+{
+	unsigned int code;
+
+#define same(field_) (memcmp(&a->field_, &b->field_, sizeof(a->field_)) == 0)
+	if (strcmp(libevdev_get_name(a), libevdev_get_name(b)) != 0 ||
+	    !same(ids) || !same(bits) || !same(props) ||
+	    !same(key_bits) || !same(rel_bits) || !same(abs_bits) ||
+	    !same(led_bits) || !same(msc_bits) || !same(sw_bits) ||
+	    !same(ff_bits) || !same(snd_bits))
+		return false;
+#undef same
+
+	for (code = 0; code <= ABS_MAX; code++) {
+		const struct input_absinfo *aa = &a->abs_info[code],
+					   *ab = &b->abs_info[code];
+
+		if (!bit_is_set(a->abs_bits, code))
+			continue;
+
+		if (aa->minimum != ab->minimum ||
+		    aa->maximum != ab->maximum ||
+		    aa->fuzz != ab->fuzz ||
+		    aa->flat != ab->flat ||
+		    aa->resolution != ab->resolution)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * Release all keys and buttons and end all touches.
+ */
+static int
+reset_device(struct libevdev_uinput *uinput_dev)
+{
+	const struct libevdev *state = uinput_dev->state;
+	unsigned int code;
+	int slot;
+	int rc = 0;
+
+	libevdev_uinput_frame_begin(uinput_dev);
+
+	for (code = 0; code <= KEY_MAX && rc == 0; code++) {
+		if (bit_is_set(state->key_values, code))
+			rc = libevdev_uinput_frame_add(uinput_dev, EV_KEY, code, 0);
+	}
+
+	if (libevdev_has_event_code(state, EV_ABS, ABS_MT_TRACKING_ID)) {
+		for (slot = 0; slot < state->num_slots && rc == 0; slot++) {
+			if (libevdev_get_slot_value(state, slot, ABS_MT_TRACKING_ID) == -1)
+				continue;
+
+			rc = libevdev_uinput_frame_add(uinput_dev, EV_ABS, ABS_MT_SLOT, slot);
+			if (rc == 0)
+				rc = libevdev_uinput_frame_add(uinput_dev, EV_ABS,
+							       ABS_MT_TRACKING_ID, -1);
+		}
+	}
+
+	if (rc == 0)
+		rc = libevdev_uinput_frame_commit(uinput_dev);
+
+	return rc;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_uinput_pool_new(unsigned int max_idle,
+			 struct libevdev_uinput_pool **pool)
+{
+	struct libevdev_uinput_pool *p;
+
+	p = calloc(1, sizeof(*p));
+	if (!p)
+		return -ENOMEM;
+
+	p->max_idle = max_idle;
+	*pool = p;
+
+	return 0;
+}
+
+LIBEVDEV_EXPORT void
+libevdev_uinput_pool_free(struct libevdev_uinput_pool *pool)
+{
+	size_t i;
+
+	if (!pool)
+		return;
+
+	for (i = 0; i < pool->nidle; i++)
+		libevdev_uinput_destroy(pool->idle[i].uinput);
+	free(pool->idle);
+	free(pool);
+}
+
+LIBEVDEV_EXPORT int
+libevdev_uinput_pool_acquire(struct libevdev_uinput_pool *pool,
+			     const struct libevdev *dev,
+			     struct libevdev_uinput **uinput_dev)
+{
+	uint64_t fp;
+	size_t i;
+
+	lazy_load(dev, LAZY_CAPS|LAZY_ABS);
+
+	fp = fingerprint(dev);
+
+	for (i = pool->nidle; i-- > 0;) {
+		struct pool_entry *e = &pool->idle[i];
+
+		if (e->fingerprint != fp || !same_device(dev, e->uinput->state))
+			continue;
+
+		*uinput_dev = e->uinput;
+		/* keep the rest in release order */
+		pool->nidle--;
+		memmove(e, e + 1, (pool->nidle - i) * sizeof(*e));
+		return 0;
+	}
+
+	return libevdev_uinput_create_from_device(dev,
+						  LIBEVDEV_UINPUT_OPEN_MANAGED,
+						  uinput_dev);
+}
+
+LIBEVDEV_EXPORT void
+libevdev_uinput_pool_release(struct libevdev_uinput_pool *pool,
+			     struct libevdev_uinput *uinput_dev)
+{
+	struct pool_entry *e;
+
+	if (!uinput_dev)
+		return;
+
+	if (pool->nidle >= pool->max_idle || reset_device(uinput_dev) != 0)
+		goto destroy;
+
+	if (pool->nidle == pool->idle_size) {
+		size_t size = max(pool->idle_size * 2, (size_t)8);
+		struct pool_entry *idle;
+
+		idle = realloc(pool->idle, size * sizeof(*idle));
+		if (!idle)
+			goto destroy;
+		pool->idle = idle;
+		pool->idle_size = size;
+	}
+
+	uinput_dev->replay_started = false;
+	libevdev_uinput_set_ff_handler(uinput_dev, NULL, NULL);
+
+	e = &pool->idle[pool->nidle++];
+	e->fingerprint = fingerprint(uinput_dev->state);
+	e->uinput = uinput_dev;
+
+	return;
+
+destroy:
+	libevdev_uinput_destroy(uinput_dev);
+}
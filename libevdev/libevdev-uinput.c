@@ -7,13 +7,18 @@
 #include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <linux/uinput.h>
 #include <poll.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <time.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
 
 #include "libevdev-int.h"
 #include "libevdev-uinput-int.h"
@@ -38,6 +43,7 @@ alloc_uinput_device(const char *name)
 	if (uinput_dev) {
 		uinput_dev->name = strdup(name);
 		uinput_dev->fd = -1;
+		uinput_dev->loopback_fd = -1;
 	}
 
 	return uinput_dev;
@@ -98,27 +104,40 @@ set_evbits(const struct libevdev *dev, int fd, struct uinput_user_dev *uidev)
 				    goto out;
 		}
 
-		for (code = 0; code <= (unsigned int)max; code++) {
-			if (!libevdev_has_event_code(dev, type, code))
-				continue;
+		/* walk the set bits only, a keyboard has a few hundred
+		 * codes out of KEY_MAX */
+		for (code = 0; code <= (unsigned int)max; code = (code | (LONG_BITS - 1)) + 1) {
+			unsigned long word = mask[code / LONG_BITS];
+
+			while (word) {
+				unsigned int c = code + ctz_long(word);
 
-			rc = ioctl(fd, uinput_bit, code);
-			if (rc == -1)
-				goto out;
+				word &= word - 1;
+				if (c > (unsigned int)max)
+					break;
+
+				/* UI_ABS_SETUP sets the bit itself */
+				if (type != EV_ABS || uidev != NULL) {
+					rc = ioctl(fd, uinput_bit, c);
+					if (rc == -1)
+						goto out;
+				}
+
+				if (type != EV_ABS)
+					continue;
 
-			if (type == EV_ABS) {
 				if (uidev == NULL) {
-					rc = set_abs(dev, fd, code);
+					rc = set_abs(dev, fd, c);
 					if (rc != 0)
 						goto out;
 				} else {
 					const struct input_absinfo *abs =
-						libevdev_get_abs_info(dev, code);
+						libevdev_get_abs_info(dev, c);
 
-					uidev->absmin[code] = abs->minimum;
-					uidev->absmax[code] = abs->maximum;
-					uidev->absfuzz[code] = abs->fuzz;
-					uidev->absflat[code] = abs->flat;
+					uidev->absmin[c] = abs->minimum;
+					uidev->absmax[c] = abs->maximum;
+					uidev->absfuzz[c] = abs->fuzz;
+					uidev->absflat[c] = abs->flat;
 					/* uinput has no resolution in the
 					 * device struct */
 				}
@@ -190,6 +209,12 @@ fetch_syspath_and_devnode(struct libevdev_uinput *uinput_dev)
 #undef DEV_INPUT_DIR
 }
 
+static inline int
+prepare_syspath_lookup(struct libevdev_uinput *uinput_dev, int fd)
+{
+	return 0;
+}
+
 #else /* !__FreeBSD__ */
 
 static int is_event_device(const struct dirent *dent) {
@@ -224,6 +249,30 @@ static int is_input_device(const struct dirent *dent) {
 	return strncmp("input", dent->d_name, 5) == 0;
 }
 
+/**
+ * Prepare for fetch_syspath_and_devnode() before UI_DEV_CREATE. Before
+ * the device is created, UI_GET_SYSNAME fails with ENOENT where it is
+ * supported. Where it isn't, give the device a phys that is unique to
+ * this uinput device so we can find it in sysfs afterwards.
+ */
+static int
+prepare_syspath_lookup(struct libevdev_uinput *uinput_dev, int fd)
+{
+	char buf[1];
+
+	if (ioctl(fd, UI_GET_SYSNAME(sizeof(buf)), buf) == -1 && errno == ENOENT)
+		return 0;
+
+	if (asprintf(&uinput_dev->phys, "libevdev-uinput/%d/%p",
+		     (int)getpid(), (void*)uinput_dev) == -1) {
+		uinput_dev->phys = NULL;
+		errno = ENOMEM;
+		return -1;
+	}
+
+	return ioctl(fd, UI_SET_PHYS, uinput_dev->phys);
+}
+
 static int
 fetch_syspath_and_devnode(struct libevdev_uinput *uinput_dev)
 {
@@ -232,11 +281,15 @@ fetch_syspath_and_devnode(struct libevdev_uinput *uinput_dev)
 	int ndev, i;
 	int rc;
 	char buf[sizeof(SYS_INPUT_DIR) + 64] = SYS_INPUT_DIR;
+	char phys[128];
+
+	if (!uinput_dev->phys) {
+		rc = ioctl(uinput_dev->fd,
+			   UI_GET_SYSNAME(sizeof(buf) - strlen(SYS_INPUT_DIR)),
+			   &buf[strlen(SYS_INPUT_DIR)]);
+		if (rc == -1)
+			return -1;
 
-	rc = ioctl(uinput_dev->fd,
-		   UI_GET_SYSNAME(sizeof(buf) - strlen(SYS_INPUT_DIR)),
-		   &buf[strlen(SYS_INPUT_DIR)]);
-	if (rc != -1) {
 		uinput_dev->syspath = strdup(buf);
 		uinput_dev->devnode = fetch_device_node(buf);
 		return 0;
@@ -246,55 +299,36 @@ fetch_syspath_and_devnode(struct libevdev_uinput *uinput_dev)
 	if (ndev <= 0)
 		return -1;
 
-	for (i = 0; i < ndev; i++) {
+	for (i = 0; i < ndev && !uinput_dev->syspath; i++) {
 		int fd, len;
-		struct stat st;
 
-		rc = snprintf(buf, sizeof(buf), "%s%s/name",
+		rc = snprintf(buf, sizeof(buf), "%s%s/phys",
 			      SYS_INPUT_DIR,
 			      namelist[i]->d_name);
-		if (rc < 0 || (size_t)rc >= sizeof(buf)) {
+		if (rc < 0 || (size_t)rc >= sizeof(buf))
 			continue;
-		}
 
-		/* created within time frame */
 		fd = open(buf, O_RDONLY);
 		if (fd < 0)
 			continue;
 
-		/* created before UI_DEV_CREATE, or after it finished */
-		if (fstat(fd, &st) == -1 ||
-		    st.st_ctime < uinput_dev->ctime[0] ||
-		    st.st_ctime > uinput_dev->ctime[1]) {
-			close(fd);
-			continue;
-		}
-
-		len = read(fd, buf, sizeof(buf));
+		len = read(fd, phys, sizeof(phys));
 		close(fd);
 		if (len <= 0)
 			continue;
 
-		buf[len - 1] = '\0'; /* file contains \n */
-		if (strcmp(buf, uinput_dev->name) == 0) {
-			if (uinput_dev->syspath) {
-				/* FIXME: could descend into bit comparison here */
-				log_info(NULL, "multiple identical devices found. syspath is unreliable\n");
-				break;
-			}
-
-			rc = snprintf(buf, sizeof(buf), "%s%s",
-				      SYS_INPUT_DIR,
-				      namelist[i]->d_name);
+		phys[len - 1] = '\0'; /* file contains \n */
+		if (strcmp(phys, uinput_dev->phys) != 0)
+			continue;
 
-			if (rc < 0 || (size_t)rc >= sizeof(buf)) {
-				log_error(NULL, "Invalid syspath, syspath is unreliable\n");
-				break;
-			}
+		rc = snprintf(buf, sizeof(buf), "%s%s",
+			      SYS_INPUT_DIR,
+			      namelist[i]->d_name);
+		if (rc < 0 || (size_t)rc >= sizeof(buf))
+			continue;
 
-			uinput_dev->syspath = strdup(buf);
-			uinput_dev->devnode = fetch_device_node(buf);
-		}
+		uinput_dev->syspath = strdup(buf);
+		uinput_dev->devnode = fetch_device_node(buf);
 	}
 
 	for (i = 0; i < ndev; i++)
@@ -319,6 +353,7 @@ uinput_create_write(const struct libevdev *dev, int fd)
 	uidev.id.product = libevdev_get_id_product(dev);
 	uidev.id.bustype = libevdev_get_id_bustype(dev);
 	uidev.id.version = libevdev_get_id_version(dev);
+	uidev.ff_effects_max = libevdev_has_event_type(dev, EV_FF) ? 10 : 0;
 
 	if (set_evbits(dev, fd, &uidev) != 0)
 		goto error;
@@ -339,6 +374,35 @@ error:
 	return -errno;
 }
 
+/**
+ * The uinput_user_dev written by uinput_create_write() has no axis
+ * resolution or value. Where neither is needed it sets up all axes in one
+ * write() instead of one UI_ABS_SETUP ioctl per axis.
+ *
+ * @return true if the device needs UI_ABS_SETUP
+ */
+static bool
+needs_abs_setup(const struct libevdev *dev)
+{
+	unsigned int code;
+
+	if (!libevdev_has_event_type(dev, EV_ABS))
+		return false;
+
+	for (code = 0; code <= ABS_MAX; code++) {
+		const struct input_absinfo *abs;
+
+		if (!libevdev_has_event_code(dev, EV_ABS, code))
+			continue;
+
+		abs = libevdev_get_abs_info(dev, code);
+		if (abs->resolution != 0 || abs->value != 0)
+			return true;
+	}
+
+	return false;
+}
+
 static int
 uinput_create_DEV_SETUP(const struct libevdev *dev, int fd,
 			struct libevdev_uinput *new_device)
@@ -366,6 +430,51 @@ error:
 	return -errno;
 }
 
+/**
+ * Set up the state the frame API filters against: a copy of the device
+ * with the values a newly created uinput device starts with. The kernel
+ * only takes the initial axis values from UI_ABS_SETUP, the legacy setup
+ * leaves them at zero.
+ */
+static int
+init_frame_state(struct libevdev_uinput *uinput_dev,
+		 const struct libevdev *dev,
+		 bool abs_values)
+{
+	struct libevdev *state;
+	unsigned int code;
+	int slot;
+	int rc;
+
+	rc = libevdev_clone(dev, &state);
+	if (rc < 0)
+		return rc;
+
+	memset(state->key_values, 0, sizeof(state->key_values));
+	memset(state->led_values, 0, sizeof(state->led_values));
+	memset(state->sw_values, 0, sizeof(state->sw_values));
+
+	if (!abs_values) {
+		for (code = 0; code < ABS_CNT; code++)
+			state->abs_info[code].value = 0;
+	}
+
+	for (slot = 0; slot < state->num_slots; slot++) {
+		for (code = ABS_MT_MIN; code <= ABS_MT_MAX; code++) {
+			if (code == ABS_MT_SLOT ||
+			    !libevdev_has_event_code(state, EV_ABS, code))
+				continue;
+			libevdev_set_slot_value(state, slot, code,
+						code == ABS_MT_TRACKING_ID ? -1 : 0);
+		}
+	}
+	state->current_slot = 0;
+
+	uinput_dev->state = state;
+
+	return 0;
+}
+
 LIBEVDEV_EXPORT int
 libevdev_uinput_create_from_device(const struct libevdev *dev, int fd, struct libevdev_uinput** uinput_dev)
 {
@@ -373,6 +482,7 @@ libevdev_uinput_create_from_device(const struct libevdev *dev, int fd, struct li
 	struct libevdev_uinput *new_device;
 	int close_fd_on_error = (fd == LIBEVDEV_UINPUT_OPEN_MANAGED);
 	unsigned int uinput_version = 0;
+	bool dev_setup;
 
 	new_device = alloc_uinput_device(libevdev_get_name(dev));
 	if (!new_device)
@@ -390,8 +500,10 @@ libevdev_uinput_create_from_device(const struct libevdev *dev, int fd, struct li
 		goto error;
 	}
 
-	if (ioctl(fd, UI_GET_VERSION, &uinput_version) == 0 &&
-	    uinput_version >= 5)
+	dev_setup = needs_abs_setup(dev) &&
+		    ioctl(fd, UI_GET_VERSION, &uinput_version) == 0 &&
+		    uinput_version >= 5;
+	if (dev_setup)
 		rc = uinput_create_DEV_SETUP(dev, fd, new_device);
 	else
 		rc = uinput_create_write(dev, fd);
@@ -399,20 +511,19 @@ libevdev_uinput_create_from_device(const struct libevdev *dev, int fd, struct li
 	if (rc != 0)
 		goto error;
 
-	/* ctime notes time before/after ioctl to help us filter out devices
-	   when traversing /sys/devices/virtual/input to find the device
-	   node.
+	rc = init_frame_state(new_device, dev, dev_setup);
+	if (rc != 0) {
+		errno = -rc;
+		goto error;
+	}
 
-	   this is in seconds, so ctime[0]/[1] will almost always be
-	   identical but /sys doesn't give us sub-second ctime so...
-	 */
-	new_device->ctime[0] = time(NULL);
+	if (prepare_syspath_lookup(new_device, fd) != 0)
+		goto error;
 
 	rc = ioctl(fd, UI_DEV_CREATE, NULL);
 	if (rc == -1)
 		goto error;
 
-	new_device->ctime[1] = time(NULL);
 	new_device->fd = fd;
 
 	if (fetch_syspath_and_devnode(new_device) == -1) {
@@ -444,8 +555,16 @@ libevdev_uinput_destroy(struct libevdev_uinput *uinput_dev)
 		if (uinput_dev->fd_is_managed)
 			close(uinput_dev->fd);
 	}
+	if (uinput_dev->loopback_fd >= 0)
+		close(uinput_dev->loopback_fd);
+	free(uinput_dev->replay);
+	libevdev_free(uinput_dev->state);
+	free(uinput_dev->frame);
+	free(uinput_dev->frame_out);
+	free(uinput_dev->frame_undo);
 	free(uinput_dev->syspath);
 	free(uinput_dev->devnode);
+	free(uinput_dev->phys);
 	free(uinput_dev->name);
 	free(uinput_dev);
 }
@@ -462,6 +581,151 @@ libevdev_uinput_get_devnode(struct libevdev_uinput *uinput_dev)
 	return uinput_dev->devnode;
 }
 
+static int64_t
+now_ms(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_uinput_wait_devnode(const struct libevdev_uinput *uinput_dev,
+			     int timeout_ms)
+{
+	const char *devnode = uinput_dev->devnode;
+	struct pollfd fds = { .fd = -1, .events = POLLIN };
+	int64_t deadline = now_ms() + timeout_ms;
+	int rc = 0;
+
+	if (!devnode)
+		return -ENODEV;
+
+#ifdef __linux__
+	/* watch first so we can't miss the node between the check and the
+	 * poll. If the directory doesn't exist yet we fall back to
+	 * checking periodically */
+	fds.fd = inotify_init1(IN_NONBLOCK|IN_CLOEXEC);
+	if (fds.fd >= 0) {
+		char dir[PATH_MAX];
+		const char *slash = strrchr(devnode, '/');
+
+		snprintf(dir, sizeof(dir), "%.*s", (int)(slash - devnode), devnode);
+		if (inotify_add_watch(fds.fd, dir, IN_CREATE|IN_MOVED_TO) < 0) {
+			close(fds.fd);
+			fds.fd = -1;
+		}
+	}
+#endif
+
+	while (access(devnode, F_OK) != 0) {
+		int timeout = 10;
+
+		if (timeout_ms >= 0) {
+			int64_t remaining = deadline - now_ms();
+
+			if (remaining <= 0) {
+				rc = -ETIMEDOUT;
+				break;
+			}
+			if (fds.fd >= 0 || remaining < timeout)
+				timeout = remaining;
+		} else if (fds.fd >= 0) {
+			timeout = -1;
+		}
+
+		if (poll(&fds, fds.fd >= 0 ? 1 : 0, timeout) > 0) {
+			char buf[4096];
+
+			while (read(fds.fd, buf, sizeof(buf)) > 0)
+				;
+		}
+	}
+
+	if (fds.fd >= 0)
+		close(fds.fd);
+
+	return rc;
+}
+
+static inline unsigned long *
+frame_state_bits(struct libevdev *state, unsigned int type)
+{
+	switch (type) {
+		case EV_KEY: return state->key_values;
+		case EV_LED: return state->led_values;
+		case EV_SW: return state->sw_values;
+		default:
+			return NULL;
+	}
+}
+
+/**
+ * Apply an event posted by libevdev_uinput_write_frame_timed() or read
+ * back from the device to the state the frame API filters against.
+ */
+static void
+update_state(struct libevdev *state, const struct input_event *ev)
+{
+	unsigned long *bits;
+
+	if (!libevdev_has_event_code(state, ev->type, ev->code))
+		return;
+
+	bits = frame_state_bits(state, ev->type);
+	if (bits) {
+		if (ev->type != EV_KEY || ev->value != 2)
+			set_bit_state(bits, ev->code, ev->value != 0);
+		return;
+	}
+
+	if (ev->type != EV_ABS)
+		return;
+
+	if (ev->code >= ABS_MT_MIN && ev->code <= ABS_MT_MAX) {
+		if (state->num_slots <= 0)
+			return;
+
+		if (ev->code == ABS_MT_SLOT) {
+			if (ev->value >= 0 && ev->value < state->num_slots)
+				state->current_slot = ev->value;
+		} else {
+			libevdev_set_slot_value(state, state->current_slot,
+						ev->code, ev->value);
+		}
+		return;
+	}
+
+	state->abs_info[ev->code].value = ev->value;
+}
+
+static int
+write_all(int fd, const struct input_event *events, size_t nevents)
+{
+	const char *data = (const char *)events;
+	size_t len = nevents * sizeof(*events);
+
+	/* uinput injects the events in order and returns the number of
+	 * bytes it processed, continue after a partial write */
+	while (len > 0) {
+		ssize_t rc = write(fd, data, len);
+
+		if (rc < 0) {
+			if (errno == EINTR)
+				continue;
+			return -errno;
+		}
+		if (rc == 0)
+			return -EIO;
+
+		data += rc;
+		len -= rc;
+	}
+
+	return 0;
+}
+
 LIBEVDEV_EXPORT int
 libevdev_uinput_write_event(const struct libevdev_uinput *uinput_dev,
 			    unsigned int type,
@@ -489,3 +753,570 @@ libevdev_uinput_write_event(const struct libevdev_uinput *uinput_dev,
 
 	return rc < 0 ? -errno : 0;
 }
+
+LIBEVDEV_EXPORT int
+libevdev_uinput_write_events(const struct libevdev_uinput *uinput_dev,
+			     const struct input_event *events,
+			     size_t nevents)
+{
+	int fd = libevdev_uinput_get_fd(uinput_dev);
+	size_t i;
+
+	for (i = 0; i < nevents; i++) {
+		int max;
+
+		if (events[i].type > EV_MAX)
+			return -EINVAL;
+
+		max = libevdev_event_type_get_max(events[i].type);
+		if (max == -1 || events[i].code > (unsigned int)max)
+			return -EINVAL;
+	}
+
+	return write_all(fd, events, nevents);
+}
+
+static int
+frame_reserve(struct libevdev_uinput *uinput_dev)
+{
+	struct input_event *frame, *out;
+	struct uinput_frame_undo *undo;
+	size_t size;
+
+	if (uinput_dev->frame_len < uinput_dev->frame_size)
+		return 0;
+
+	size = max(uinput_dev->frame_size * 2, (size_t)16);
+
+	frame = realloc(uinput_dev->frame, size * sizeof(*frame));
+	if (!frame)
+		return -ENOMEM;
+	uinput_dev->frame = frame;
+
+	/* worst case every event needs a preceding ABS_MT_SLOT, plus
+	 * the SYN_REPORT */
+	out = realloc(uinput_dev->frame_out, (size * 2 + 1) * sizeof(*out));
+	if (!out)
+		return -ENOMEM;
+	uinput_dev->frame_out = out;
+
+	undo = realloc(uinput_dev->frame_undo, size * 2 * sizeof(*undo));
+	if (!undo)
+		return -ENOMEM;
+	uinput_dev->frame_undo = undo;
+
+	uinput_dev->frame_size = size;
+
+	return 0;
+}
+
+LIBEVDEV_EXPORT void
+libevdev_uinput_frame_begin(struct libevdev_uinput *uinput_dev)
+{
+	uinput_dev->frame_len = 0;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_uinput_frame_add(struct libevdev_uinput *uinput_dev,
+			  unsigned int type,
+			  unsigned int code,
+			  int value)
+{
+	struct input_event *ev;
+	int rc, max;
+
+	if (type > EV_MAX)
+		return -EINVAL;
+
+	max = libevdev_event_type_get_max(type);
+	if (max == -1 || code > (unsigned int)max)
+		return -EINVAL;
+
+	rc = frame_reserve(uinput_dev);
+	if (rc < 0)
+		return rc;
+
+	ev = &uinput_dev->frame[uinput_dev->frame_len++];
+	memset(ev, 0, sizeof(*ev));
+	ev->type = type;
+	ev->code = code;
+	ev->value = value;
+
+	return 0;
+}
+
+static inline void
+frame_record_undo(struct libevdev_uinput *uinput_dev, size_t *nundo,
+		  unsigned int type, unsigned int code, int slot, int value)
+{
+	struct uinput_frame_undo *u = &uinput_dev->frame_undo[(*nundo)++];
+
+	u->type = type;
+	u->code = code;
+	u->slot = slot;
+	u->value = value;
+}
+
+static void
+frame_undo(struct libevdev_uinput *uinput_dev, size_t nundo)
+{
+	struct libevdev *state = uinput_dev->state;
+
+	while (nundo-- > 0) {
+		const struct uinput_frame_undo *u = &uinput_dev->frame_undo[nundo];
+
+		if (u->type != EV_ABS)
+			set_bit_state(frame_state_bits(state, u->type), u->code, u->value);
+		else if (u->code == ABS_MT_SLOT)
+			state->current_slot = u->value;
+		else if (u->slot >= 0)
+			libevdev_set_slot_value(state, u->slot, u->code, u->value);
+		else
+			state->abs_info[u->code].value = u->value;
+	}
+}
+
+/**
+ * Filter one event against the state of the device and update the state.
+ *
+ * @return true if the event must be written, false if it would not
+ * change anything
+ */
+static bool
+frame_filter_event(struct libevdev_uinput *uinput_dev,
+		   const struct input_event *ev,
+		   int *slot,
+		   struct input_event *out, size_t *nout,
+		   size_t *nundo)
+{
+	struct libevdev *state = uinput_dev->state;
+	unsigned long *bits;
+	int old;
+
+	if (ev->type == EV_SYN)
+		return ev->code != SYN_REPORT;
+
+	if (ev->type == EV_REL)
+		return ev->value != 0;
+
+	if (!libevdev_has_event_code(state, ev->type, ev->code))
+		return true;
+
+	bits = frame_state_bits(state, ev->type);
+	if (bits) {
+		/* key repeat is not a state change */
+		if (ev->type == EV_KEY && ev->value == 2)
+			return true;
+
+		old = bit_is_set(bits, ev->code);
+		if (old == (ev->value != 0))
+			return false;
+
+		frame_record_undo(uinput_dev, nundo, ev->type, ev->code, -1, old);
+		set_bit_state(bits, ev->code, ev->value != 0);
+		return true;
+	}
+
+	if (ev->type != EV_ABS)
+		return true;
+
+	/* Without slots the MT axes are protocol A and not filtered */
+	if (ev->code >= ABS_MT_MIN && ev->code <= ABS_MT_MAX) {
+		if (state->num_slots <= 0)
+			return true;
+
+		/* The slot is only written once a value in it changes */
+		if (ev->code == ABS_MT_SLOT) {
+			if (ev->value < 0 || ev->value >= state->num_slots)
+				return true;
+			*slot = ev->value;
+			return false;
+		}
+
+		old = libevdev_get_slot_value(state, *slot, ev->code);
+		if (old == ev->value)
+			return false;
+
+		if (*slot != state->current_slot) {
+			frame_record_undo(uinput_dev, nundo, EV_ABS, ABS_MT_SLOT, -1,
+					  state->current_slot);
+			state->current_slot = *slot;
+			out[(*nout)++] = (struct input_event){
+				.type = EV_ABS,
+				.code = ABS_MT_SLOT,
+				.value = *slot,
+			};
+		}
+
+		frame_record_undo(uinput_dev, nundo, EV_ABS, ev->code, *slot, old);
+		libevdev_set_slot_value(state, *slot, ev->code, ev->value);
+		return true;
+	}
+
+	old = state->abs_info[ev->code].value;
+	if (old == ev->value)
+		return false;
+
+	frame_record_undo(uinput_dev, nundo, EV_ABS, ev->code, -1, old);
+	state->abs_info[ev->code].value = ev->value;
+
+	return true;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_uinput_frame_commit(struct libevdev_uinput *uinput_dev)
+{
+	struct input_event *out = uinput_dev->frame_out;
+	size_t nout = 0, nundo = 0;
+	int slot = uinput_dev->state->current_slot;
+	size_t i;
+	int rc;
+
+	for (i = 0; i < uinput_dev->frame_len; i++) {
+		const struct input_event *ev = &uinput_dev->frame[i];
+
+		if (frame_filter_event(uinput_dev, ev, &slot, out, &nout, &nundo))
+			out[nout++] = *ev;
+	}
+
+	uinput_dev->frame_len = 0;
+
+	if (nout == 0)
+		return 0;
+
+	out[nout++] = (struct input_event){
+		.type = EV_SYN,
+		.code = SYN_REPORT,
+		.value = 0,
+	};
+
+	rc = write_all(uinput_dev->fd, out, nout);
+	if (rc < 0)
+		frame_undo(uinput_dev, nundo);
+
+	return rc;
+}
+
+static int
+open_loopback(struct libevdev_uinput *uinput_dev)
+{
+	int clockid = CLOCK_MONOTONIC;
+	int fd;
+	int rc;
+
+	if (uinput_dev->loopback_fd >= 0)
+		return 0;
+
+	rc = libevdev_uinput_wait_devnode(uinput_dev, 2000);
+	if (rc < 0)
+		return rc;
+
+	fd = open(uinput_dev->devnode, O_RDONLY|O_NONBLOCK|O_CLOEXEC);
+	if (fd < 0)
+		return -errno;
+
+	if (ioctl(fd, EVIOCSCLOCKID, &clockid) < 0) {
+		rc = -errno;
+		close(fd);
+		return rc;
+	}
+
+	uinput_dev->loopback_fd = fd;
+
+	return 0;
+}
+
+/**
+ * Read our own events back up to the first SYN_REPORT, evdev hands the
+ * events to its readers before write() returns.
+ */
+static int
+read_loopback_timestamp(struct libevdev_uinput *uinput_dev,
+			struct timeval *kernel_time)
+{
+	struct input_event ev;
+	ssize_t len;
+
+	while ((len = read(uinput_dev->loopback_fd, &ev, sizeof(ev))) == sizeof(ev)) {
+		if (ev.type != EV_SYN)
+			continue;
+		if (ev.code == SYN_DROPPED)
+			return -EOVERFLOW;
+		if (ev.code == SYN_REPORT) {
+			kernel_time->tv_sec = ev.input_event_sec;
+			kernel_time->tv_usec = ev.input_event_usec;
+			return 0;
+		}
+	}
+
+	if (len < 0 && errno != EAGAIN)
+		return -errno;
+
+	/* someone else grabbed the device */
+	return -ENODATA;
+}
+
+static void
+drain_loopback(struct libevdev_uinput *uinput_dev)
+{
+	struct input_event buf[64];
+
+	while (read(uinput_dev->loopback_fd, buf, sizeof(buf)) > 0)
+		;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_uinput_write_frame_timed(struct libevdev_uinput *uinput_dev,
+				  const struct input_event *events,
+				  size_t nevents,
+				  struct timeval *kernel_time)
+{
+	const struct libevdev *state = uinput_dev->state;
+	bool has_timestamp = false;
+	struct input_event *out;
+	size_t nout = 0;
+	int64_t recorded_us;
+	size_t i;
+	int rc;
+
+	if (nevents == 0)
+		return -EINVAL;
+
+	for (i = 0; i < nevents; i++) {
+		int max;
+
+		if (events[i].type > EV_MAX)
+			return -EINVAL;
+
+		max = libevdev_event_type_get_max(events[i].type);
+		if (max == -1 || events[i].code > (unsigned int)max)
+			return -EINVAL;
+
+		/* one frame only */
+		if (events[i].type == EV_SYN && events[i].code == SYN_REPORT &&
+		    i != nevents - 1)
+			return -EINVAL;
+
+		if (events[i].type == EV_MSC && events[i].code == MSC_TIMESTAMP)
+			has_timestamp = true;
+	}
+
+	/* without MSC_TIMESTAMP the recorded time would silently get lost */
+	if (!libevdev_has_event_code(state, EV_MSC, MSC_TIMESTAMP))
+		return -EOPNOTSUPP;
+
+	if (uinput_dev->replay_size < nevents + 2) {
+		out = realloc(uinput_dev->replay, (nevents + 2) * sizeof(*out));
+		if (!out)
+			return -ENOMEM;
+		uinput_dev->replay = out;
+		uinput_dev->replay_size = nevents + 2;
+	}
+	out = uinput_dev->replay;
+
+	if (kernel_time) {
+		rc = open_loopback(uinput_dev);
+		if (rc < 0)
+			return rc;
+		drain_loopback(uinput_dev);
+	}
+
+	memcpy(out, events, nevents * sizeof(*events));
+	nout = nevents;
+	if (out[nout - 1].type == EV_SYN && out[nout - 1].code == SYN_REPORT)
+		nout--;
+
+	/* The frame's recorded time is the one of its last event. uinput
+	 * ignores event timestamps, so pass it on as MSC_TIMESTAMP,
+	 * relative to the first frame replayed. */
+	recorded_us = (int64_t)events[nevents - 1].input_event_sec * 1000000 +
+		      events[nevents - 1].input_event_usec;
+	if (!uinput_dev->replay_started) {
+		uinput_dev->replay_base_us = recorded_us;
+		uinput_dev->replay_started = true;
+	}
+
+	if (!has_timestamp) {
+		out[nout++] = (struct input_event){
+			.type = EV_MSC,
+			.code = MSC_TIMESTAMP,
+			.value = (int)(uint32_t)(recorded_us - uinput_dev->replay_base_us),
+		};
+	}
+
+	out[nout++] = (struct input_event){
+		.type = EV_SYN,
+		.code = SYN_REPORT,
+		.value = 0,
+	};
+
+	rc = write_all(uinput_dev->fd, out, nout);
+	if (rc < 0)
+		return rc;
+
+	for (i = 0; i < nout; i++)
+		update_state(uinput_dev->state, &out[i]);
+
+	/* The frame is posted, failing now would make callers that retry
+	 * post it twice. A zeroed kernel_time says we don't know when. */
+	if (kernel_time && read_loopback_timestamp(uinput_dev, kernel_time) < 0)
+		*kernel_time = (struct timeval){ 0 };
+
+	return 0;
+}
+
+LIBEVDEV_EXPORT void
+libevdev_uinput_set_ff_handler(struct libevdev_uinput *uinput_dev,
+			       libevdev_uinput_ff_func_t func,
+			       void *data)
+{
+	uinput_dev->ff_func = func;
+	uinput_dev->ff_data = data;
+}
+
+/**
+ * Complete an upload or erase request. The process calling EVIOCSFF or
+ * EVIOCRMFF is blocked until UI_END_FF_*.
+ */
+static int
+handle_ff_request(struct libevdev_uinput *uinput_dev,
+		  const struct input_event *ev)
+{
+	int fd = uinput_dev->fd;
+
+	if (ev->code == UI_FF_UPLOAD) {
+		struct uinput_ff_upload upload = { .request_id = ev->value };
+
+		if (ioctl(fd, UI_BEGIN_FF_UPLOAD, &upload) < 0)
+			return -errno;
+
+		upload.retval = uinput_dev->ff_func ?
+			uinput_dev->ff_func(uinput_dev, LIBEVDEV_UINPUT_FF_UPLOAD,
+					    &upload.effect, &upload.old,
+					    uinput_dev->ff_data) : 0;
+
+		if (ioctl(fd, UI_END_FF_UPLOAD, &upload) < 0)
+			return -errno;
+	} else if (ev->code == UI_FF_ERASE) {
+		struct uinput_ff_erase erase = { .request_id = ev->value };
+		struct ff_effect effect = {0};
+
+		if (ioctl(fd, UI_BEGIN_FF_ERASE, &erase) < 0)
+			return -errno;
+
+		effect.id = erase.effect_id;
+		erase.retval = uinput_dev->ff_func ?
+			uinput_dev->ff_func(uinput_dev, LIBEVDEV_UINPUT_FF_ERASE,
+					    &effect, NULL,
+					    uinput_dev->ff_data) : 0;
+
+		if (ioctl(fd, UI_END_FF_ERASE, &erase) < 0)
+			return -errno;
+	}
+
+	return 0;
+}
+
+/**
+ * Feedback events are passed on by the kernel without checking the code
+ * against the device, the equivalent of sanitize_event() for them.
+ */
+static bool
+is_valid_feedback_event(const struct libevdev_uinput *uinput_dev,
+			const struct input_event *ev)
+{
+	/* EV_FF codes below the effect types are effect ids to play */
+	if (ev->type == EV_FF && ev->code < FF_EFFECT_MIN)
+		return libevdev_has_event_type(uinput_dev->state, EV_FF);
+
+	return libevdev_has_event_code(uinput_dev->state, ev->type, ev->code);
+}
+
+static int
+read_events(struct libevdev_uinput *uinput_dev,
+	    struct input_event *events,
+	    size_t nevents)
+{
+	struct pollfd fds = { .fd = uinput_dev->fd, .events = POLLIN };
+	struct input_event buf[64];
+	bool pending = false;
+	size_t count = 0;
+
+	/* the fd may be blocking, only read what is there */
+	while (count < nevents || nevents == 0) {
+		size_t want = ARRAY_LENGTH(buf);
+		ssize_t len;
+		size_t i;
+		int rc;
+
+		rc = poll(&fds, 1, 0);
+		if (rc < 0) {
+			if (errno == EINTR)
+				continue;
+			return -errno;
+		}
+		if (rc == 0 || !(fds.revents & POLLIN))
+			break;
+
+		/* don't read more than we can hand out, the rest stays
+		 * queued in the kernel. Requests don't need space but we
+		 * can't tell them apart before reading. */
+		if (nevents > 0)
+			want = min(want, nevents - count);
+
+		len = read(uinput_dev->fd, buf, want * sizeof(*buf));
+		if (len < 0) {
+			if (errno == EINTR)
+				continue;
+			if (errno == EAGAIN)
+				break;
+			return -errno;
+		}
+		if (len == 0)
+			break;
+
+		pending = true;
+
+		for (i = 0; i < len / sizeof(*buf); i++) {
+			if (buf[i].type == EV_UINPUT) {
+				rc = handle_ff_request(uinput_dev, &buf[i]);
+				if (rc < 0)
+					return rc;
+				continue;
+			}
+
+			if (!is_valid_feedback_event(uinput_dev, &buf[i]))
+				continue;
+
+			/* the kernel already applied LEDs to the device */
+			update_state(uinput_dev->state, &buf[i]);
+
+			if (count < nevents)
+				events[count++] = buf[i];
+		}
+	}
+
+	if (!pending)
+		return -EAGAIN;
+
+	return count;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_uinput_dispatch(struct libevdev_uinput *uinput_dev,
+			 struct input_event *events,
+			 size_t nevents)
+{
+	return read_events(uinput_dev, events, nevents);
+}
+
+LIBEVDEV_EXPORT int
+libevdev_uinput_next_events(struct libevdev_uinput *uinput_dev,
+			    struct input_event *events,
+			    size_t nevents)
+{
+	if (nevents == 0)
+		return -EINVAL;
+
+	return read_events(uinput_dev, events, nevents);
+}
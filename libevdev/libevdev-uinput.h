@@ -32,6 +32,7 @@ extern "C" {
 #include <libevdev/libevdev.h>
 
 struct libevdev_uinput;
+struct libevdev_uinput_pool;
 
 /**
  * @defgroup uinput uinput device creation
@@ -142,6 +143,10 @@ enum libevdev_uinput_open_mode {
  * @note On FreeBSD, if the UI_GET_SYSNAME ioctl() fails, there is no other way
  * to get a device, and the function call will fail.
  *
+ * Devices may be created concurrently from multiple threads, provided
+ * each thread uses its own uinput file descriptor and source device is
+ * not modified during the call.
+ *
  * @param dev The device to duplicate
  * @param uinput_fd @ref LIBEVDEV_UINPUT_OPEN_MANAGED or a file descriptor to @c /dev/uinput,
  * @param[out] uinput_dev The newly created libevdev device.
@@ -187,17 +192,17 @@ int libevdev_uinput_get_fd(const struct libevdev_uinput *uinput_dev);
  * @ingroup uinput
  *
  * Return the syspath representing this uinput device. If the UI_GET_SYSNAME
- * ioctl is not available, libevdev makes an educated guess.
+ * ioctl is not available, libevdev gives the device a unique phys and
+ * looks the device up by its phys in sysfs.
  * The UI_GET_SYSNAME ioctl is available since Linux 3.15.
  *
  * The syspath returned is the one of the input node itself
  * (e.g. /sys/devices/virtual/input/input123), not the syspath of the device
  * node returned with libevdev_uinput_get_devnode().
  *
- * @note This function may return NULL if UI_GET_SYSNAME is not available.
- * In that case, libevdev uses ctime and the device name to guess devices.
- * To avoid false positives, wait at least 1.5s between creating devices that
- * have the same name.
+ * @note On kernels without UI_GET_SYSNAME the device's phys is set by
+ * libevdev, e.g. "libevdev-uinput/1234/0x5578a0e2b2a0". Otherwise the
+ * phys is left empty.
  *
  * @note FreeBSD does not have sysfs, on FreeBSD this function always returns
  * NULL.
@@ -231,6 +236,28 @@ const char* libevdev_uinput_get_syspath(struct libevdev_uinput *uinput_dev);
  */
 const char* libevdev_uinput_get_devnode(struct libevdev_uinput *uinput_dev);
 
+/**
+ * @ingroup uinput
+ *
+ * Wait for the device node of this uinput device to appear in the file
+ * system. The kernel creates the device synchronously but the device node
+ * is created by udev or devtmpfs shortly afterwards, a caller that opens
+ * the device node right after libevdev_uinput_create_from_device() may
+ * fail with ENOENT.
+ *
+ * The device node may exist before its permissions are set up by udev.
+ *
+ * @param uinput_dev A previously created uinput device.
+ * @param timeout_ms The maximum time to wait in milliseconds, or -1 to
+ * wait indefinitely
+ * @return 0 if the device node exists, -ETIMEDOUT if it did not appear
+ * within the timeout or -ENODEV if the device node is unknown
+ *
+ * @since 1.14
+ */
+int libevdev_uinput_wait_devnode(const struct libevdev_uinput *uinput_dev,
+				 int timeout_ms);
+
 /**
  * @ingroup uinput
  *
@@ -249,6 +276,363 @@ int libevdev_uinput_write_event(const struct libevdev_uinput *uinput_dev,
 				unsigned int type,
 				unsigned int code,
 				int value);
+
+/**
+ * @ingroup uinput
+ *
+ * Post a number of events through the uinput device with a single
+ * write() instead of one write() per event. All events are validated
+ * before any event is written, if any event has an invalid type or code
+ * no event is posted.
+ *
+ * As with libevdev_uinput_write_event(), it is the caller's
+ * responsibility to terminate the event sequence with an
+ * EV_SYN/SYN_REPORT/0 event. The timestamps of the events are ignored.
+ *
+ * @param uinput_dev A previously created uinput device.
+ * @param events The events to post
+ * @param nevents The number of events in events
+ * @return 0 on success or a negative errno on error
+ *
+ * @since 1.14
+ */
+int libevdev_uinput_write_events(const struct libevdev_uinput *uinput_dev,
+				 const struct input_event *events,
+				 size_t nevents);
+
+/**
+ * @ingroup uinput
+ *
+ * Start a new event frame on this device, discarding any events added
+ * with libevdev_uinput_frame_add() since the last
+ * libevdev_uinput_frame_commit().
+ *
+ * A frame collects the events of one hardware frame and posts them with
+ * a single write() on commit, terminated by an EV_SYN/SYN_REPORT/0 event:
+ *
+ * @code
+ * libevdev_uinput_frame_begin(uidev);
+ * libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_SLOT, 1);
+ * libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_POSITION_X, x);
+ * libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_POSITION_Y, y);
+ * libevdev_uinput_frame_add(uidev, EV_KEY, BTN_TOUCH, 1);
+ * rc = libevdev_uinput_frame_commit(uidev);
+ * @endcode
+ *
+ * @param uinput_dev A previously created uinput device.
+ *
+ * @since 1.14
+ */
+void libevdev_uinput_frame_begin(struct libevdev_uinput *uinput_dev);
+
+/**
+ * @ingroup uinput
+ *
+ * Add an event to the current frame. The event is not posted until
+ * libevdev_uinput_frame_commit().
+ *
+ * @param uinput_dev A previously created uinput device.
+ * @param type Event type (EV_ABS, EV_REL, etc.)
+ * @param code Event code (ABS_X, REL_Y, etc.)
+ * @param value The event value
+ * @return 0 on success, -EINVAL if the type or code is invalid or -ENOMEM
+ *
+ * @since 1.14
+ */
+int libevdev_uinput_frame_add(struct libevdev_uinput *uinput_dev,
+			      unsigned int type,
+			      unsigned int code,
+			      int value);
+
+/**
+ * @ingroup uinput
+ *
+ * Post the events of the current frame followed by an
+ * EV_SYN/SYN_REPORT/0 event in a single write() and start a new frame.
+ *
+ * Events that would not change the state of the device are dropped
+ * before writing: key, switch and LED events with the current value, axis
+ * events with the current value (per slot for multitouch axes), relative
+ * events with a value of zero and EV_SYN/SYN_REPORT events. ABS_MT_SLOT
+ * events are only written before a changed value in a different slot than
+ * the current one. If no event is left, nothing is written.
+ *
+ * The state compared against is the one posted by previous commits and
+ * libevdev_uinput_write_frame_timed(), starting with the state of a newly
+ * created device. Events posted with libevdev_uinput_write_event() or
+ * libevdev_uinput_write_events() are not taken into account. If the write
+ * fails, the state is left as it was
+ * before the commit.
+ *
+ * @param uinput_dev A previously created uinput device.
+ * @return 0 on success or a negative errno on error
+ *
+ * @since 1.14
+ */
+int libevdev_uinput_frame_commit(struct libevdev_uinput *uinput_dev);
+
+/**
+ * @ingroup uinput
+ *
+ * Post one recorded frame through the uinput device, keeping its
+ * recorded timestamp. The kernel ignores the timestamps of events written
+ * to uinput and stamps them on arrival instead, so the recorded time is
+ * passed on as an EV_MSC/MSC_TIMESTAMP event in microseconds, relative to
+ * the first frame replayed through this device. The recorded time of a
+ * frame is the timestamp of its last event.
+ *
+ * The device must have MSC_TIMESTAMP enabled. The MSC_TIMESTAMP event is
+ * only added if the frame does not already contain one. As with the kernel,
+ * the value wraps around after about 71 minutes. The events are written
+ * with a single write() and terminated with an EV_SYN/SYN_REPORT/0 event,
+ * the frame may omit it.
+ *
+ * If kernel_time is not NULL, it is set to the timestamp the kernel gave
+ * the frame in CLOCK_MONOTONIC, as seen by a reader of the device node.
+ * To get it, libevdev opens the device node on the first call and reads
+ * its own events back, see libevdev_uinput_wait_devnode(). This needs
+ * read access to the device node. If the frame was posted but its
+ * timestamp could not be read back, e.g. because the device is grabbed by
+ * another process, kernel_time is set to zero and 0 is returned.
+ *
+ * The caller is responsible for pacing the frames, e.g. by sleeping for
+ * the difference between the recorded timestamps of two frames.
+ *
+ * @param uinput_dev A previously created uinput device.
+ * @param events The events of the frame, with their recorded timestamps
+ * @param nevents The number of events in events
+ * @param[out] kernel_time Set to the kernel timestamp of the frame, may
+ * be NULL
+ * @return 0 if the frame was posted or a negative errno on error. On
+ * error, the frame was not posted, unless write() failed after part of it
+ * had been written. -EINVAL is returned if any event is invalid or events
+ * contains more than one frame, -EOPNOTSUPP if the device does not have
+ * MSC_TIMESTAMP enabled.
+ *
+ * @since 1.14
+ */
+int libevdev_uinput_write_frame_timed(struct libevdev_uinput *uinput_dev,
+				      const struct input_event *events,
+				      size_t nevents,
+				      struct timeval *kernel_time);
+
+/**
+ * @ingroup uinput
+ */
+enum libevdev_uinput_ff_request {
+	LIBEVDEV_UINPUT_FF_UPLOAD = 1,	/**< A process uploads an effect with EVIOCSFF */
+	LIBEVDEV_UINPUT_FF_ERASE	/**< A process erases an effect with EVIOCRMFF */
+};
+
+/**
+ * @ingroup uinput
+ *
+ * Callback for force feedback requests, see libevdev_uinput_set_ff_handler().
+ *
+ * @param uinput_dev The uinput device
+ * @param request The type of request
+ * @param effect For @ref LIBEVDEV_UINPUT_FF_UPLOAD the effect being
+ * uploaded, with the id assigned by the kernel. For @ref
+ * LIBEVDEV_UINPUT_FF_ERASE only the id is set.
+ * @param old For @ref LIBEVDEV_UINPUT_FF_UPLOAD the effect being replaced
+ * if the process updates an existing effect, otherwise all zero. NULL for
+ * @ref LIBEVDEV_UINPUT_FF_ERASE.
+ * @param data The data pointer passed to libevdev_uinput_set_ff_handler()
+ *
+ * @return 0 to accept the request or a negative errno, returned to the
+ * requesting process as the result of its ioctl
+ */
+typedef int (*libevdev_uinput_ff_func_t)(struct libevdev_uinput *uinput_dev,
+					 enum libevdev_uinput_ff_request request,
+					 const struct ff_effect *effect,
+					 const struct ff_effect *old,
+					 void *data);
+
+/**
+ * @ingroup uinput
+ *
+ * Set the callback for force feedback effect uploads and erases on this
+ * device. The callback is invoked from within libevdev_uinput_dispatch().
+ * Without a callback, all requests are accepted.
+ *
+ * @param uinput_dev A previously created uinput device.
+ * @param func The callback, or NULL to accept all requests
+ * @param data Caller-specific data passed to the callback
+ *
+ * @since 1.14
+ */
+void libevdev_uinput_set_ff_handler(struct libevdev_uinput *uinput_dev,
+				    libevdev_uinput_ff_func_t func,
+				    void *data);
+
+/**
+ * @ingroup uinput
+ *
+ * Process the events pending on the uinput fd without blocking. Call this
+ * function whenever libevdev_uinput_get_fd() is readable.
+ *
+ * Force feedback upload and erase requests are completed immediately
+ * with the result of the callback set with
+ * libevdev_uinput_set_ff_handler(). The process issuing EVIOCSFF or
+ * EVIOCRMFF is blocked until then, so the fd should be polled whenever
+ * the device supports EV_FF.
+ *
+ * Any other events, e.g. EV_FF events to play an effect or EV_LED events,
+ * are stored in events, see libevdev_uinput_next_events(). If events is
+ * full, the remaining events stay queued until the next call. If nevents
+ * is 0, these events are discarded.
+ *
+ * @param uinput_dev A previously created uinput device.
+ * @param[out] events Storage for the events that are not requests, may be
+ * NULL if nevents is 0
+ * @param nevents The number of events that fit into events
+ *
+ * @return The number of events stored in events, -EAGAIN if nothing was
+ * pending or a negative errno on failure
+ *
+ * @since 1.14
+ */
+int libevdev_uinput_dispatch(struct libevdev_uinput *uinput_dev,
+			     struct input_event *events,
+			     size_t nevents);
+
+/**
+ * @ingroup uinput
+ *
+ * Read the events written back into this device by its readers, e.g. the
+ * EV_LED events a compositor writes to turn on caps lock, without
+ * blocking. These are EV_LED, EV_SND, EV_REP and EV_FF events, the latter
+ * with the effect id as code to start (value > 0) or stop (value 0) an
+ * effect, or FF_GAIN or FF_AUTOCENTER.
+ *
+ * Events with a code the device does not have are discarded. LED
+ * changes are applied to the state used by libevdev_uinput_frame_commit().
+ * Force feedback upload and erase requests read by this call are completed
+ * as in libevdev_uinput_dispatch().
+ *
+ * @code
+ * struct input_event ev[16];
+ *
+ * rc = libevdev_uinput_next_events(uidev, ev, 16);
+ * for (i = 0; i < rc; i++) {
+ *     if (ev[i].type == EV_LED && ev[i].code == LED_CAPSL)
+ *         set_capslock_led(ev[i].value);
+ * }
+ * @endcode
+ *
+ * @param uinput_dev A previously created uinput device.
+ * @param[out] events Storage for the events read
+ * @param nevents The number of events that fit into events. Events that
+ * don't fit stay queued until the next call.
+ *
+ * @return The number of events stored in events, -EAGAIN if nothing was
+ * pending, -EINVAL if nevents is 0 or a negative errno on failure
+ *
+ * @since 1.14
+ */
+int libevdev_uinput_next_events(struct libevdev_uinput *uinput_dev,
+				struct input_event *events,
+				size_t nevents);
+
+/**
+ * @ingroup uinput
+ *
+ * Create a pool of uinput devices. Creating a uinput device involves
+ * dozens of ioctls, a sysfs lookup and udev processing the new device;
+ * callers that repeatedly create and destroy identical devices (e.g. test
+ * suites) can instead hand devices back to the pool and get them out again
+ * for the next identical device.
+ *
+ * @code
+ * libevdev_uinput_pool_new(16, &pool);
+ *
+ * for (each test) {
+ *     libevdev_uinput_pool_acquire(pool, dev, &uidev);
+ *     run_test(uidev);
+ *     libevdev_uinput_pool_release(pool, uidev);
+ * }
+ *
+ * libevdev_uinput_pool_free(pool);
+ * @endcode
+ *
+ * A pool is not thread-safe.
+ *
+ * @param max_idle The maximum number of idle devices kept in the pool.
+ * Devices released while the pool is full are destroyed.
+ * @param[out] pool Set to the newly allocated pool
+ *
+ * @return 0 on success or a negative errno on failure
+ *
+ * @since 1.14
+ */
+int libevdev_uinput_pool_new(unsigned int max_idle,
+			     struct libevdev_uinput_pool **pool);
+
+/**
+ * @ingroup uinput
+ *
+ * Destroy all idle devices in the pool and free the pool. Devices
+ * currently acquired from the pool are not affected and must be destroyed
+ * with libevdev_uinput_destroy().
+ *
+ * @param pool The pool to free, may be NULL
+ *
+ * @since 1.14
+ */
+void libevdev_uinput_pool_free(struct libevdev_uinput_pool *pool);
+
+/**
+ * @ingroup uinput
+ *
+ * Get a uinput device matching the given device. If the pool has an idle
+ * device with the same name, ids, capabilities, properties and axis
+ * ranges, that device is returned, otherwise a new device is created
+ * with libevdev_uinput_create_from_device() and
+ * @ref LIBEVDEV_UINPUT_OPEN_MANAGED.
+ *
+ * A reused device keeps its syspath and device node. Its axis values are
+ * the ones last posted, all keys and buttons are released and there are
+ * no active touches.
+ *
+ * @param pool The pool
+ * @param dev The device to duplicate
+ * @param[out] uinput_dev The uinput device
+ *
+ * @return 0 on success or a negative errno on failure. On failure, the
+ * value of uinput_dev is unmodified.
+ *
+ * @since 1.14
+ */
+int libevdev_uinput_pool_acquire(struct libevdev_uinput_pool *pool,
+				 const struct libevdev *dev,
+				 struct libevdev_uinput **uinput_dev);
+
+/**
+ * @ingroup uinput
+ *
+ * Hand a device back to the pool. Any key or button left pressed is
+ * released and any touch still active is ended, followed by an
+ * EV_SYN/SYN_REPORT/0 event, see libevdev_uinput_frame_commit().
+ * The device is destroyed instead if the pool is full or the events
+ * can't be posted.
+ *
+ * Only the state posted with libevdev_uinput_frame_commit() or
+ * libevdev_uinput_write_frame_timed() is known to the pool. Keys pressed
+ * or touches started with libevdev_uinput_write_event() or
+ * libevdev_uinput_write_events() must be released by the caller before
+ * the device is handed back.
+ *
+ * The device does not need to come from the pool, but after this call
+ * the caller must not use it anymore.
+ *
+ * @param pool The pool
+ * @param uinput_dev The device to hand back, may be NULL
+ *
+ * @since 1.14
+ */
+void libevdev_uinput_pool_release(struct libevdev_uinput_pool *pool,
+				  struct libevdev_uinput *uinput_dev);
+
 #ifdef __cplusplus
 }
 #endif
@@ -57,6 +57,57 @@ clear_bit(unsigned long *array, int bit)
     array[bit / LONG_BITS] &= ~(1LL << (bit % LONG_BITS));
 }
 
+static inline unsigned int
+popcount_long(unsigned long l)
+{
+#ifdef __GNUC__
+	return __builtin_popcountl(l);
+#else
+	unsigned int count = 0;
+
+	for (; l; l &= l - 1)
+		count++;
+	return count;
+#endif
+}
+
+/**
+ * @return the index of the lowest bit set in l, l must not be 0
+ */
+static inline unsigned int
+ctz_long(unsigned long l)
+{
+#ifdef __GNUC__
+	return __builtin_ctzl(l);
+#else
+	unsigned int count = 0;
+
+	for (; !(l & 1); l >>= 1)
+		count++;
+	return count;
+#endif
+}
+
+/**
+ * Count the bits set in the range [start, end) of array.
+ */
+static inline unsigned int
+bit_count(const unsigned long *array, unsigned int start, unsigned int end)
+{
+	unsigned int count = 0;
+
+	for (; start < end && start % LONG_BITS; start++)
+		count += bit_is_set(array, start);
+
+	for (; start + LONG_BITS <= end; start += LONG_BITS)
+		count += popcount_long(array[start / LONG_BITS]);
+
+	for (; start < end; start++)
+		count += bit_is_set(array, start);
+
+	return count;
+}
+
 static inline void
 set_bit_state(unsigned long *array, int bit, int state)
 {
@@ -64,38 +64,35 @@ slot_value(const struct libevdev *dev, int slot, int axis)
 	return &dev->mt_slot_vals[slot * ABS_MT_CNT + axis - ABS_MT_MIN];
 }
 
+static unsigned int
+count_mt_axes(const struct libevdev *dev)
+{
+	if (!libevdev_has_event_type(dev, EV_ABS))
+		return 0;
+
+	return bit_count(dev->abs_bits, ABS_MT_SLOT, ABS_CNT);
+}
+
 static int
 init_event_queue(struct libevdev *dev)
 {
 	const int MIN_QUEUE_SIZE = 256;
 	int nevents = 1; /* terminating SYN_REPORT */
 	int nslots;
-	unsigned int type, code;
+	unsigned int type;
 
 	/* count the number of axes, keys, etc. to get a better idea at how
 	   many events per EV_SYN we could possibly get. That's the max we
 	   may get during SYN_DROPPED too. Use double that, just so we have
 	   room for events while syncing a device.
 	 */
-	for (type = EV_KEY; type < EV_MAX; type++) {
-		int max = libevdev_event_type_get_max(type);
-		for (code = 0; max > 0 && code < (unsigned int) max; code++) {
-			if (libevdev_has_event_code(dev, type, code))
-				nevents++;
-		}
-	}
+	for (type = EV_KEY; type < EV_MAX; type++)
+		nevents += max(libevdev_get_event_code_count(dev, type), 0);
 
 	nslots = libevdev_get_num_slots(dev);
 	if (nslots > 1) {
-		int num_mt_axes = 0;
-
-		for (code = ABS_MT_SLOT; code <= ABS_MAX; code++) {
-			if (libevdev_has_event_code(dev, EV_ABS, code))
-				num_mt_axes++;
-		}
-
 		/* We already counted the first slot in the initial count */
-		nevents += num_mt_axes * (nslots - 1);
+		nevents += count_mt_axes(dev) * (nslots - 1);
 	}
 
 	return queue_alloc(dev, max(MIN_QUEUE_SIZE, nevents * 2));
@@ -160,14 +157,12 @@ static struct logdata log_data = {
 	.userdata = NULL,
 };
 
-void
-_libevdev_log_msg(const struct libevdev *dev,
-		  enum libevdev_log_priority priority,
-		  const char *file, int line, const char *func,
-		  const char *format, ...)
+static void
+log_msg_va(const struct libevdev *dev,
+	   enum libevdev_log_priority priority,
+	   const char *file, int line, const char *func,
+	   const char *format, va_list args)
 {
-	va_list args;
-
 	if (dev && dev->log.device_handler) {
 		/**
 		 * if both global handler and device handler are set
@@ -186,19 +181,160 @@ _libevdev_log_msg(const struct libevdev *dev,
 		abort(); /* Seppuku, see above */
 	}
 
-	va_start(args, format);
 	if (dev && dev->log.device_handler)
 		dev->log.device_handler(dev, priority, dev->log.userdata, file, line, func, format, args);
 	else
 		log_data.global_handler(priority, log_data.userdata, file, line, func, format, args);
+}
+
+static void
+log_msg(const struct libevdev *dev,
+	enum libevdev_log_priority priority,
+	const char *file, int line, const char *func,
+	const char *format, ...) LIBEVDEV_ATTRIBUTE_PRINTF(6, 7);
+
+static void
+log_msg(const struct libevdev *dev,
+	enum libevdev_log_priority priority,
+	const char *file, int line, const char *func,
+	const char *format, ...)
+{
+	va_list args;
+
+	va_start(args, format);
+	log_msg_va(dev, priority, file, line, func, format, args);
 	va_end(args);
 }
 
+/**
+ * Store the message in the device's deferred log instead of calling the
+ * log handler. vsnprintf into a fixed buffer does not allocate for the
+ * conversions libevdev uses, so this is safe to call from the read path
+ * in realtime mode.
+ */
+static void
+defer_log_msg(const struct libevdev *dev,
+	      enum libevdev_log_priority priority,
+	      const char *file, int line, const char *func,
+	      const char *format, va_list args)
+{
+	/* the ring is the only part of dev we modify here, and only the
+	 * producer side of it */
+	struct deferred_log *log = dev->deferred_log;
+	struct deferred_log_entry *entry;
+	unsigned int head, tail;
+
+	head = log->head;
+	tail = __atomic_load_n(&log->tail, __ATOMIC_ACQUIRE);
+	if (head - tail >= DEFERRED_LOG_SIZE) {
+		__atomic_fetch_add(&log->ndropped, 1, __ATOMIC_RELAXED);
+		return;
+	}
+
+	entry = &log->entries[head % DEFERRED_LOG_SIZE];
+	entry->priority = priority;
+	entry->file = file;
+	entry->line = line;
+	entry->func = func;
+	vsnprintf(entry->msg, sizeof(entry->msg), format, args);
+
+	__atomic_store_n(&log->head, head + 1, __ATOMIC_RELEASE);
+}
+
+void
+_libevdev_log_msg(const struct libevdev *dev,
+		  enum libevdev_log_priority priority,
+		  const char *file, int line, const char *func,
+		  const char *format, ...)
+{
+	va_list args;
+
+	va_start(args, format);
+	if (dev && dev->realtime && dev->deferred_log)
+		defer_log_msg(dev, priority, file, line, func, format, args);
+	else
+		log_msg_va(dev, priority, file, line, func, format, args);
+	va_end(args);
+}
+
+/* The first 32 keys, KEY_ESC to KEY_S. A device with all of those is
+ * a keyboard, same heuristic as udev's input_id builtin. */
+#define KEYBOARD_KEYS_MASK 0xfffffffeUL
+
+static unsigned int
+classify_device(const struct libevdev *dev)
+{
+	unsigned int class = 0;
+	bool has_key = libevdev_has_event_type(dev, EV_KEY);
+	bool has_abs = libevdev_has_event_type(dev, EV_ABS);
+	bool has_rel = libevdev_has_event_type(dev, EV_REL);
+	bool abs_xy, rel_xy;
+	bool stylus, finger, touch, mouse_buttons, joystick_buttons;
+
+	abs_xy = has_abs &&
+		 ((bit_is_set(dev->abs_bits, ABS_X) && bit_is_set(dev->abs_bits, ABS_Y)) ||
+		  (bit_is_set(dev->abs_bits, ABS_MT_POSITION_X) &&
+		   bit_is_set(dev->abs_bits, ABS_MT_POSITION_Y)));
+	rel_xy = has_rel &&
+		 bit_is_set(dev->rel_bits, REL_X) && bit_is_set(dev->rel_bits, REL_Y);
+
+	if (has_key) {
+		/* BTN_TOOL_PEN up to BTN_TOOL_AIRBRUSH */
+		stylus = bit_count(dev->key_bits, BTN_TOOL_PEN, BTN_TOOL_FINGER) > 0 ||
+			 bit_is_set(dev->key_bits, BTN_STYLUS);
+		finger = bit_is_set(dev->key_bits, BTN_TOOL_FINGER);
+		touch = bit_is_set(dev->key_bits, BTN_TOUCH);
+		mouse_buttons = bit_count(dev->key_bits, BTN_MOUSE, BTN_JOYSTICK) > 0;
+		joystick_buttons = bit_count(dev->key_bits, BTN_JOYSTICK, BTN_DIGI) > 0 ||
+				   bit_count(dev->key_bits, BTN_TRIGGER_HAPPY, KEY_CNT) > 0;
+
+		if ((dev->key_bits[0] & KEYBOARD_KEYS_MASK) == KEYBOARD_KEYS_MASK)
+			class |= LIBEVDEV_DEVICE_CLASS_KEYBOARD;
+	} else {
+		stylus = finger = touch = mouse_buttons = joystick_buttons = false;
+	}
+
+	if (abs_xy) {
+		if (stylus)
+			class |= LIBEVDEV_DEVICE_CLASS_TABLET;
+		else if (libevdev_has_property(dev, INPUT_PROP_DIRECT))
+			class |= LIBEVDEV_DEVICE_CLASS_TOUCHSCREEN;
+		else if (finger ||
+			 (touch && libevdev_has_property(dev, INPUT_PROP_POINTER)))
+			class |= LIBEVDEV_DEVICE_CLASS_TOUCHPAD;
+		else if (touch)
+			class |= LIBEVDEV_DEVICE_CLASS_TOUCHSCREEN;
+		else if (mouse_buttons)
+			class |= LIBEVDEV_DEVICE_CLASS_POINTER;
+	}
+
+	if (rel_xy &&
+	    (mouse_buttons || libevdev_has_property(dev, INPUT_PROP_POINTING_STICK)))
+		class |= LIBEVDEV_DEVICE_CLASS_POINTER;
+
+	if (joystick_buttons && !(class & LIBEVDEV_DEVICE_CLASS_TABLET))
+		class |= LIBEVDEV_DEVICE_CLASS_JOYSTICK;
+
+	if (libevdev_has_event_type(dev, EV_SW) &&
+	    bit_count(dev->sw_bits, 0, SW_CNT) > 0)
+		class |= LIBEVDEV_DEVICE_CLASS_SWITCH;
+
+	return class;
+}
+
+static inline void
+update_device_class(struct libevdev *dev)
+{
+	dev->device_class = classify_device(dev);
+}
+
 static void
 libevdev_reset(struct libevdev *dev)
 {
 	enum libevdev_log_priority pri = dev->log.priority;
 	libevdev_device_log_func_t handler = dev->log.device_handler;
+	bool realtime = dev->realtime;
+	struct deferred_log *deferred_log = dev->deferred_log;
 
 	free(dev->name);
 	free(dev->phys);
@@ -213,6 +349,9 @@ libevdev_reset(struct libevdev *dev)
 	dev->sync_state = SYNC_NONE;
 	dev->log.priority = pri;
 	dev->log.device_handler = handler;
+	/* undispatched messages survive a failed libevdev_set_fd() */
+	dev->realtime = realtime;
+	dev->deferred_log = deferred_log;
 	libevdev_enable_event_type(dev, EV_SYN);
 }
 
@@ -232,6 +371,12 @@ libevdev_new(void)
 
 LIBEVDEV_EXPORT int
 libevdev_new_from_fd(int fd, struct libevdev **dev)
+{
+	return libevdev_new_from_fd_with_flags(fd, 0, dev);
+}
+
+LIBEVDEV_EXPORT int
+libevdev_new_from_fd_with_flags(int fd, unsigned int flags, struct libevdev **dev)
 {
 	struct libevdev *d;
 	int rc;
@@ -240,7 +385,7 @@ libevdev_new_from_fd(int fd, struct libevdev **dev)
 	if (!d)
 		return -ENOMEM;
 
-	rc = libevdev_set_fd(d, fd);
+	rc = libevdev_set_fd_with_flags(d, fd, flags);
 	if (rc < 0)
 		libevdev_free(d);
 	else
@@ -248,12 +393,85 @@ libevdev_new_from_fd(int fd, struct libevdev **dev)
 	return rc;
 }
 
+LIBEVDEV_EXPORT int
+libevdev_clone(const struct libevdev *dev, struct libevdev **clone)
+{
+	struct libevdev *d;
+	int rc;
+
+	/* the clone has no fd to fetch anything from later, so an earlier
+	 * failed fetch is an error here too */
+	rc = lazy_load(dev, LAZY_STATE);
+	if (rc == 0)
+		rc = dev->lazy_error;
+	if (rc < 0)
+		return rc;
+
+	d = malloc(sizeof(*d));
+	if (!d)
+		return -ENOMEM;
+
+	/* All capabilities and most of the state are fixed-size arrays
+	 * inside the struct, so a plain copy is all we need for those.
+	 * Anything heap-allocated is duplicated below. */
+	memcpy(d, dev, sizeof(*d));
+	d->name = NULL;
+	d->phys = NULL;
+	d->uniq = NULL;
+	d->mt_slot_vals = NULL;
+	d->queue = NULL;
+	d->queue_size = 0;
+	d->queue_next = 0;
+	d->fd = -1;
+	d->grabbed = LIBEVDEV_UNGRAB;
+	d->deferred_log = NULL;
+
+	if ((dev->name && !(d->name = strdup(dev->name))) ||
+	    (dev->phys && !(d->phys = strdup(dev->phys))) ||
+	    (dev->uniq && !(d->uniq = strdup(dev->uniq))))
+		goto err;
+
+	if (dev->realtime) {
+		d->deferred_log = calloc(1, sizeof(*d->deferred_log));
+		if (!d->deferred_log)
+			goto err;
+	}
+
+	if (dev->mt_slot_vals) {
+		size_t sz = dev->num_slots * ABS_MT_CNT * sizeof(int);
+
+		d->mt_slot_vals = malloc(sz);
+		if (!d->mt_slot_vals)
+			goto err;
+		memcpy(d->mt_slot_vals, dev->mt_slot_vals, sz);
+	}
+
+	if (dev->queue_size > 0) {
+		if (queue_alloc(d, dev->queue_size) != 0)
+			goto err;
+		memcpy(d->queue, dev->queue,
+		       dev->queue_next * sizeof(*dev->queue));
+		d->queue_next = dev->queue_next;
+	}
+
+	*clone = d;
+
+	return 0;
+
+err:
+	libevdev_free(d);
+	return -ENOMEM;
+}
+
 LIBEVDEV_EXPORT void
 libevdev_free(struct libevdev *dev)
 {
 	if (!dev)
 		return;
 
+	libevdev_dispatch_deferred_log(dev);
+	free(dev->deferred_log);
+	dev->deferred_log = NULL;
 	queue_free(dev);
 	libevdev_reset(dev);
 	free(dev);
@@ -296,6 +514,68 @@ libevdev_set_device_log_function(struct libevdev *dev,
 	dev->log.userdata = data;
 }
 
+LIBEVDEV_EXPORT int
+libevdev_set_realtime_mode(struct libevdev *dev,
+			   enum libevdev_realtime_mode mode)
+{
+	if (mode != LIBEVDEV_REALTIME_ON && mode != LIBEVDEV_REALTIME_OFF) {
+		log_bug(dev, "invalid realtime mode %#x\n", mode);
+		return -EINVAL;
+	}
+
+	if (mode == LIBEVDEV_REALTIME_ON) {
+		/* don't allocate in the read path */
+		int rc = lazy_load(dev, LAZY_ALL);
+
+		if (rc < 0)
+			return rc;
+		if (!dev->deferred_log) {
+			dev->deferred_log = calloc(1, sizeof(*dev->deferred_log));
+			if (!dev->deferred_log)
+				return -ENOMEM;
+		}
+		dev->realtime = true;
+	} else {
+		dev->realtime = false;
+		libevdev_dispatch_deferred_log(dev);
+		free(dev->deferred_log);
+		dev->deferred_log = NULL;
+	}
+
+	return 0;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_dispatch_deferred_log(struct libevdev *dev)
+{
+	struct deferred_log *log = dev->deferred_log;
+	unsigned int head, tail, ndropped;
+	int count = 0;
+
+	if (!log)
+		return 0;
+
+	head = __atomic_load_n(&log->head, __ATOMIC_ACQUIRE);
+	tail = log->tail;
+
+	while (tail != head) {
+		const struct deferred_log_entry *entry;
+
+		entry = &log->entries[tail % DEFERRED_LOG_SIZE];
+		log_msg(dev, entry->priority, entry->file, entry->line,
+			entry->func, "%s", entry->msg);
+		__atomic_store_n(&log->tail, ++tail, __ATOMIC_RELEASE);
+		count++;
+	}
+
+	ndropped = __atomic_exchange_n(&log->ndropped, 0, __ATOMIC_RELAXED);
+	if (ndropped > 0)
+		log_msg(dev, LIBEVDEV_LOG_INFO, __FILE__, __LINE__, __func__,
+			"%u deferred log messages were dropped\n", ndropped);
+
+	return count;
+}
+
 enum libevdev_log_priority
 _libevdev_log_priority(const struct libevdev *dev)
 {
@@ -324,7 +604,7 @@ reset_tracking_ids(struct libevdev *dev)
 		return;
 
 	for (int slot = 0; slot < dev->num_slots; slot++)
-		libevdev_set_slot_value(dev, slot, ABS_MT_TRACKING_ID, -1);
+		*slot_value(dev, slot, ABS_MT_TRACKING_ID) = -1;
 }
 
 static inline void
@@ -371,11 +651,185 @@ out:
 	return rc;
 }
 
+static int
+fetch_caps(struct libevdev *dev)
+{
+	int rc;
+	int i;
+
+	rc = ioctl(dev->fd, EVIOCGBIT(0, sizeof(dev->bits)), dev->bits);
+	if (rc < 0)
+		return -errno;
+
+	/* Built on a kernel with props, running against a kernel without property
+	   support. This should not be a fatal case, we'll be missing properties but other
+	   than that everything is as expected.
+	 */
+	rc = ioctl(dev->fd, EVIOCGPROP(sizeof(dev->props)), dev->props);
+	if (rc < 0 && errno != EINVAL)
+		return -errno;
+
+	rc = ioctl(dev->fd, EVIOCGBIT(EV_REL, sizeof(dev->rel_bits)), dev->rel_bits);
+	if (rc < 0)
+		return -errno;
+
+	rc = ioctl(dev->fd, EVIOCGBIT(EV_ABS, sizeof(dev->abs_bits)), dev->abs_bits);
+	if (rc < 0)
+		return -errno;
+
+	rc = ioctl(dev->fd, EVIOCGBIT(EV_LED, sizeof(dev->led_bits)), dev->led_bits);
+	if (rc < 0)
+		return -errno;
+
+	rc = ioctl(dev->fd, EVIOCGBIT(EV_KEY, sizeof(dev->key_bits)), dev->key_bits);
+	if (rc < 0)
+		return -errno;
+
+	rc = ioctl(dev->fd, EVIOCGBIT(EV_SW, sizeof(dev->sw_bits)), dev->sw_bits);
+	if (rc < 0)
+		return -errno;
+
+	rc = ioctl(dev->fd, EVIOCGBIT(EV_MSC, sizeof(dev->msc_bits)), dev->msc_bits);
+	if (rc < 0)
+		return -errno;
+
+	rc = ioctl(dev->fd, EVIOCGBIT(EV_FF, sizeof(dev->ff_bits)), dev->ff_bits);
+	if (rc < 0)
+		return -errno;
+
+	rc = ioctl(dev->fd, EVIOCGBIT(EV_SND, sizeof(dev->snd_bits)), dev->snd_bits);
+	if (rc < 0)
+		return -errno;
+
+	/* rep is a special case, always set it to 1 for both values if EV_REP is set */
+	if (bit_is_set(dev->bits, EV_REP)) {
+		for (i = 0; i < REP_CNT; i++)
+			set_bit(dev->rep_bits, i);
+		rc = ioctl(dev->fd, EVIOCGREP, dev->rep_values);
+		if (rc < 0)
+			return -errno;
+	}
+
+	update_device_class(dev);
+
+	return 0;
+}
+
+static int
+fetch_abs(struct libevdev *dev)
+{
+	int rc;
+	int i;
+
+	for (i = ABS_X; i <= ABS_MAX; i++) {
+		if (bit_is_set(dev->abs_bits, i)) {
+			struct input_absinfo abs_info;
+			rc = ioctl(dev->fd, EVIOCGABS(i), &abs_info);
+			if (rc < 0)
+				return -errno;
+
+			fix_invalid_absinfo(dev, i, &abs_info);
+
+			dev->abs_info[i] = abs_info;
+		}
+	}
+
+	return init_slots(dev);
+}
+
+static int
+fetch_state(struct libevdev *dev)
+{
+	int rc;
+
+	rc = ioctl(dev->fd, EVIOCGKEY(sizeof(dev->key_values)), dev->key_values);
+	if (rc < 0)
+		return -errno;
+
+	rc = ioctl(dev->fd, EVIOCGLED(sizeof(dev->led_values)), dev->led_values);
+	if (rc < 0)
+		return -errno;
+
+	rc = ioctl(dev->fd, EVIOCGSW(sizeof(dev->sw_values)), dev->sw_values);
+	if (rc < 0)
+		return -errno;
+
+	if (dev->num_slots != -1) {
+		struct slot_change_state unused[dev->num_slots];
+		sync_mt_state(dev, unused);
+	}
+
+	return 0;
+}
+
+int
+_libevdev_lazy_fetch(const struct libevdev *cdev, unsigned int what)
+{
+	/* Filling in the lazily fetched data does not change the
+	 * device as seen by the caller, hence the const */
+	struct libevdev *dev = (struct libevdev *)cdev;
+	int rc = 0;
+
+	if (what & (LAZY_STATE|LAZY_QUEUE))
+		what |= LAZY_ABS;
+	if (what & LAZY_ABS)
+		what |= LAZY_CAPS;
+	what &= dev->lazy_pending;
+
+	/* Each category is marked as fetched before fetching it, the
+	 * fetch functions use the same getters that trigger a lazy fetch */
+	if (what & LAZY_CAPS) {
+		dev->lazy_pending &= ~LAZY_CAPS;
+		rc = fetch_caps(dev);
+		if (rc < 0)
+			goto out;
+	}
+
+	if (what & LAZY_ABS) {
+		dev->lazy_pending &= ~LAZY_ABS;
+		rc = fetch_abs(dev);
+		if (rc < 0)
+			goto out;
+	}
+
+	if (what & LAZY_STATE) {
+		dev->lazy_pending &= ~LAZY_STATE;
+		rc = fetch_state(dev);
+		if (rc < 0)
+			goto out;
+	}
+
+	if (what & LAZY_QUEUE) {
+		dev->lazy_pending &= ~LAZY_QUEUE;
+		rc = init_event_queue(dev);
+		if (rc < 0)
+			goto out;
+	}
+
+out:
+	/* Only errors after libevdev_set_fd() are logged, during
+	 * libevdev_set_fd() they are returned to the caller. Most callers
+	 * are getters that can't return the error, so log it once and not
+	 * for every getter that finds the data missing. */
+	if (rc < 0 && dev->initialized && !dev->lazy_error) {
+		dev->lazy_error = rc;
+		log_error(dev, "Failed to fetch device data, some of it will appear empty: %s\n",
+			  strerror(-rc));
+	}
+
+	return rc;
+}
+
 LIBEVDEV_EXPORT int
 libevdev_set_fd(struct libevdev* dev, int fd)
+{
+	return libevdev_set_fd_with_flags(dev, fd, 0);
+}
+
+LIBEVDEV_EXPORT int
+libevdev_set_fd_with_flags(struct libevdev* dev, int fd, unsigned int flags)
 {
 	int rc;
-	int i;
 	char buf[256];
 
 	if (dev->initialized) {
@@ -387,11 +841,12 @@ libevdev_set_fd(struct libevdev* dev, int fd)
 		return -EBADF;
 	}
 
-	libevdev_reset(dev);
+	if (flags & ~LIBEVDEV_INIT_FLAG_LAZY) {
+		log_bug(dev, "invalid flags %#x.\n", flags);
+		return -EINVAL;
+	}
 
-	rc = ioctl(fd, EVIOCGBIT(0, sizeof(dev->bits)), dev->bits);
-	if (rc < 0)
-		goto out;
+	libevdev_reset(dev);
 
 	memset(buf, 0, sizeof(buf));
 	rc = ioctl(fd, EVIOCGNAME(sizeof(buf) - 1), buf);
@@ -444,107 +899,30 @@ libevdev_set_fd(struct libevdev* dev, int fd)
 	if (rc < 0)
 		goto out;
 
-	/* Built on a kernel with props, running against a kernel without property
-	   support. This should not be a fatal case, we'll be missing properties but other
-	   than that everything is as expected.
-	 */
-	rc = ioctl(fd, EVIOCGPROP(sizeof(dev->props)), dev->props);
-	if (rc < 0 && errno != EINVAL)
-		goto out;
-
-	rc = ioctl(fd, EVIOCGBIT(EV_REL, sizeof(dev->rel_bits)), dev->rel_bits);
-	if (rc < 0)
-		goto out;
-
-	rc = ioctl(fd, EVIOCGBIT(EV_ABS, sizeof(dev->abs_bits)), dev->abs_bits);
-	if (rc < 0)
-		goto out;
-
-	rc = ioctl(fd, EVIOCGBIT(EV_LED, sizeof(dev->led_bits)), dev->led_bits);
-	if (rc < 0)
-		goto out;
-
-	rc = ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(dev->key_bits)), dev->key_bits);
-	if (rc < 0)
-		goto out;
-
-	rc = ioctl(fd, EVIOCGBIT(EV_SW, sizeof(dev->sw_bits)), dev->sw_bits);
-	if (rc < 0)
-		goto out;
-
-	rc = ioctl(fd, EVIOCGBIT(EV_MSC, sizeof(dev->msc_bits)), dev->msc_bits);
-	if (rc < 0)
-		goto out;
-
-	rc = ioctl(fd, EVIOCGBIT(EV_FF, sizeof(dev->ff_bits)), dev->ff_bits);
-	if (rc < 0)
-		goto out;
-
-	rc = ioctl(fd, EVIOCGBIT(EV_SND, sizeof(dev->snd_bits)), dev->snd_bits);
-	if (rc < 0)
-		goto out;
-
-	rc = ioctl(fd, EVIOCGKEY(sizeof(dev->key_values)), dev->key_values);
-	if (rc < 0)
-		goto out;
-
-	rc = ioctl(fd, EVIOCGLED(sizeof(dev->led_values)), dev->led_values);
-	if (rc < 0)
-		goto out;
-
-	rc = ioctl(fd, EVIOCGSW(sizeof(dev->sw_values)), dev->sw_values);
-	if (rc < 0)
-		goto out;
+	dev->fd = fd;
+	dev->lazy_pending = LAZY_ALL;
 
-	/* rep is a special case, always set it to 1 for both values if EV_REP is set */
-	if (bit_is_set(dev->bits, EV_REP)) {
-		for (i = 0; i < REP_CNT; i++)
-			set_bit(dev->rep_bits, i);
-		rc = ioctl(fd, EVIOCGREP, dev->rep_values);
-		if (rc < 0)
+	/* a realtime device must not fetch anything in the read path */
+	if (!(flags & LIBEVDEV_INIT_FLAG_LAZY) || dev->realtime) {
+		rc = _libevdev_lazy_fetch(dev, LAZY_ALL);
+		if (rc < 0) {
+			errno = -rc;
 			goto out;
-	}
-
-	for (i = ABS_X; i <= ABS_MAX; i++) {
-		if (bit_is_set(dev->abs_bits, i)) {
-			struct input_absinfo abs_info;
-			rc = ioctl(fd, EVIOCGABS(i), &abs_info);
-			if (rc < 0)
-				goto out;
-
-			fix_invalid_absinfo(dev, i, &abs_info);
-
-			dev->abs_info[i] = abs_info;
 		}
 	}
 
-	dev->fd = fd;
-
-	rc = init_slots(dev);
-	if (rc != 0)
-		goto out;
-
-	if (dev->num_slots != -1) {
-		struct slot_change_state unused[dev->num_slots];
-		sync_mt_state(dev, unused);
-	}
-
-	rc = init_event_queue(dev);
-	if (rc < 0) {
-		dev->fd = -1;
-		return -rc;
-	}
-
 	/* not copying key state because we won't know when we'll start to
 	 * use this fd and key's are likely to change state by then.
 	 * Same with the valuators, really, but they may not change.
 	 */
 
 	dev->initialized = true;
+	return 0;
+
 out:
-	if (rc)
-		libevdev_reset(dev);
-	return rc ? -errno : 0;
+	rc = -errno;
+	libevdev_reset(dev);
+	return rc;
 }
 
 LIBEVDEV_EXPORT int
@@ -1133,6 +1511,10 @@ libevdev_next_event(struct libevdev *dev, unsigned int flags, struct input_event
 		return -EINVAL;
 	}
 
+	rc = lazy_load(dev, LAZY_ALL);
+	if (rc < 0)
+		return rc;
+
 	if (flags & LIBEVDEV_READ_FLAG_SYNC) {
 		if (dev->sync_state == SYNC_NEEDED) {
 			rc = sync_state(dev);
@@ -1290,32 +1672,42 @@ libevdev_get_driver_version(const struct libevdev *dev)
 LIBEVDEV_EXPORT int
 libevdev_has_property(const struct libevdev *dev, unsigned int prop)
 {
+	lazy_load(dev, LAZY_CAPS);
+
 	return (prop <= INPUT_PROP_MAX) && bit_is_set(dev->props, prop);
 }
 
 LIBEVDEV_EXPORT int
 libevdev_enable_property(struct libevdev *dev, unsigned int prop)
 {
+	lazy_load(dev, LAZY_STATE);
+
 	if (prop > INPUT_PROP_MAX)
 		return -1;
 
 	set_bit(dev->props, prop);
+	update_device_class(dev);
 	return 0;
 }
 
 LIBEVDEV_EXPORT int
 libevdev_disable_property(struct libevdev *dev, unsigned int prop)
 {
+	lazy_load(dev, LAZY_STATE);
+
 	if (prop > INPUT_PROP_MAX)
 		return -1;
 
 	clear_bit(dev->props, prop);
+	update_device_class(dev);
 	return 0;
 }
 
 LIBEVDEV_EXPORT int
 libevdev_has_event_type(const struct libevdev *dev, unsigned int type)
 {
+	lazy_load(dev, LAZY_CAPS);
+
 	return type == EV_SYN ||(type <= EV_MAX && bit_is_set(dev->bits, type));
 }
 
@@ -1339,11 +1731,126 @@ libevdev_has_event_code(const struct libevdev *dev, unsigned int type, unsigned
 	return bit_is_set(mask, code);
 }
 
+LIBEVDEV_EXPORT int
+libevdev_get_event_code_count(const struct libevdev *dev, unsigned int type)
+{
+	const unsigned long *mask = NULL;
+	int max;
+
+	lazy_load(dev, LAZY_CAPS);
+
+	if (type > EV_MAX)
+		return -1;
+
+	max = type_to_mask_const(dev, type, &mask);
+	if (max == -1)
+		return -1;
+
+	if (!libevdev_has_event_type(dev, type))
+		return 0;
+
+	return bit_count(mask, 0, max + 1);
+}
+
+LIBEVDEV_EXPORT void
+libevdev_get_capability_summary(const struct libevdev *dev,
+				struct libevdev_capability_summary *summary,
+				size_t size)
+{
+	struct libevdev_capability_summary s = {0};
+	unsigned int type;
+
+	lazy_load(dev, LAZY_ABS);
+
+	for (type = 0; type < EV_CNT; type++) {
+		int count;
+
+		if (!libevdev_has_event_type(dev, type))
+			continue;
+
+		s.ntypes++;
+		count = libevdev_get_event_code_count(dev, type);
+		if (count > 0) {
+			s.ncodes[type] = count;
+			s.ncodes_total += count;
+		}
+	}
+
+	s.nprops = bit_count(dev->props, 0, INPUT_PROP_CNT);
+	s.nslots = libevdev_get_num_slots(dev);
+	s.nmt_axes = count_mt_axes(dev);
+
+	if (size > sizeof(s)) {
+		memset((char*)summary + sizeof(s), 0, size - sizeof(s));
+		size = sizeof(s);
+	}
+	memcpy(summary, &s, size);
+}
+
+LIBEVDEV_EXPORT unsigned int
+libevdev_get_device_class(const struct libevdev *dev)
+{
+	lazy_load(dev, LAZY_CAPS);
+
+	return dev->device_class;
+}
+
+static size_t
+copy_bits(unsigned long *out, size_t nlongs,
+	  const unsigned long *bits, size_t nbits)
+{
+	size_t needed = NLONGS(nbits);
+	size_t ncopy = min(needed, nlongs);
+
+	if (bits && ncopy > 0)
+		memcpy(out, bits, ncopy * sizeof(*out));
+	else
+		ncopy = 0;
+
+	if (nlongs > ncopy)
+		memset(out + ncopy, 0, (nlongs - ncopy) * sizeof(*out));
+
+	return needed;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_get_event_code_bits(const struct libevdev *dev, unsigned int type,
+			     unsigned long *bits, size_t nlongs)
+{
+	const unsigned long *mask = NULL;
+	int max;
+
+	lazy_load(dev, LAZY_CAPS);
+
+	if (type > EV_MAX)
+		return -1;
+
+	max = type_to_mask_const(dev, type, &mask);
+	if (max == -1)
+		return -1;
+
+	if (!libevdev_has_event_type(dev, type))
+		mask = NULL;
+
+	return copy_bits(bits, nlongs, mask, max + 1);
+}
+
+LIBEVDEV_EXPORT int
+libevdev_get_property_bits(const struct libevdev *dev,
+			   unsigned long *bits, size_t nlongs)
+{
+	lazy_load(dev, LAZY_CAPS);
+
+	return copy_bits(bits, nlongs, dev->props, INPUT_PROP_CNT);
+}
+
 LIBEVDEV_EXPORT int
 libevdev_get_event_value(const struct libevdev *dev, unsigned int type, unsigned int code)
 {
 	int value = 0;
 
+	lazy_load(dev, LAZY_STATE);
+
 	if (!libevdev_has_event_type(dev, type) || !libevdev_has_event_code(dev, type, code))
 		return 0;
 
@@ -1379,6 +1886,8 @@ libevdev_set_event_value(struct libevdev *dev, unsigned int type, unsigned int c
 	int rc = 0;
 	struct input_event e;
 
+	lazy_load(dev, LAZY_STATE);
+
 	if (!libevdev_has_event_type(dev, type) || !libevdev_has_event_code(dev, type, code))
 		return -1;
 
@@ -1417,6 +1926,8 @@ libevdev_fetch_event_value(const struct libevdev *dev, unsigned int type, unsign
 LIBEVDEV_EXPORT int
 libevdev_get_slot_value(const struct libevdev *dev, unsigned int slot, unsigned int code)
 {
+	lazy_load(dev, LAZY_STATE);
+
 	if (!libevdev_has_event_type(dev, EV_ABS) || !libevdev_has_event_code(dev, EV_ABS, code))
 		return 0;
 
@@ -1432,6 +1943,8 @@ libevdev_get_slot_value(const struct libevdev *dev, unsigned int slot, unsigned
 LIBEVDEV_EXPORT int
 libevdev_set_slot_value(struct libevdev *dev, unsigned int slot, unsigned int code, int value)
 {
+	lazy_load(dev, LAZY_STATE);
+
 	if (!libevdev_has_event_type(dev, EV_ABS) || !libevdev_has_event_code(dev, EV_ABS, code))
 		return -1;
 
@@ -1455,6 +1968,8 @@ libevdev_set_slot_value(struct libevdev *dev, unsigned int slot, unsigned int co
 LIBEVDEV_EXPORT int
 libevdev_fetch_slot_value(const struct libevdev *dev, unsigned int slot, unsigned int code, int *value)
 {
+	lazy_load(dev, LAZY_STATE);
+
 	if (libevdev_has_event_type(dev, EV_ABS) &&
 	    libevdev_has_event_code(dev, EV_ABS, code) &&
 	    dev->num_slots >= 0 &&
@@ -1469,18 +1984,24 @@ libevdev_fetch_slot_value(const struct libevdev *dev, unsigned int slot, unsigne
 LIBEVDEV_EXPORT int
 libevdev_get_num_slots(const struct libevdev *dev)
 {
+	lazy_load(dev, LAZY_ABS);
+
 	return dev->num_slots;
 }
 
 LIBEVDEV_EXPORT int
 libevdev_get_current_slot(const struct libevdev *dev)
 {
+	lazy_load(dev, LAZY_STATE);
+
 	return dev->current_slot;
 }
 
 LIBEVDEV_EXPORT const struct input_absinfo*
 libevdev_get_abs_info(const struct libevdev *dev, unsigned int code)
 {
+	lazy_load(dev, LAZY_ABS);
+
 	if (!libevdev_has_event_type(dev, EV_ABS) ||
 	    !libevdev_has_event_code(dev, EV_ABS, code))
 		return NULL;
@@ -1504,6 +2025,7 @@ ABS_GETTER(resolution)
 #define ABS_SETTER(field) \
 LIBEVDEV_EXPORT void libevdev_set_abs_##field(struct libevdev *dev, unsigned int code, int val) \
 { \
+	lazy_load(dev, LAZY_STATE); \
 	if (!libevdev_has_event_code(dev, EV_ABS, code)) \
 		return; \
 	dev->abs_info[code].field = val; \
@@ -1518,6 +2040,8 @@ ABS_SETTER(resolution)
 LIBEVDEV_EXPORT void
 libevdev_set_abs_info(struct libevdev *dev, unsigned int code, const struct input_absinfo *abs)
 {
+	lazy_load(dev, LAZY_STATE);
+
 	if (!libevdev_has_event_code(dev, EV_ABS, code))
 		return;
 
@@ -1529,6 +2053,8 @@ libevdev_enable_event_type(struct libevdev *dev, unsigned int type)
 {
 	int max;
 
+	lazy_load(dev, LAZY_STATE);
+
 	if (type > EV_MAX)
 		return -1;
 
@@ -1540,6 +2066,7 @@ libevdev_enable_event_type(struct libevdev *dev, unsigned int type)
 		return -1;
 
 	set_bit(dev->bits, type);
+	update_device_class(dev);
 
 	if (type == EV_REP) {
 		int delay = 0, period = 0;
@@ -1554,6 +2081,8 @@ libevdev_disable_event_type(struct libevdev *dev, unsigned int type)
 {
 	int max;
 
+	lazy_load(dev, LAZY_STATE);
+
 	if (type > EV_MAX || type == EV_SYN)
 		return -1;
 
@@ -1562,6 +2091,7 @@ libevdev_disable_event_type(struct libevdev *dev, unsigned int type)
 		return -1;
 
 	clear_bit(dev->bits, type);
+	update_device_class(dev);
 
 	return 0;
 }
@@ -1573,6 +2103,8 @@ libevdev_enable_event_code(struct libevdev *dev, unsigned int type,
 	unsigned int max;
 	unsigned long *mask = NULL;
 
+	lazy_load(dev, LAZY_STATE);
+
 	if (libevdev_enable_event_type(dev, type))
 		return -1;
 
@@ -1611,6 +2143,8 @@ libevdev_enable_event_code(struct libevdev *dev, unsigned int type,
 		dev->rep_values[code] = *value;
 	}
 
+	update_device_class(dev);
+
 	return 0;
 }
 
@@ -1620,6 +2154,8 @@ libevdev_disable_event_code(struct libevdev *dev, unsigned int type, unsigned in
 	unsigned int max;
 	unsigned long *mask = NULL;
 
+	lazy_load(dev, LAZY_STATE);
+
 	if (type > EV_MAX || type == EV_SYN)
 		return -1;
 
@@ -1629,6 +2165,7 @@ libevdev_disable_event_code(struct libevdev *dev, unsigned int type, unsigned in
 		return -1;
 
 	clear_bit(mask, code);
+	update_device_class(dev);
 
 	if (type == EV_ABS) {
 		if (code == ABS_MT_SLOT) {
@@ -1642,6 +2179,104 @@ libevdev_disable_event_code(struct libevdev *dev, unsigned int type, unsigned in
 	return 0;
 }
 
+static int
+check_event_code_bits(struct libevdev *dev, unsigned int type,
+		      const unsigned long *bitmap, size_t nbits,
+		      unsigned long **mask)
+{
+	int max;
+
+	if (type > EV_MAX || type == EV_SYN)
+		return -1;
+
+	max = type_to_mask(dev, type, mask);
+	if (max == -1)
+		return -1;
+
+	if (nbits > (size_t)max + 1 &&
+	    bit_count(bitmap, max + 1, nbits) > 0)
+		return -1;
+
+	return max;
+}
+
+static void
+change_event_code_bits(unsigned long *mask, const unsigned long *bitmap,
+		       size_t nbits, bool enable)
+{
+	size_t nlongs = nbits / LONG_BITS;
+	size_t i;
+
+	for (i = 0; i < nlongs; i++) {
+		if (enable)
+			mask[i] |= bitmap[i];
+		else
+			mask[i] &= ~bitmap[i];
+	}
+
+	for (i = nlongs * LONG_BITS; i < nbits; i++) {
+		if (bit_is_set(bitmap, i))
+			set_bit_state(mask, i, enable);
+	}
+}
+
+LIBEVDEV_EXPORT int
+libevdev_enable_event_codes(struct libevdev *dev, unsigned int type,
+			    const unsigned long *bitmap, size_t nbits)
+{
+	unsigned long *mask = NULL;
+	int max;
+
+	lazy_load(dev, LAZY_STATE);
+
+	/* these need per-code data, use libevdev_enable_event_code() */
+	if (type == EV_ABS || type == EV_REP)
+		return -1;
+
+	max = check_event_code_bits(dev, type, bitmap, nbits, &mask);
+	if (max == -1)
+		return -1;
+
+	if (libevdev_enable_event_type(dev, type))
+		return -1;
+
+	change_event_code_bits(mask, bitmap, min(nbits, (size_t)max + 1), true);
+	update_device_class(dev);
+
+	return 0;
+}
+
+LIBEVDEV_EXPORT int
+libevdev_disable_event_codes(struct libevdev *dev, unsigned int type,
+			     const unsigned long *bitmap, size_t nbits)
+{
+	unsigned long *mask = NULL;
+	int max;
+
+	lazy_load(dev, LAZY_STATE);
+
+	max = check_event_code_bits(dev, type, bitmap, nbits, &mask);
+	if (max == -1)
+		return -1;
+
+	nbits = min(nbits, (size_t)max + 1);
+	change_event_code_bits(mask, bitmap, nbits, false);
+	update_device_class(dev);
+
+	/* one slot update for the whole set, not one per code */
+	if (type == EV_ABS) {
+		if (nbits > ABS_MT_SLOT && bit_is_set(bitmap, ABS_MT_SLOT)) {
+			if (init_slots(dev) != 0)
+				return -1;
+		} else if (nbits > ABS_MT_TRACKING_ID &&
+			   bit_is_set(bitmap, ABS_MT_TRACKING_ID)) {
+			reset_tracking_ids(dev);
+		}
+	}
+
+	return 0;
+}
+
 LIBEVDEV_EXPORT int
 libevdev_kernel_set_abs_info(struct libevdev *dev, unsigned int code, const struct input_absinfo *abs)
 {
@@ -1723,7 +2358,7 @@ libevdev_event_type_get_name(unsigned int type)
 	if (type > EV_MAX)
 		return NULL;
 
-	return ev_map[type];
+	return name_from_offset(ev_map[type]);
 }
 
 LIBEVDEV_EXPORT const char*
@@ -1734,7 +2369,7 @@ libevdev_event_code_get_name(unsigned int type, unsigned int code)
 	if (max == -1 || code > (unsigned int)max)
 		return NULL;
 
-	return event_type_map[type][code];
+	return name_from_offset(code_map[event_type_map[type] + code]);
 }
 
 LIBEVDEV_EXPORT const char *
@@ -1751,7 +2386,7 @@ libevdev_event_value_get_name(unsigned int type,
 	if (value < 0 || value > MT_TOOL_MAX)
 		return NULL;
 
-	return mt_tool_map[value];
+	return name_from_offset(mt_tool_map[value]);
 }
 
 LIBEVDEV_EXPORT const char*
@@ -1760,7 +2395,7 @@ libevdev_property_get_name(unsigned int prop)
 	if (prop > INPUT_PROP_MAX)
 		return NULL;
 
-	return input_prop_map[prop];
+	return name_from_offset(input_prop_map[prop]);
 }
 
 LIBEVDEV_EXPORT int
@@ -1775,6 +2410,8 @@ libevdev_event_type_get_max(unsigned int type)
 LIBEVDEV_EXPORT int
 libevdev_get_repeat(const struct libevdev *dev, int *delay, int *period)
 {
+	lazy_load(dev, LAZY_CAPS);
+
 	if (!libevdev_has_event_type(dev, EV_REP))
 		return -1;
 
@@ -1810,6 +2447,8 @@ libevdev_kernel_set_led_values(struct libevdev *dev, ...)
 	if (dev->fd < 0)
 		return -EBADF;
 
+	lazy_load(dev, LAZY_STATE);
+
 	memset(ev, 0, sizeof(ev));
 
 	va_start(args, dev);
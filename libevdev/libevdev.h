@@ -74,6 +74,11 @@ extern "C" {
  * Check the API documentation to make sure, unless explicitly stated a call
  * is <b>not</b> signal safe.
  *
+ * A device initialized with LIBEVDEV_INIT_FLAG_LAZY fetches its data on
+ * first access. Until all of it has been fetched, a call that needs data
+ * not fetched yet issues ioctls and may allocate memory. Such calls are
+ * not signal-safe.
+ *
  * Device handling
  * ===============
  *
@@ -686,6 +691,34 @@ extern "C" {
  * device and thus returns outdated values.
  */
 
+/**
+ * @defgroup capset Capability sets
+ *
+ * A capability set is a set of event codes and input properties,
+ * independent of any device. Sets can be built by hand or extracted from a
+ * device with libevdev_capset_new_from_device(), and then combined and
+ * compared with operations that work on whole words of the underlying
+ * bitmaps rather than on individual codes.
+ *
+ * A typical use is matching a device against a list of rules:
+ *
+ * @code
+ * struct libevdev_capset *device = libevdev_capset_new_from_device(dev);
+ *
+ * for (i = 0; i < nrules; i++) {
+ *     if (libevdev_capset_is_subset(rules[i].required, device) &&
+ *         libevdev_capset_is_disjoint(rules[i].forbidden, device))
+ *         printf("rule %d matches\n", i);
+ * }
+ *
+ * libevdev_capset_free(device);
+ * @endcode
+ *
+ * Event types are not part of a capability set, a set contains an
+ * event type if it contains one or more codes of that type. Codes of
+ * EV_SYN, EV_PWR and EV_FF_STATUS cannot be added to a set.
+ */
+
 /**
  * @defgroup mt Multi-touch related functions
  * Functions for querying multi-touch-related capabilities. MT devices
@@ -809,6 +842,57 @@ struct libevdev* libevdev_new(void);
  */
 int libevdev_new_from_fd(int fd, struct libevdev **dev);
 
+/**
+ * @ingroup init
+ *
+ * Like libevdev_new_from_fd(), but with a bitmask of enum
+ * libevdev_init_flag, see libevdev_set_fd_with_flags().
+ *
+ * @param fd A file descriptor to the device in O_RDWR or O_RDONLY mode.
+ * @param flags A bitmask of enum libevdev_init_flag, or 0
+ * @param[out] dev The newly initialized evdev device.
+ *
+ * @return On success, 0 is returned and dev is set to the newly
+ * allocated struct. On failure, a negative errno is returned and the value
+ * of dev is undefined.
+ *
+ * @see libevdev_set_fd_with_flags
+ * @since 1.14
+ */
+int libevdev_new_from_fd_with_flags(int fd, unsigned int flags, struct libevdev **dev);
+
+/**
+ * @ingroup init
+ *
+ * Create a copy of the given device. The clone has the same capabilities,
+ * the same device state (including the state of each multitouch slot) and
+ * the same events queued internally as @p dev. It is independent of @p dev,
+ * changes to either device do not affect the other.
+ *
+ * The clone is detached from the file descriptor: libevdev_get_fd()
+ * returns -1 and libevdev_next_event() fails with -EBADF until a file
+ * descriptor is assigned with libevdev_change_fd(). Events can thus be fed
+ * to the clone by hand by writing them into a pipe and passing the
+ * pipe's read end to libevdev_change_fd(). The clone is never grabbed.
+ *
+ * Per-device log handlers are copied, messages deferred in realtime mode
+ * are not.
+ *
+ * Memory allocated through libevdev_clone() must be released by the
+ * caller with libevdev_free().
+ *
+ * @param dev The evdev device to clone
+ * @param[out] clone The newly allocated copy of @p dev
+ *
+ * @return 0 on success or a negative errno on failure. On failure, the
+ * value of clone is unmodified. For a device initialized with
+ * LIBEVDEV_INIT_FLAG_LAZY, this includes failing to fetch the device data.
+ *
+ * @see libevdev_change_fd
+ * @since 1.14
+ */
+int libevdev_clone(const struct libevdev *dev, struct libevdev **clone);
+
 /**
  * @ingroup init
  *
@@ -1022,6 +1106,57 @@ int libevdev_grab(struct libevdev *dev, enum libevdev_grab_mode grab);
  */
 int libevdev_set_fd(struct libevdev* dev, int fd);
 
+/**
+ * @ingroup init
+ *
+ * Flags for libevdev_set_fd_with_flags() and
+ * libevdev_new_from_fd_with_flags().
+ *
+ * @since 1.14
+ */
+enum libevdev_init_flag {
+	LIBEVDEV_INIT_FLAG_LAZY	= 1 /**< Fetch capabilities and state on first access */
+};
+
+/**
+ * @ingroup init
+ *
+ * Like libevdev_set_fd(), but with a bitmask of enum libevdev_init_flag to
+ * change the initialization.
+ *
+ * With LIBEVDEV_INIT_FLAG_LAZY, only the device's name, phys, uniq, ids
+ * and driver version are fetched during this call. The event bits and
+ * properties, the axis information and the device state are each fetched
+ * the first time a function that needs them is called, and the internal
+ * event queue is allocated on the first call to libevdev_next_event().
+ * This makes enumerating devices by name or id considerably cheaper.
+ *
+ * A lazily initialized device behaves exactly like a device initialized
+ * with libevdev_set_fd(), except that:
+ * - the fd must remain valid until all data has been fetched. Any call to
+ *   libevdev_next_event() fetches all remaining data.
+ * - the device state is that of the time of the first access, not
+ *   that of the call to this function.
+ * - errors fetching the data after this call are logged once, the
+ *   affected data appears empty to the caller.
+ *
+ * Enabling realtime mode with libevdev_set_realtime_mode() fetches all
+ * remaining data so that libevdev_next_event() does not allocate. If
+ * realtime mode is already enabled, LIBEVDEV_INIT_FLAG_LAZY is ignored
+ * and all data is fetched during this call.
+ *
+ * @param dev The evdev device
+ * @param fd The file descriptor for the device
+ * @param flags A bitmask of enum libevdev_init_flag, or 0
+ *
+ * @return 0 on success, or a negative errno on failure. -EINVAL is
+ * returned for invalid flags.
+ *
+ * @see libevdev_set_fd
+ * @since 1.14
+ */
+int libevdev_set_fd_with_flags(struct libevdev* dev, int fd, unsigned int flags);
+
 /**
  * @ingroup init
  *
@@ -1142,7 +1277,11 @@ enum libevdev_read_status {
  * @retval LIBEVDEV_READ_STATUS_SYNC A SYN_DROPPED event was received, or a
  * synced event was returned and ev points to the SYN_DROPPED event
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
+ * @note This function is realtime-safe if the device is in realtime mode,
+ * see libevdev_set_realtime_mode(). Realtime mode fetches lazily
+ * initialized data up front.
  */
 int libevdev_next_event(struct libevdev *dev, unsigned int flags, struct input_event *ev);
 
@@ -1170,6 +1309,74 @@ int libevdev_next_event(struct libevdev *dev, unsigned int flags, struct input_e
  */
 int libevdev_has_event_pending(struct libevdev *dev);
 
+/**
+ * @ingroup events
+ */
+enum libevdev_realtime_mode {
+	LIBEVDEV_REALTIME_OFF = 0, /**< Log messages are passed to the log handler immediately */
+	LIBEVDEV_REALTIME_ON = 1   /**< Log messages are deferred, see libevdev_set_realtime_mode() */
+};
+
+/**
+ * @ingroup events
+ *
+ * Switch the device into or out of realtime mode. In realtime mode,
+ * libevdev_next_event() is safe to call from a realtime thread:
+ * - it does not allocate memory,
+ * - it does not take any locks,
+ * - it does not call the log handler and thus does no logging I/O,
+ * - its only system call is read(2) on the device's fd, plus the
+ *   ioctls required to sync the device after a `SYN_DROPPED`.
+ *
+ * Messages that would otherwise be passed to the log handler (e.g. for
+ * a device sending invalid slot numbers or tracking IDs) are stored in a
+ * fixed-size per-device ring instead. The ring is lock-free; a different
+ * thread may call libevdev_dispatch_deferred_log() to pass the messages
+ * to the log handler while the realtime thread keeps reading events. If
+ * the ring is full, further messages are dropped and the number of dropped
+ * messages is logged on the next dispatch.
+ *
+ * Realtime mode applies to every message logged for this device,
+ * including those logged by functions other than libevdev_next_event().
+ * The ring is allocated when realtime mode is enabled and freed when it
+ * is disabled. Disabling realtime mode dispatches all pending messages.
+ * libevdev_free() dispatches all pending messages before the device is
+ * freed.
+ *
+ * @param dev The evdev device
+ * @param mode @ref LIBEVDEV_REALTIME_ON to enable realtime mode, @ref
+ * LIBEVDEV_REALTIME_OFF to disable it
+ *
+ * @return 0 on success or a negative errno on failure. Enabling realtime
+ * mode fails if the remaining data of a device initialized with
+ * LIBEVDEV_INIT_FLAG_LAZY cannot be fetched, the device then stays out
+ * of realtime mode.
+ *
+ * @note This function may be called before libevdev_set_fd().
+ *
+ * @see libevdev_dispatch_deferred_log
+ * @since 1.14
+ */
+int libevdev_set_realtime_mode(struct libevdev *dev,
+			       enum libevdev_realtime_mode mode);
+
+/**
+ * @ingroup events
+ *
+ * Pass all messages deferred in realtime mode to the log handler, in the
+ * order they were logged. This function may be called from a different
+ * thread than the one calling libevdev_next_event(), but only one thread
+ * may call this function for a given device at any time.
+ *
+ * @param dev The evdev device
+ *
+ * @return The number of messages passed to the log handler
+ *
+ * @see libevdev_set_realtime_mode
+ * @since 1.14
+ */
+int libevdev_dispatch_deferred_log(struct libevdev *dev);
+
 /**
  * @ingroup bits
  *
@@ -1378,7 +1585,8 @@ int libevdev_get_driver_version(const struct libevdev *dev);
  *
  * @return 1 if the device provides this input property, or 0 otherwise.
  *
- * @note This function is signal-safe
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  */
 int libevdev_has_property(const struct libevdev *dev, unsigned int prop);
 
@@ -1413,7 +1621,8 @@ int libevdev_disable_property(struct libevdev *dev, unsigned int prop);
  *
  * @return 1 if the device supports this event type, or 0 otherwise.
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  */
 int libevdev_has_event_type(const struct libevdev *dev, unsigned int type);
 
@@ -1426,10 +1635,408 @@ int libevdev_has_event_type(const struct libevdev *dev, unsigned int type);
  *
  * @return 1 if the device supports this event type and code, or 0 otherwise.
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  */
 int libevdev_has_event_code(const struct libevdev *dev, unsigned int type, unsigned int code);
 
+/**
+ * @ingroup bits
+ *
+ * Get the number of event codes of the given type supported by this
+ * device. This is equivalent to, but much faster than, calling
+ * libevdev_has_event_code() for every code of the type.
+ *
+ * @param dev The evdev device, already initialized with libevdev_set_fd()
+ * @param type The event type to count the codes for (EV_REL, EV_ABS, etc.)
+ *
+ * @return The number of event codes supported for this type, 0 if the
+ * device does not support the type, or -1 if the type is invalid or
+ * libevdev does not track the codes for this type (e.g. EV_SYN)
+ *
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
+ * @see libevdev_get_capability_summary
+ * @since 1.14
+ */
+int libevdev_get_event_code_count(const struct libevdev *dev, unsigned int type);
+
+/**
+ * @ingroup bits
+ *
+ * Summary of a device's capabilities, filled in by
+ * libevdev_get_capability_summary().
+ *
+ * Future versions of libevdev may append members to this struct, existing
+ * members never change. Always pass sizeof(struct
+ * libevdev_capability_summary) as seen by the caller to
+ * libevdev_get_capability_summary().
+ *
+ * @since 1.14
+ */
+struct libevdev_capability_summary {
+	unsigned int ntypes;		/**< number of event types, including EV_SYN */
+	unsigned int ncodes[EV_CNT];	/**< number of codes for each event type,
+					  see libevdev_get_event_code_count() */
+	unsigned int ncodes_total;	/**< sum of all ncodes */
+	unsigned int nprops;		/**< number of input properties */
+	int nslots;			/**< number of slots, see libevdev_get_num_slots() */
+	unsigned int nmt_axes;		/**< number of ABS_MT_* axes, including
+					  ABS_MT_SLOT */
+};
+
+/**
+ * @ingroup bits
+ *
+ * Fill in a summary of the device's capabilities: the number of event
+ * types, the number of codes for each type, the number of properties and
+ * the multitouch slot layout.
+ *
+ * The summary is a snapshot, it is not updated when the device's
+ * capabilities change later.
+ *
+ * Only the first size bytes of summary are written. If size is larger
+ * than the struct known to this version of libevdev, the remaining bytes
+ * are set to zero. This allows the struct to grow without breaking
+ * callers compiled against an older or newer version.
+ *
+ * @param dev The evdev device, already initialized with libevdev_set_fd()
+ * @param[out] summary Set to the device's capability summary
+ * @param size The size of summary in bytes, usually
+ * sizeof(struct libevdev_capability_summary)
+ *
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
+ * @since 1.14
+ */
+void libevdev_get_capability_summary(const struct libevdev *dev,
+				     struct libevdev_capability_summary *summary,
+				     size_t size);
+
+/**
+ * @ingroup bits
+ *
+ * Device classes as returned by libevdev_get_device_class(). A device may
+ * have more than one class, e.g. a keyboard with an integrated pointing
+ * stick.
+ *
+ * @since 1.14
+ */
+enum libevdev_device_class {
+	LIBEVDEV_DEVICE_CLASS_KEYBOARD		= (1 << 0), /**< Has the first 32 keys of a keyboard */
+	LIBEVDEV_DEVICE_CLASS_POINTER		= (1 << 1), /**< Mouse, trackball, pointing stick or an
+								 absolute pointer without touch or tools */
+	LIBEVDEV_DEVICE_CLASS_TOUCHPAD		= (1 << 2), /**< Indirect touch device */
+	LIBEVDEV_DEVICE_CLASS_TOUCHSCREEN	= (1 << 3), /**< Direct touch device */
+	LIBEVDEV_DEVICE_CLASS_TABLET		= (1 << 4), /**< Has a stylus or other tablet tools */
+	LIBEVDEV_DEVICE_CLASS_JOYSTICK		= (1 << 5), /**< Has joystick or gamepad buttons */
+	LIBEVDEV_DEVICE_CLASS_SWITCH		= (1 << 6)  /**< Has switches (lid, tablet mode, ...) */
+};
+
+/**
+ * @ingroup bits
+ *
+ * Get the classes of this device, a bitmask of enum libevdev_device_class.
+ * The classification is based on the device's event codes and properties
+ * only and is a heuristic, similar to the one used by udev. Callers that
+ * need a specific policy should check the capabilities themselves.
+ *
+ * The classification is computed in libevdev_set_fd() and updated
+ * whenever the device's capabilities are changed with
+ * libevdev_enable_event_code(), libevdev_enable_property() and the
+ * related functions. Calling this function is cheap.
+ *
+ * @param dev The evdev device, already initialized with libevdev_set_fd()
+ *
+ * @return A bitmask of enum libevdev_device_class, or 0 if the device
+ * does not fit any class
+ *
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
+ * @since 1.14
+ */
+unsigned int libevdev_get_device_class(const struct libevdev *dev);
+
+/**
+ * @ingroup bits
+ *
+ * Copy the bitmap of the event codes of the given type supported by this
+ * device into the caller-provided array. The bitmap has the same layout as
+ * the one returned by the kernel's EVIOCGBIT ioctl: code n is bit
+ * n % (sizeof(long) * 8) of bits[n / (sizeof(long) * 8)].
+ *
+ * If the array is too small, the bitmap is truncated. If the array is
+ * larger than required, the remainder is zeroed. If the device does not
+ * support the type, the array is zeroed. A caller may pass a nlongs of 0
+ * to query the required size.
+ *
+ * @param dev The evdev device, already initialized with libevdev_set_fd()
+ * @param type The event type to get the bitmap for (EV_REL, EV_ABS, etc.)
+ * @param[out] bits The array to copy the bitmap into
+ * @param nlongs The number of elements in bits
+ *
+ * @return The number of elements required to hold the full bitmap for this
+ * type, or -1 if the type is invalid or libevdev does not track the codes
+ * for this type (e.g. EV_SYN)
+ *
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
+ * @see libevdev_enable_event_codes
+ * @since 1.14
+ */
+int libevdev_get_event_code_bits(const struct libevdev *dev, unsigned int type,
+				 unsigned long *bits, size_t nlongs);
+
+/**
+ * @ingroup bits
+ *
+ * Copy the bitmap of the input properties of this device into the
+ * caller-provided array. See libevdev_get_event_code_bits() for the
+ * bitmap layout and the handling of the array size.
+ *
+ * @param dev The evdev device, already initialized with libevdev_set_fd()
+ * @param[out] bits The array to copy the bitmap into
+ * @param nlongs The number of elements in bits
+ *
+ * @return The number of elements required to hold the full property
+ * bitmap
+ *
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
+ * @since 1.14
+ */
+int libevdev_get_property_bits(const struct libevdev *dev,
+			       unsigned long *bits, size_t nlongs);
+
+/**
+ * @ingroup capset
+ *
+ * Opaque struct representing a set of event codes and input properties.
+ */
+struct libevdev_capset;
+
+/**
+ * @ingroup capset
+ *
+ * Allocate a new, empty capability set. The set must be freed with
+ * libevdev_capset_free().
+ *
+ * @return A newly allocated capability set or NULL on failure
+ *
+ * @since 1.14
+ */
+struct libevdev_capset *libevdev_capset_new(void);
+
+/**
+ * @ingroup capset
+ *
+ * Allocate a new capability set containing the event codes and input
+ * properties currently enabled on the given device. Later changes to the
+ * device's capabilities are not reflected in the set.
+ *
+ * @param dev The evdev device, already initialized with libevdev_set_fd()
+ *
+ * @return A newly allocated capability set or NULL on failure
+ *
+ * @since 1.14
+ */
+struct libevdev_capset *libevdev_capset_new_from_device(const struct libevdev *dev);
+
+/**
+ * @ingroup capset
+ *
+ * Free a capability set. Passing NULL is a no-op.
+ *
+ * @param set The set to free
+ *
+ * @since 1.14
+ */
+void libevdev_capset_free(struct libevdev_capset *set);
+
+/**
+ * @ingroup capset
+ *
+ * @param set The capability set
+ * @param type The event type of the code to add (EV_KEY, EV_ABS, ...)
+ * @param code The event code to add (KEY_A, ABS_X, ...)
+ *
+ * @return 0 on success or -1 if the type or code is invalid
+ *
+ * @since 1.14
+ */
+int libevdev_capset_enable_event_code(struct libevdev_capset *set,
+				      unsigned int type, unsigned int code);
+
+/**
+ * @ingroup capset
+ *
+ * @param set The capability set
+ * @param type The event type of the code to remove (EV_KEY, EV_ABS, ...)
+ * @param code The event code to remove (KEY_A, ABS_X, ...)
+ *
+ * @return 0 on success or -1 if the type or code is invalid
+ *
+ * @since 1.14
+ */
+int libevdev_capset_disable_event_code(struct libevdev_capset *set,
+				       unsigned int type, unsigned int code);
+
+/**
+ * @ingroup capset
+ *
+ * @param set The capability set
+ * @param type The event type of the code to query (EV_KEY, EV_ABS, ...)
+ * @param code The event code to query (KEY_A, ABS_X, ...)
+ *
+ * @return 1 if the set contains this event code, or 0 otherwise
+ *
+ * @since 1.14
+ */
+int libevdev_capset_has_event_code(const struct libevdev_capset *set,
+				   unsigned int type, unsigned int code);
+
+/**
+ * @ingroup capset
+ *
+ * @param set The capability set
+ * @param prop The input property to add, one of INPUT_PROP_...
+ *
+ * @return 0 on success or -1 if the property is invalid
+ *
+ * @since 1.14
+ */
+int libevdev_capset_enable_property(struct libevdev_capset *set, unsigned int prop);
+
+/**
+ * @ingroup capset
+ *
+ * @param set The capability set
+ * @param prop The input property to remove, one of INPUT_PROP_...
+ *
+ * @return 0 on success or -1 if the property is invalid
+ *
+ * @since 1.14
+ */
+int libevdev_capset_disable_property(struct libevdev_capset *set, unsigned int prop);
+
+/**
+ * @ingroup capset
+ *
+ * @param set The capability set
+ * @param prop The input property to query, one of INPUT_PROP_...
+ *
+ * @return 1 if the set contains this input property, or 0 otherwise
+ *
+ * @since 1.14
+ */
+int libevdev_capset_has_property(const struct libevdev_capset *set, unsigned int prop);
+
+/**
+ * @ingroup capset
+ *
+ * Add all event codes and properties in other to set.
+ *
+ * @param set The capability set to modify
+ * @param other The capability set to merge into set
+ *
+ * @since 1.14
+ */
+void libevdev_capset_union(struct libevdev_capset *set,
+			   const struct libevdev_capset *other);
+
+/**
+ * @ingroup capset
+ *
+ * Remove all event codes and properties from set that are not in other.
+ *
+ * @param set The capability set to modify
+ * @param other The capability set to intersect set with
+ *
+ * @since 1.14
+ */
+void libevdev_capset_intersect(struct libevdev_capset *set,
+			       const struct libevdev_capset *other);
+
+/**
+ * @ingroup capset
+ *
+ * @param set The capability set to check
+ * @param other The capability set to check against
+ *
+ * @return 1 if every event code and property in set is also in other, or 0
+ * otherwise. An empty set is a subset of every set.
+ *
+ * @since 1.14
+ */
+int libevdev_capset_is_subset(const struct libevdev_capset *set,
+			      const struct libevdev_capset *other);
+
+/**
+ * @ingroup capset
+ *
+ * @param set The capability set to check
+ * @param other The capability set to check against
+ *
+ * @return 1 if set and other have no event code or property in common, or
+ * 0 otherwise
+ *
+ * @since 1.14
+ */
+int libevdev_capset_is_disjoint(const struct libevdev_capset *set,
+				const struct libevdev_capset *other);
+
+/**
+ * @ingroup capset
+ *
+ * @param set The capability set to check
+ * @param other The capability set to check against
+ *
+ * @return 1 if both sets contain exactly the same event codes and
+ * properties, or 0 otherwise
+ *
+ * @since 1.14
+ */
+int libevdev_capset_equal(const struct libevdev_capset *set,
+			  const struct libevdev_capset *other);
+
+/**
+ * @ingroup capset
+ *
+ * @param set The capability set
+ *
+ * @return The total number of event codes and properties in the set
+ *
+ * @since 1.14
+ */
+int libevdev_capset_count(const struct libevdev_capset *set);
+
+/**
+ * @ingroup capset
+ *
+ * Find the next event code of the given type in the set, starting at (and
+ * including) code. To iterate over all codes of a type:
+ *
+ * @code
+ * int code;
+ *
+ * for (code = libevdev_capset_next_event_code(set, EV_KEY, 0);
+ *      code != -1;
+ *      code = libevdev_capset_next_event_code(set, EV_KEY, code + 1))
+ *     printf("%s\n", libevdev_event_code_get_name(EV_KEY, code));
+ * @endcode
+ *
+ * @param set The capability set
+ * @param type The event type to iterate over (EV_KEY, EV_ABS, ...)
+ * @param code The first event code to consider
+ *
+ * @return The lowest event code greater than or equal to code that is in
+ * the set, or -1 if there is none or the type is invalid
+ *
+ * @since 1.14
+ */
+int libevdev_capset_next_event_code(const struct libevdev_capset *set,
+				    unsigned int type, unsigned int code);
+
 /**
  * @ingroup bits
  *
@@ -1440,7 +2047,8 @@ int libevdev_has_event_code(const struct libevdev *dev, unsigned int type, unsig
  *
  * @return axis minimum for the given axis or 0 if the axis is invalid
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  */
 int libevdev_get_abs_minimum(const struct libevdev *dev, unsigned int code);
 
@@ -1454,7 +2062,8 @@ int libevdev_get_abs_minimum(const struct libevdev *dev, unsigned int code);
  *
  * @return axis maximum for the given axis or 0 if the axis is invalid
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  */
 int libevdev_get_abs_maximum(const struct libevdev *dev, unsigned int code);
 
@@ -1468,7 +2077,8 @@ int libevdev_get_abs_maximum(const struct libevdev *dev, unsigned int code);
  *
  * @return axis fuzz for the given axis or 0 if the axis is invalid
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  */
 int libevdev_get_abs_fuzz(const struct libevdev *dev, unsigned int code);
 
@@ -1482,7 +2092,8 @@ int libevdev_get_abs_fuzz(const struct libevdev *dev, unsigned int code);
  *
  * @return axis flat for the given axis or 0 if the axis is invalid
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  */
 int libevdev_get_abs_flat(const struct libevdev *dev, unsigned int code);
 
@@ -1496,7 +2107,8 @@ int libevdev_get_abs_flat(const struct libevdev *dev, unsigned int code);
  *
  * @return axis resolution for the given axis or 0 if the axis is invalid
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  */
 int libevdev_get_abs_resolution(const struct libevdev *dev, unsigned int code);
 
@@ -1511,7 +2123,8 @@ int libevdev_get_abs_resolution(const struct libevdev *dev, unsigned int code);
  * @return The input_absinfo for the given code, or NULL if the device does
  * not support this event code.
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  */
 const struct input_absinfo* libevdev_get_abs_info(const struct libevdev *dev, unsigned int code);
 
@@ -1530,7 +2143,8 @@ const struct input_absinfo* libevdev_get_abs_info(const struct libevdev *dev, un
  *
  * @return The current value of the event.
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  * @note The value for ABS_MT_ events is undefined, use
  * libevdev_get_slot_value() instead
  *
@@ -1593,7 +2207,8 @@ int libevdev_set_event_value(struct libevdev *dev, unsigned int type, unsigned i
  * non-zero and value is set to the current value of this axis. Otherwise,
  * 0 is returned and value is unmodified.
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  * @note The value for ABS_MT_ events is undefined, use
  * libevdev_fetch_slot_value() instead
  *
@@ -1615,7 +2230,8 @@ int libevdev_fetch_event_value(const struct libevdev *dev, unsigned int type, un
  * of slots on this device
  * @param code The event code to query for, one of ABS_MT_POSITION_X, etc.
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  * @note The value for events other than ABS_MT_ is undefined, use
  * libevdev_fetch_value() instead
  *
@@ -1676,7 +2292,8 @@ int libevdev_set_slot_value(struct libevdev *dev, unsigned int slot, unsigned in
  * if the event code is not an ABS_MT_* event code, 0 is returned and value
  * is unmodified.
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  */
 int libevdev_fetch_slot_value(const struct libevdev *dev, unsigned int slot, unsigned int code, int *value);
 
@@ -1708,7 +2325,8 @@ int libevdev_get_num_slots(const struct libevdev *dev);
  *
  * @return the currently active slot (logically)
  *
- * @note This function is signal-safe.
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  */
 int libevdev_get_current_slot(const struct libevdev *dev);
 
@@ -1901,6 +2519,71 @@ int libevdev_enable_event_code(struct libevdev *dev, unsigned int type, unsigned
  */
 int libevdev_disable_event_code(struct libevdev *dev, unsigned int type, unsigned int code);
 
+/**
+ * @ingroup kernel
+ *
+ * Forcibly enable a set of event codes on this device, the bulk version of
+ * libevdev_enable_event_code(). Every code whose bit is set in the
+ * bitmap is enabled, all other codes are left as-is.
+ *
+ * The bitmap uses the same layout as the kernel's EVIOCGBIT ioctl: bit
+ * n is in bitmap[n / (sizeof(long) * 8)] at position
+ * n % (sizeof(long) * 8).
+ *
+ * Codes of type EV_ABS and EV_REP require per-code data and cannot be
+ * enabled in bulk, use libevdev_enable_event_code() for those.
+ *
+ * This function calls libevdev_enable_event_type() if necessary.
+ *
+ * This is a local modification only affecting only this representation of
+ * this device.
+ *
+ * @param dev The evdev device
+ * @param type The event type to enable (EV_KEY, EV_REL, ...)
+ * @param bitmap The codes to enable
+ * @param nbits The number of bits in the bitmap. Bits beyond nbits are
+ * ignored.
+ *
+ * @return 0 on success or -1 otherwise. If a bit is set that is not a
+ * valid code for this type, no codes are enabled and -1 is returned.
+ *
+ * @see libevdev_enable_event_code
+ * @see libevdev_disable_event_codes
+ * @since 1.14
+ */
+int libevdev_enable_event_codes(struct libevdev *dev, unsigned int type,
+				const unsigned long *bitmap, size_t nbits);
+
+/**
+ * @ingroup kernel
+ *
+ * Forcibly disable a set of event codes on this device, the bulk version
+ * of libevdev_disable_event_code(). Every code whose bit is set in the
+ * bitmap is disabled, all other codes are left as-is. See
+ * libevdev_enable_event_codes() for the bitmap layout.
+ *
+ * Disabling all event codes for a given type will not disable the event
+ * type. Use libevdev_disable_event_type() for that.
+ *
+ * This is a local modification only affecting only this representation of
+ * this device.
+ *
+ * @param dev The evdev device
+ * @param type The event type to disable (EV_ABS, EV_KEY, ...)
+ * @param bitmap The codes to disable
+ * @param nbits The number of bits in the bitmap. Bits beyond nbits are
+ * ignored.
+ *
+ * @return 0 on success or -1 otherwise. If a bit is set that is not a
+ * valid code for this type, no codes are disabled and -1 is returned.
+ *
+ * @see libevdev_disable_event_code
+ * @see libevdev_enable_event_codes
+ * @since 1.14
+ */
+int libevdev_disable_event_codes(struct libevdev *dev, unsigned int type,
+				 const unsigned long *bitmap, size_t nbits);
+
 /**
  * @ingroup kernel
  *
@@ -2093,6 +2776,40 @@ const char * libevdev_event_value_get_name(unsigned int type,
  */
 const char* libevdev_property_get_name(unsigned int prop);
 
+/**
+ * @ingroup misc
+ */
+enum libevdev_format_flag {
+	LIBEVDEV_FORMAT_FLAG_TIMESTAMP	= (1 << 0), /**< Prefix the event with its timestamp in seconds, e.g. "1234.000567" */
+	LIBEVDEV_FORMAT_FLAG_NUMERIC	= (1 << 1)  /**< Append the numeric value to each name, e.g. "EV_KEY(1)" */
+};
+
+/**
+ * @ingroup misc
+ *
+ * Format the event as a single line of text into the caller-provided
+ * buffer, e.g. "EV_KEY KEY_A 1". Types and codes without a name are printed
+ * as number. This function does not allocate memory and does not use the
+ * printf family, it is suitable for tracing every event.
+ *
+ * Like snprintf(), the output is truncated to the buffer size and always
+ * zero-terminated if len is greater than 0.
+ *
+ * @param buf The buffer to write to
+ * @param len The size of the buffer in bytes
+ * @param ev The event to format
+ * @param flags A bitmask of enum libevdev_format_flag
+ *
+ * @return The number of characters, excluding the terminating 0, that
+ * would have been written had the buffer been large enough, or -EINVAL
+ * for invalid flags
+ *
+ * @since 1.14
+ */
+int libevdev_event_format(char *buf, size_t len,
+			  const struct input_event *ev,
+			  unsigned int flags);
+
 /**
  * @ingroup misc
  *
@@ -2290,6 +3007,52 @@ libevdev_event_code_from_code_name(const char *name);
 int
 libevdev_event_code_from_code_name_n(const char *name, size_t len);
 
+/**
+ * @ingroup misc
+ *
+ * Look up the event type and code for each of the given names, e.g.
+ * "KEY_A" resolves to type EV_KEY and code KEY_A. This is equivalent to
+ * calling libevdev_event_type_from_code_name() and
+ * libevdev_event_code_from_code_name() for each name but resolves each
+ * name only once.
+ *
+ * @param names An array of count zero-terminated names
+ * @param count The number of names
+ * @param[out] types If not NULL, set to the event type of each name or -1
+ * if the name is not found. Must have space for count elements.
+ * @param[out] codes Set to the event code of each name or -1 if the name
+ * is not found. Must have space for count elements.
+ *
+ * @return The number of names found
+ *
+ * @since 1.14
+ */
+size_t
+libevdev_event_codes_from_code_names(const char * const *names, size_t count,
+				     int *types, int *codes);
+
+/**
+ * @ingroup misc
+ *
+ * Look up the name for each of the given type and code pairs. This is
+ * equivalent to calling libevdev_event_code_get_name() for each pair.
+ *
+ * @param types An array of count event types
+ * @param codes An array of count event codes
+ * @param count The number of pairs
+ * @param[out] names Set to the name of each code, or NULL for an invalid
+ * type or code. Must have space for count elements.
+ *
+ * @return The number of names found
+ *
+ * @since 1.14
+ */
+size_t
+libevdev_event_codes_get_names(const unsigned int *types,
+			       const unsigned int *codes,
+			       size_t count,
+			       const char **names);
+
 /**
  * @ingroup misc
  *
@@ -2359,7 +3122,8 @@ int libevdev_property_from_name_n(const char *name, size_t len);
  *
  * @return 0 on success, -1 if this device does not have repeat settings.
  *
- * @note This function is signal-safe
+ * @note This function is signal-safe, unless the device was initialized
+ * with LIBEVDEV_INIT_FLAG_LAZY and not yet fully fetched.
  *
  * @see libevdev_get_event_value
  */
@@ -12,6 +12,7 @@ import sys
 class Bits(object):
     def __init__(self):
         self.max_codes = {}
+        self.defines = {}
 
 
 prefixes = [
@@ -66,27 +67,97 @@ code_prefixes = [
 ]
 
 
-def print_bits(bits, prefix):
+class NameBlob(object):
+    # All names are stored once in a single string, the tables store
+    # 16-bit offsets into it so they need no relocations when libevdev is
+    # loaded. Offset 0 is the empty string and used for unnamed codes.
+    # Each name is preceded by a byte holding its length.
+    def __init__(self):
+        self.names = []
+        self.offsets = {}
+        self.size = 1
+
+    def add(self, name):
+        if name not in self.offsets:
+            assert len(name) < 0x100
+            self.offsets[name] = self.size + 1
+            self.names.append(name)
+            self.size += len(name) + 2
+            assert self.size <= 0x10000
+        return self.offsets[name]
+
+    def offset(self, name):
+        return self.offsets[name] if name is not None else 0
+
+
+def code_maps(bits):
+    maps = []
+    for prefix in prefixes:
+        if prefix in ["BTN_", "EV_", "INPUT_PROP_", "MT_TOOL_"]:
+            continue
+        attr = prefix[:-1].lower()
+        names = dict(getattr(bits, attr, {}))
+        if attr == "key":
+            names.update(getattr(bits, "btn", {}))
+        maps.append((prefix[:-1], names))
+    return maps
+
+
+def print_blob(blob):
+    print("static const char names_blob[] =")
+    print("    \"\\0\"")
+    for name in blob.names:
+        print("    \"\\%03o%s\\0\"" % (len(name), name))
+    print(";")
+    print("")
+    print("static inline const char *")
+    print("name_from_offset(unsigned short offset)")
+    print("{")
+    print("    return offset ? &names_blob[offset] : NULL;")
+    print("}")
+    print("")
+    print("static inline size_t")
+    print("name_length(unsigned short offset)")
+    print("{")
+    print("    return offset ? (unsigned char)names_blob[offset - 1] : 0;")
+    print("}")
+    print("")
+
+
+def print_bits(bits, blob, prefix):
     if not hasattr(bits, prefix):
         return
-    print("static const char * const %s_map[%s_MAX + 1] = {" % (prefix, prefix.upper()))
+    print("static const unsigned short %s_map[%s_MAX + 1] = {" % (prefix, prefix.upper()))
     for val, name in sorted(list(getattr(bits, prefix).items())):
-        print("    [%s] = \"%s\"," % (name, name))
-    if prefix == "key":
-        for val, name in sorted(list(getattr(bits, "btn").items())):
-            print("    [%s] = \"%s\"," % (name, name))
+        print("    [%s] = %d," % (name, blob.offset(name)))
     print("};")
     print("")
 
 
-def print_map(bits):
-    print("static const char * const * const event_type_map[EV_MAX + 1] = {")
-
-    for prefix in prefixes:
-        if prefix in ["BTN_", "EV_", "INPUT_PROP_", "MT_TOOL_"]:
-            continue
-        print("    [EV_%s] = %s_map," % (prefix[:-1], prefix[:-1].lower()))
+def print_map(bits, blob):
+    # The code names of all types in one array, event_type_map has the
+    # index of each type's first code
+    index = 0
+    starts = []
+    print("static const unsigned short code_map[] = {")
+    for evtype, names in code_maps(bits):
+        count = bits.max_codes["%s_MAX" % evtype] + 1
+        starts.append((evtype, index))
+        print("    /* EV_%s */" % evtype)
+        for code in range(count):
+            name = names.get(code)
+            if name is None:
+                print("    0,")
+            else:
+                print("    %d, /* \"%s\" */" % (blob.offset(name), name))
+        index += count
+    assert index <= 0x10000
+    print("};")
+    print("")
 
+    print("static const unsigned short event_type_map[EV_MAX + 1] = {")
+    for evtype, start in starts:
+        print("    [EV_%s] = %d," % (evtype, start))
     print("};")
     print("")
 
@@ -114,9 +185,9 @@ def print_map(bits):
     print("")
 
 
-def print_lookup(bits, prefix):
+def lookup_names(bits, prefix):
     if not hasattr(bits, prefix):
-        return
+        return []
 
     names = sorted(list(getattr(bits, prefix).items()))
     if prefix == "btn":
@@ -128,35 +199,349 @@ def print_lookup(bits, prefix):
     if maxname in duplicates:
         names.append((bits.max_codes[maxname], maxname))
 
-    for val, name in sorted(names, key=lambda e: e[1]):
-        print("    { .name = \"%s\", .value = %s }," % (name, name))
+    return [name for val, name in sorted(names, key=lambda e: e[1])]
+
+
+def name_hash(seed, name):
+    # 32-bit FNV-1a with the seed folded into the offset basis, this must
+    # match name_hash() in libevdev-names.c
+    h = (0x811c9dc5 ^ seed) & 0xffffffff
+    for c in name.encode("ascii"):
+        h ^= c
+        h = (h * 0x01000193) & 0xffffffff
+    # the low bits of FNV are weak, finish with the murmur3 mixer so
+    # small table sizes still separate all names
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & 0xffffffff
+    h ^= h >> 13
+    h = (h * 0xc2b2ae35) & 0xffffffff
+    h ^= h >> 16
+    return h
+
+
+def perfect_hash(names):
+    # Hash and displace: the seed-0 hash picks a bucket, each bucket
+    # stores the seed that maps all its names onto free slots. Buckets
+    # with a single name store the slot directly as -(slot + 1).
+    n = len(names)
+    assert len(set(names)) == n
+
+    buckets = [[] for _ in range(n)]
+    for idx, name in enumerate(names):
+        buckets[name_hash(0, name) % n].append(idx)
+
+    g = [0] * n
+    index = [None] * n
+    order = sorted(range(n), key=lambda b: len(buckets[b]), reverse=True)
+
+    for b in order:
+        if len(buckets[b]) <= 1:
+            break
+        seed = 1
+        while True:
+            slots = [name_hash(seed, names[idx]) % n for idx in buckets[b]]
+            if len(set(slots)) == len(slots) and all(index[s] is None for s in slots):
+                break
+            seed += 1
+        assert seed < 0x8000
+        g[b] = seed
+        for idx, slot in zip(buckets[b], slots):
+            index[slot] = idx
+
+    free = [s for s in range(n) if index[s] is None]
+    for b in order:
+        if len(buckets[b]) != 1:
+            continue
+        slot = free.pop()
+        g[b] = -slot - 1
+        index[slot] = buckets[b][0]
+
+    return g, index
+
+
+def print_array(ctype, name, values):
+    print("static const %s %s[] = {" % (ctype, name))
+    for i in range(0, len(values), 12):
+        print("    %s," % ", ".join(str(v) for v in values[i:i + 12]))
+    print("};")
+    print("")
+
 
+def print_lookup(blob, table, names):
+    print("static const struct name_entry %s[] = {" % table)
+    for name in names:
+        print("    { .name = %d, .len = %d, .value = %s }," % (blob.offset(name), len(name), name))
+    print("};")
+    print("")
+
+    g, index = perfect_hash(names)
+    print_array("short", "%s_hash_g" % table, g)
+    print_array("unsigned short", "%s_hash_index" % table, index)
 
-def print_lookup_table(bits):
+
+def lookup_tables(bits):
+    names = []
+    for prefix in sorted(code_prefixes, key=lambda e: e):
+        names += lookup_names(bits, prefix[:-1].lower())
+
+    return [
+        ("tool_type_names", lookup_names(bits, "mt_tool")),
+        ("ev_names", lookup_names(bits, "ev")),
+        ("code_names", names),
+        ("prop_names", lookup_names(bits, "input_prop")),
+    ]
+
+
+def print_lookup_table(bits, blob):
     print("struct name_entry {")
-    print("    const char *name;")
+    print("    unsigned short name; /* offset into names_blob */")
+    print("    unsigned short len;")
     print("    unsigned int value;")
     print("};")
     print("")
-    print("static const struct name_entry tool_type_names[] = {")
-    print_lookup(bits, "mt_tool")
+    for table, names in lookup_tables(bits):
+        print_lookup(blob, table, names)
+
+
+def type_prefixes(bits):
+    prefixes = [("BTN_", "EV_KEY")]
+    for val, name in sorted(bits.ev.items()):
+        if name == "EV_MAX":
+            continue
+        prefixes.append((name[3:] + "_", name))
+    return prefixes
+
+
+def type_from_prefix(bits, name):
+    for prefix, evtype in sorted(type_prefixes(bits), key=lambda e: len(e[0]), reverse=True):
+        if name.startswith(prefix):
+            return evtype
+    return None
+
+
+def print_prefix_matcher(bits):
+    # Maps the prefix of a code name to its event type, e.g. KEY_ and
+    # BTN_ to EV_KEY. Prefixes are grouped by their first character and
+    # the longest prefix is tested first so FF_STATUS_ wins over FF_.
+    # MAX_ is not a valid prefix even though EV_MAX exists.
+    groups = {}
+    for prefix, evtype in type_prefixes(bits):
+        groups.setdefault(prefix[0], []).append((prefix, evtype))
+
+    print("static inline int")
+    print("event_type_from_prefix(const char *name, size_t len)")
+    print("{")
+    print("    if (len == 0)")
+    print("        return -1;")
+    print("")
+    print("    switch (name[0]) {")
+    for c in sorted(groups):
+        print("    case '%s':" % c)
+        for prefix, evtype in sorted(groups[c], key=lambda e: len(e[0]), reverse=True):
+            print("        if (len >= %d && memcmp(name, \"%s\", %d) == 0)" % (len(prefix), prefix, len(prefix)))
+            print("            return %s;" % evtype)
+        print("        break;")
+    print("    }")
+    print("")
+    print("    return -1;")
+    print("}")
+    print("")
+
+
+def define_value(bits, name):
+    # Resolves aliases like BTN_A, defined as BTN_SOUTH
+    value = bits.defines[name]
+    try:
+        return int(value, 0)
+    except ValueError:
+        return define_value(bits, value)
+
+
+def print_cxx_entries(bits, table, entries):
+    # The values are numeric so the installed header does not depend on
+    # the kernel headers of whoever includes it
+    print("inline constexpr name_entry %s[] = {" % table)
+    for name, evtype in sorted(entries):
+        evtype = define_value(bits, evtype) if evtype is not None else -1
+        print("    { \"%s\", %d, %d }," % (name, evtype, define_value(bits, name)))
+    print("};")
+    print("")
+
+
+def print_cxx_header(bits):
+    print("/* THIS FILE IS GENERATED, DO NOT EDIT */")
+    print("")
+    print("#ifndef LIBEVDEV_EVENT_NAMES_HPP")
+    print("#define LIBEVDEV_EVENT_NAMES_HPP")
+    print("")
+    print("#if __cplusplus < 201703L")
+    print("#error \"event-names.hpp requires C++17\"")
+    print("#endif")
+    print("")
+    print("#include <cstddef>")
+    print("#include <string_view>")
+    print("")
+    print("namespace evdev {")
+    print("")
+    print("struct name_entry {")
+    print("    std::string_view name;")
+    print("    int type; /* the event type for code names, otherwise -1 */")
+    print("    int value;")
     print("};")
     print("")
-    print("static const struct name_entry ev_names[] = {")
-    print_lookup(bits, "ev")
+    print("namespace detail {")
+    print("")
+
+    print("inline constexpr unsigned int ev_max = %d;" % bits.max_codes["EV_MAX"])
+    print("inline constexpr unsigned int input_prop_max = %d;" % bits.max_codes["INPUT_PROP_MAX"])
+    print("")
+
+    tables = dict(lookup_tables(bits))
+    print_cxx_entries(bits, "type_names", [(n, None) for n in tables["ev_names"]])
+    print_cxx_entries(bits, "code_names", [(n, type_from_prefix(bits, n)) for n in tables["code_names"]])
+    print_cxx_entries(bits, "prop_names", [(n, None) for n in tables["prop_names"]])
+    print_cxx_entries(bits, "tool_type_names", [(n, None) for n in tables["tool_type_names"]])
+
+    print("inline constexpr std::string_view type_map[ev_max + 1] = {")
+    for val in range(bits.max_codes["EV_MAX"] + 1):
+        name = bits.ev.get(val)
+        print("    \"%s\"," % name if name else "    {},")
     print("};")
     print("")
 
-    print("static const struct name_entry code_names[] = {")
-    for prefix in sorted(code_prefixes, key=lambda e: e):
-        print_lookup(bits, prefix[:-1].lower())
+    print("inline constexpr std::string_view prop_map[input_prop_max + 1] = {")
+    for val in range(bits.max_codes["INPUT_PROP_MAX"] + 1):
+        name = bits.input_prop.get(val)
+        print("    \"%s\"," % name if name else "    {},")
     print("};")
     print("")
-    print("static const struct name_entry prop_names[] = {")
-    print_lookup(bits, "input_prop")
+
+    # All code names in one array, type_start has the index of each
+    # type's first code, type_max the highest code
+    index = 0
+    starts = {}
+    print("inline constexpr std::string_view code_map[] = {")
+    for evtype, names in code_maps(bits):
+        count = bits.max_codes["%s_MAX" % evtype] + 1
+        starts["EV_" + evtype] = (index, count - 1)
+        print("    /* EV_%s */" % evtype)
+        for code in range(count):
+            name = names.get(code)
+            print("    \"%s\"," % name if name else "    {},")
+        index += count
     print("};")
     print("")
 
+    for array, field in [("type_start", 0), ("type_max", 1)]:
+        print("inline constexpr int %s[ev_max + 1] = {" % array)
+        for val in range(bits.max_codes["EV_MAX"] + 1):
+            name = bits.ev.get(val)
+            print("    %s," % (starts[name][field] if name in starts else -1))
+        print("};")
+        print("")
+
+    print("""template<std::size_t N>
+constexpr const name_entry *
+lookup(const name_entry (&table)[N], std::string_view name)
+{
+    std::size_t lo = 0, hi = N;
+
+    while (lo < hi) {
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (table[mid].name < name)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo < N && table[lo].name == name ? &table[lo] : nullptr;
+}
+
+template<std::size_t N>
+constexpr int
+value_from_name(const name_entry (&table)[N], std::string_view name)
+{
+    const name_entry *entry = lookup(table, name);
+    return entry ? entry->value : -1;
+}
+
+} /* namespace detail */
+
+/* The functions below mirror libevdev_event_type_from_name(),
+ * libevdev_event_code_from_name(), etc. and return -1 or an empty
+ * string_view where the C functions return -1 or NULL. */
+
+constexpr int
+type_from_name(std::string_view name)
+{
+    return detail::value_from_name(detail::type_names, name);
+}
+
+constexpr int
+code_from_name(std::string_view name)
+{
+    return detail::value_from_name(detail::code_names, name);
+}
+
+constexpr int
+code_from_name(unsigned int type, std::string_view name)
+{
+    const name_entry *entry = detail::lookup(detail::code_names, name);
+    return entry && entry->type == static_cast<int>(type) ? entry->value : -1;
+}
+
+constexpr int
+type_from_code_name(std::string_view name)
+{
+    const name_entry *entry = detail::lookup(detail::code_names, name);
+    return entry ? entry->type : -1;
+}
+
+constexpr int
+property_from_name(std::string_view name)
+{
+    return detail::value_from_name(detail::prop_names, name);
+}
+
+constexpr int
+tool_type_from_name(std::string_view name)
+{
+    return detail::value_from_name(detail::tool_type_names, name);
+}
+
+constexpr int
+type_get_max(unsigned int type)
+{
+    return type <= detail::ev_max ? detail::type_max[type] : -1;
+}
+
+constexpr std::string_view
+type_get_name(unsigned int type)
+{
+    return type <= detail::ev_max ? detail::type_map[type] : std::string_view{};
+}
+
+constexpr std::string_view
+code_get_name(unsigned int type, unsigned int code)
+{
+    int max = type_get_max(type);
+
+    if (max == -1 || code > static_cast<unsigned int>(max))
+        return {};
+
+    return detail::code_map[detail::type_start[type] + code];
+}
+
+constexpr std::string_view
+property_get_name(unsigned int prop)
+{
+    return prop <= detail::input_prop_max ? detail::prop_map[prop] : std::string_view{};
+}
+
+} /* namespace evdev */
+
+#endif /* LIBEVDEV_EVENT_NAMES_HPP */""")
+
 
 def print_mapping_table(bits):
     print("/* THIS FILE IS GENERATED, DO NOT EDIT */")
@@ -165,13 +550,23 @@ def print_mapping_table(bits):
     print("#define EVENT_NAMES_H")
     print("")
 
-    for prefix in prefixes:
-        if prefix == "BTN_":
-            continue
-        print_bits(bits, prefix[:-1].lower())
-
-    print_map(bits)
-    print_lookup_table(bits)
+    blob = NameBlob()
+    for prefix in ["ev", "input_prop", "mt_tool"]:
+        for val, name in sorted(getattr(bits, prefix, {}).items()):
+            blob.add(name)
+    for evtype, names in code_maps(bits):
+        for code, name in sorted(names.items()):
+            blob.add(name)
+    for table, names in lookup_tables(bits):
+        for name in names:
+            blob.add(name)
+
+    print_blob(blob)
+    for prefix in ["ev", "input_prop", "mt_tool"]:
+        print_bits(bits, blob, prefix)
+    print_map(bits, blob)
+    print_lookup_table(bits, blob)
+    print_prefix_matcher(bits)
 
     print("#endif /* EVENT_NAMES_H */")
 
@@ -182,6 +577,7 @@ def parse_define(bits, line):
         return
 
     name = m.group(1)
+    bits.defines[name] = m.group(2)
 
     try:
         value = int(m.group(2), 0)
@@ -217,15 +613,23 @@ def parse(lines):
 
 
 def usage(prog):
-    print("Usage: %s <files>".format(prog))
+    print("Usage: {} [--cxx] <files>".format(prog))
 
 
 if __name__ == "__main__":
-    if len(sys.argv) <= 1:
+    args = sys.argv[1:]
+    cxx = len(args) > 0 and args[0] == "--cxx"
+    if cxx:
+        args = args[1:]
+
+    if len(args) < 1:
         usage(sys.argv[0])
         sys.exit(2)
 
     from itertools import chain
-    lines = chain(*[open(f).readlines() for f in sys.argv[1:]])
+    lines = chain(*[open(f).readlines() for f in args])
     bits = parse(lines)
-    print_mapping_table(bits)
+    if cxx:
+        print_cxx_header(bits)
+    else:
+        print_mapping_table(bits)
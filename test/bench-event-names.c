@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+/* Compares the perfect hash lookup of libevdev_event_code_from_code_name()
+ * against a bsearch over the same table, the way the lookup was done
+ * before, and the batch lookups against one call per name.
+ *
+ * Usage: bench-event-names [rounds]
+ */
+
+#include "config.h"
+#include <linux/input.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <libevdev/libevdev.h>
+
+#include "event-names.h"
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+
+struct name_lookup {
+	const char *name;
+	size_t len;
+};
+
+static int cmp_entry(const void *vlookup, const void *ventry)
+{
+	const struct name_lookup *lookup = vlookup;
+	const struct name_entry *entry = ventry;
+	int r;
+
+	r = strncmp(lookup->name, &names_blob[entry->name], lookup->len);
+	if (!r && entry->len != lookup->len)
+		r = -1;
+
+	return r;
+}
+
+static int
+bsearch_code_from_name(const char *name, size_t len)
+{
+	struct name_lookup lookup = { .name = name, .len = len };
+	const struct name_entry *entry;
+
+	entry = bsearch(&lookup, code_names, ARRAY_LENGTH(code_names),
+			sizeof(*code_names), cmp_entry);
+
+	return entry ? (int)entry->value : -1;
+}
+
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int
+main(int argc, char **argv)
+{
+	const char *names[ARRAY_LENGTH(code_names)];
+	size_t lens[ARRAY_LENGTH(code_names)];
+	int types[ARRAY_LENGTH(code_names)];
+	int codes[ARRAY_LENGTH(code_names)];
+	unsigned int utypes[ARRAY_LENGTH(code_names)];
+	unsigned int ucodes[ARRAY_LENGTH(code_names)];
+	const char *out[ARRAY_LENGTH(code_names)];
+	unsigned int rounds = 2000;
+	unsigned int r;
+	size_t i;
+	long sum_bsearch = 0, sum_hash = 0;
+	double start, t_bsearch, t_hash;
+	double t_single, t_batch, t_names, t_names_batch;
+	double nlookups;
+
+	if (argc > 1)
+		rounds = strtoul(argv[1], NULL, 10);
+	if (rounds == 0)
+		rounds = 1;
+
+	for (i = 0; i < ARRAY_LENGTH(code_names); i++) {
+		names[i] = name_from_offset(code_names[i].name);
+		lens[i] = code_names[i].len;
+		if (bsearch_code_from_name(names[i], lens[i]) !=
+		    libevdev_event_code_from_code_name_n(names[i], lens[i])) {
+			fprintf(stderr, "Mismatch for %s\n", names[i]);
+			return 1;
+		}
+	}
+
+	start = now();
+	for (r = 0; r < rounds; r++) {
+		for (i = 0; i < ARRAY_LENGTH(code_names); i++)
+			sum_bsearch += bsearch_code_from_name(names[i], lens[i]);
+	}
+	t_bsearch = now() - start;
+
+	start = now();
+	for (r = 0; r < rounds; r++) {
+		for (i = 0; i < ARRAY_LENGTH(code_names); i++)
+			sum_hash += libevdev_event_code_from_code_name_n(names[i], lens[i]);
+	}
+	t_hash = now() - start;
+
+	if (sum_bsearch != sum_hash) {
+		fprintf(stderr, "Lookup results differ\n");
+		return 1;
+	}
+
+	/* type and code for each name */
+	start = now();
+	for (r = 0; r < rounds; r++) {
+		for (i = 0; i < ARRAY_LENGTH(code_names); i++) {
+			types[i] = libevdev_event_type_from_code_name(names[i]);
+			codes[i] = libevdev_event_code_from_code_name(names[i]);
+		}
+	}
+	t_single = now() - start;
+
+	start = now();
+	for (r = 0; r < rounds; r++)
+		libevdev_event_codes_from_code_names(names, ARRAY_LENGTH(code_names),
+						     types, codes);
+	t_batch = now() - start;
+
+	for (i = 0; i < ARRAY_LENGTH(code_names); i++) {
+		utypes[i] = types[i];
+		ucodes[i] = codes[i];
+	}
+
+	/* and back to the names */
+	start = now();
+	for (r = 0; r < rounds; r++) {
+		for (i = 0; i < ARRAY_LENGTH(code_names); i++)
+			out[i] = libevdev_event_code_get_name(utypes[i], ucodes[i]);
+	}
+	t_names = now() - start;
+
+	start = now();
+	for (r = 0; r < rounds; r++)
+		libevdev_event_codes_get_names(utypes, ucodes,
+					       ARRAY_LENGTH(code_names), out);
+	t_names_batch = now() - start;
+
+	nlookups = (double)rounds * ARRAY_LENGTH(code_names);
+	printf("%zu names, %u rounds\n", ARRAY_LENGTH(code_names), rounds);
+	printf("bsearch:      %8.1f ns/lookup\n", t_bsearch / nlookups);
+	printf("perfect hash: %8.1f ns/lookup\n", t_hash / nlookups);
+	printf("type+code, one call each: %8.1f ns/name\n", t_single / nlookups);
+	printf("type+code, batch:         %8.1f ns/name\n", t_batch / nlookups);
+	printf("name, one call each:      %8.1f ns/code\n", t_names / nlookups);
+	printf("name, batch:              %8.1f ns/code\n", t_names_batch / nlookups);
+
+	return 0;
+}
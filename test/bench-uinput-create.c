@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+/* Measures how many uinput devices can be created and destroyed per
+ * second, for a keyboard and for a touchpad with axis resolutions, both
+ * from a single process and from several processes at once. Needs write
+ * access to /dev/uinput.
+ *
+ * Usage: bench-uinput-create [devices] [processes]
+ */
+
+#include "config.h"
+#include <errno.h>
+#include <linux/input.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <libevdev/libevdev.h>
+#include <libevdev/libevdev-uinput.h>
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static struct libevdev *
+keyboard(void)
+{
+	struct libevdev *dev = libevdev_new();
+	unsigned int code;
+
+	libevdev_set_name(dev, "libevdev uinput create benchmark keyboard");
+	for (code = KEY_ESC; code <= KEY_MICMUTE; code++)
+		libevdev_enable_event_code(dev, EV_KEY, code, NULL);
+	libevdev_enable_event_code(dev, EV_LED, LED_NUML, NULL);
+	libevdev_enable_event_code(dev, EV_LED, LED_CAPSL, NULL);
+	libevdev_enable_event_code(dev, EV_LED, LED_SCROLLL, NULL);
+	libevdev_enable_event_code(dev, EV_MSC, MSC_SCAN, NULL);
+
+	return dev;
+}
+
+static struct libevdev *
+touchpad(void)
+{
+	struct libevdev *dev = libevdev_new();
+	struct input_absinfo abs = { .maximum = 1000, .resolution = 10 };
+	struct input_absinfo slots = { .maximum = 4 };
+	unsigned int codes[] = { ABS_X, ABS_Y, ABS_PRESSURE,
+				 ABS_MT_TRACKING_ID, ABS_MT_POSITION_X,
+				 ABS_MT_POSITION_Y, ABS_MT_PRESSURE };
+	unsigned int i;
+
+	libevdev_set_name(dev, "libevdev uinput create benchmark touchpad");
+	libevdev_enable_event_code(dev, EV_KEY, BTN_LEFT, NULL);
+	libevdev_enable_event_code(dev, EV_KEY, BTN_TOOL_FINGER, NULL);
+	libevdev_enable_event_code(dev, EV_KEY, BTN_TOUCH, NULL);
+	libevdev_enable_event_code(dev, EV_ABS, ABS_MT_SLOT, &slots);
+	for (i = 0; i < ARRAY_LENGTH(codes); i++)
+		libevdev_enable_event_code(dev, EV_ABS, codes[i], &abs);
+	libevdev_enable_property(dev, INPUT_PROP_POINTER);
+	libevdev_enable_property(dev, INPUT_PROP_BUTTONPAD);
+
+	return dev;
+}
+
+static int
+create_devices(const struct libevdev *dev, unsigned int count)
+{
+	unsigned int i;
+
+	for (i = 0; i < count; i++) {
+		struct libevdev_uinput *uidev;
+		int rc;
+
+		rc = libevdev_uinput_create_from_device(dev,
+							LIBEVDEV_UINPUT_OPEN_MANAGED,
+							&uidev);
+		if (rc < 0)
+			return rc;
+		libevdev_uinput_destroy(uidev);
+	}
+
+	return 0;
+}
+
+/* count devices split across nprocs processes, returns the elapsed
+ * time in ns or a negative errno */
+static double
+create_devices_concurrently(const struct libevdev *dev, unsigned int count,
+			    unsigned int nprocs)
+{
+	double start = now();
+	unsigned int i;
+	int rc = 0;
+
+	for (i = 0; i < nprocs; i++) {
+		pid_t pid = fork();
+
+		if (pid == -1)
+			return -errno;
+		if (pid == 0)
+			_exit(create_devices(dev, count / nprocs) == 0 ? 0 : 1);
+	}
+
+	for (i = 0; i < nprocs; i++) {
+		int status;
+
+		if (wait(&status) == -1 || !WIFEXITED(status) ||
+		    WEXITSTATUS(status) != 0)
+			rc = -EIO;
+	}
+
+	return rc < 0 ? rc : now() - start;
+}
+
+int
+main(int argc, char **argv)
+{
+	struct libevdev *devices[2];
+	const char *names[] = { "keyboard", "touchpad" };
+	unsigned int count = 200;
+	unsigned int nprocs = 4;
+	unsigned int i;
+	int rc = 0;
+
+	if (argc > 1)
+		count = strtoul(argv[1], NULL, 10);
+	if (argc > 2)
+		nprocs = strtoul(argv[2], NULL, 10);
+	if (nprocs == 0)
+		nprocs = 1;
+	if (count < nprocs)
+		count = nprocs;
+	count -= count % nprocs;
+
+	devices[0] = keyboard();
+	devices[1] = touchpad();
+
+	printf("%u devices, %u processes\n", count, nprocs);
+
+	for (i = 0; i < ARRAY_LENGTH(devices); i++) {
+		double start, t_serial, t_concurrent;
+
+		start = now();
+		rc = create_devices(devices[i], count);
+		t_serial = now() - start;
+		if (rc < 0) {
+			fprintf(stderr, "Failed to create uinput device: %s\n", strerror(-rc));
+			rc = 77;
+			break;
+		}
+
+		t_concurrent = create_devices_concurrently(devices[i], count, nprocs);
+		if (t_concurrent < 0) {
+			fprintf(stderr, "Failed to create uinput devices concurrently\n");
+			rc = 1;
+			break;
+		}
+
+		printf("%-8s serial:     %8.1f us/device, %8.0f devices/s\n",
+		       names[i], t_serial / count / 1000, count / (t_serial / 1e9));
+		printf("%-8s concurrent: %8.1f us/device, %8.0f devices/s\n",
+		       names[i], t_concurrent / count / 1000, count / (t_concurrent / 1e9));
+	}
+
+	libevdev_free(devices[0]);
+	libevdev_free(devices[1]);
+
+	return rc;
+}
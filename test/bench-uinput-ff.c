@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+/* Measures the EVIOCSFF round trip to a uinput device serviced with
+ * libevdev_uinput_dispatch(), once with the servicing process idle in
+ * poll() and once while it posts input frames as fast as it can. Needs
+ * write access to /dev/uinput and read/write access to the new device
+ * node.
+ *
+ * Usage: bench-uinput-ff [uploads]
+ */
+
+#include "config.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/input.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <libevdev/libevdev.h>
+#include <libevdev/libevdev-uinput.h>
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int
+cmp_double(const void *a, const void *b)
+{
+	double da = *(const double *)a, db = *(const double *)b;
+
+	return da < db ? -1 : da > db;
+}
+
+/* the game: upload effects and print the latencies */
+static int
+client(const char *devnode, unsigned int uploads, const char *label)
+{
+	struct ff_effect effect = {
+		.type = FF_RUMBLE,
+		.id = -1,
+		.u.rumble = { .strong_magnitude = 0x4000 },
+	};
+	double *t = calloc(uploads, sizeof(*t));
+	double sum = 0;
+	unsigned int i;
+	int fd;
+
+	fd = open(devnode, O_RDWR);
+	if (fd < 0 || !t)
+		return 1;
+
+	for (i = 0; i < uploads; i++) {
+		double start = now();
+
+		/* updates the same effect after the first upload */
+		if (ioctl(fd, EVIOCSFF, &effect) != 0)
+			return 1;
+		t[i] = now() - start;
+		sum += t[i];
+	}
+
+	qsort(t, uploads, sizeof(*t), cmp_double);
+	printf("%-6s mean %8.1f us, p50 %8.1f us, p99 %8.1f us, max %8.1f us\n",
+	       label, sum / uploads / 1000, t[uploads / 2] / 1000,
+	       t[uploads * 99 / 100] / 1000, t[uploads - 1] / 1000);
+
+	close(fd);
+	free(t);
+
+	return 0;
+}
+
+static int
+run(struct libevdev_uinput *uidev, unsigned int uploads, bool load)
+{
+	struct input_event frame[] = {
+		{ .type = EV_ABS, .code = ABS_X, .value = 0 },
+		{ .type = EV_ABS, .code = ABS_Y, .value = 0 },
+		{ .type = EV_KEY, .code = BTN_SOUTH, .value = 0 },
+		{ .type = EV_SYN, .code = SYN_REPORT, .value = 0 },
+	};
+	struct pollfd fds = { .fd = libevdev_uinput_get_fd(uidev), .events = POLLIN };
+	unsigned int frames = 0;
+	int status;
+	pid_t pid;
+
+	fflush(stdout);
+	pid = fork();
+	if (pid == -1)
+		return -errno;
+	if (pid == 0)
+		_exit(client(libevdev_uinput_get_devnode(uidev), uploads,
+			     load ? "load" : "idle"));
+
+	while (waitpid(pid, &status, WNOHANG) == 0) {
+		if (load) {
+			frames++;
+			frame[0].value = frames % 1000;
+			frame[1].value = frames % 500;
+			frame[2].value = frames % 2;
+			libevdev_uinput_write_events(uidev, frame, ARRAY_LENGTH(frame));
+		} else if (poll(&fds, 1, 10) <= 0) {
+			continue;
+		}
+
+		libevdev_uinput_dispatch(uidev, NULL, 0);
+	}
+
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		return -EIO;
+
+	return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+	struct libevdev *dev;
+	struct libevdev_uinput *uidev;
+	struct input_absinfo abs = { .maximum = 1000 };
+	unsigned int uploads = 10000;
+	int rc;
+
+	if (argc > 1)
+		uploads = strtoul(argv[1], NULL, 10);
+	if (uploads == 0)
+		uploads = 1;
+
+	dev = libevdev_new();
+	libevdev_set_name(dev, "libevdev uinput ff benchmark");
+	libevdev_enable_event_code(dev, EV_KEY, BTN_SOUTH, NULL);
+	libevdev_enable_event_code(dev, EV_ABS, ABS_X, &abs);
+	libevdev_enable_event_code(dev, EV_ABS, ABS_Y, &abs);
+	libevdev_enable_event_code(dev, EV_FF, FF_RUMBLE, NULL);
+
+	rc = libevdev_uinput_create_from_device(dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &uidev);
+	if (rc < 0) {
+		fprintf(stderr, "Failed to create uinput device: %s\n", strerror(-rc));
+		libevdev_free(dev);
+		return 77;
+	}
+
+	rc = libevdev_uinput_wait_devnode(uidev, 5000);
+	if (rc == 0)
+		rc = run(uidev, uploads, false);
+	if (rc == 0)
+		rc = run(uidev, uploads, true);
+	if (rc < 0)
+		fprintf(stderr, "Benchmark failed: %s\n", strerror(-rc));
+
+	libevdev_uinput_destroy(uidev);
+	libevdev_free(dev);
+
+	return rc < 0 ? 1 : 0;
+}
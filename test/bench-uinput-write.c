@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+/* Compares posting touch frames through libevdev_uinput_write_event(),
+ * one write() per event, against libevdev_uinput_write_events(), one
+ * write() per frame. Needs write access to /dev/uinput.
+ *
+ * Usage: bench-uinput-write [frames]
+ */
+
+#include "config.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/input.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <libevdev/libevdev.h>
+#include <libevdev/libevdev-uinput.h>
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void
+fill_frame(struct input_event *frame, unsigned int i)
+{
+	struct input_event f[] = {
+		{ .type = EV_ABS, .code = ABS_MT_SLOT, .value = 0 },
+		{ .type = EV_ABS, .code = ABS_MT_TRACKING_ID, .value = 1 },
+		{ .type = EV_ABS, .code = ABS_MT_POSITION_X, .value = i % 1000 },
+		{ .type = EV_ABS, .code = ABS_MT_POSITION_Y, .value = i % 500 },
+		{ .type = EV_ABS, .code = ABS_MT_PRESSURE, .value = i % 100 },
+		{ .type = EV_ABS, .code = ABS_X, .value = i % 1000 },
+		{ .type = EV_ABS, .code = ABS_Y, .value = i % 500 },
+		{ .type = EV_KEY, .code = BTN_TOUCH, .value = 1 },
+		{ .type = EV_SYN, .code = SYN_REPORT, .value = 0 },
+	};
+
+	memcpy(frame, f, sizeof(f));
+}
+
+#define FRAME_SIZE 9
+
+int
+main(int argc, char **argv)
+{
+	struct libevdev *dev;
+	struct libevdev_uinput *uidev;
+	struct input_absinfo abs = { .maximum = 1000 };
+	struct input_event frame[FRAME_SIZE];
+	unsigned int codes[] = { ABS_X, ABS_Y, ABS_MT_SLOT, ABS_MT_TRACKING_ID,
+				 ABS_MT_POSITION_X, ABS_MT_POSITION_Y,
+				 ABS_MT_PRESSURE };
+	unsigned int frames = 20000;
+	unsigned int i, j;
+	double start, t_single, t_batch;
+	int rc;
+
+	if (argc > 1)
+		frames = strtoul(argv[1], NULL, 10);
+	if (frames == 0)
+		frames = 1;
+
+	dev = libevdev_new();
+	libevdev_set_name(dev, "libevdev uinput write benchmark");
+	libevdev_enable_event_code(dev, EV_KEY, BTN_TOUCH, NULL);
+	for (i = 0; i < ARRAY_LENGTH(codes); i++)
+		libevdev_enable_event_code(dev, EV_ABS, codes[i], &abs);
+
+	rc = libevdev_uinput_create_from_device(dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &uidev);
+	if (rc < 0) {
+		fprintf(stderr, "Failed to create uinput device: %s\n", strerror(-rc));
+		libevdev_free(dev);
+		return 77;
+	}
+
+	start = now();
+	for (i = 0; i < frames; i++) {
+		fill_frame(frame, i);
+		for (j = 0; j < FRAME_SIZE; j++)
+			libevdev_uinput_write_event(uidev, frame[j].type,
+						    frame[j].code, frame[j].value);
+	}
+	t_single = now() - start;
+
+	start = now();
+	for (i = 0; i < frames; i++) {
+		fill_frame(frame, i);
+		libevdev_uinput_write_events(uidev, frame, FRAME_SIZE);
+	}
+	t_batch = now() - start;
+
+	printf("%u frames of %d events\n", frames, FRAME_SIZE);
+	printf("write_event:  %8.1f us/frame, %8.0f frames/s\n",
+	       t_single / frames / 1000, frames / (t_single / 1e9));
+	printf("write_events: %8.1f us/frame, %8.0f frames/s\n",
+	       t_batch / frames / 1000, frames / (t_batch / 1e9));
+
+	libevdev_uinput_destroy(uidev);
+	libevdev_free(dev);
+
+	return 0;
+}
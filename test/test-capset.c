@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+#include "config.h"
+#include <libevdev/libevdev-util.h>
+
+#include "test-common.h"
+
+START_TEST(test_capset_codes)
+{
+	struct libevdev_capset *set = libevdev_capset_new();
+
+	ck_assert(set != NULL);
+	ck_assert_int_eq(libevdev_capset_count(set), 0);
+
+	ck_assert_int_eq(libevdev_capset_enable_event_code(set, EV_KEY, KEY_A), 0);
+	ck_assert_int_eq(libevdev_capset_enable_event_code(set, EV_KEY, KEY_MAX), 0);
+	ck_assert_int_eq(libevdev_capset_enable_event_code(set, EV_ABS, ABS_X), 0);
+	ck_assert_int_eq(libevdev_capset_enable_property(set, INPUT_PROP_DIRECT), 0);
+	ck_assert_int_eq(libevdev_capset_count(set), 4);
+
+	ck_assert(libevdev_capset_has_event_code(set, EV_KEY, KEY_A));
+	ck_assert(libevdev_capset_has_event_code(set, EV_KEY, KEY_MAX));
+	ck_assert(libevdev_capset_has_event_code(set, EV_ABS, ABS_X));
+	ck_assert(!libevdev_capset_has_event_code(set, EV_REL, REL_X));
+	ck_assert(!libevdev_capset_has_event_code(set, EV_KEY, KEY_B));
+	ck_assert(libevdev_capset_has_property(set, INPUT_PROP_DIRECT));
+	ck_assert(!libevdev_capset_has_property(set, INPUT_PROP_POINTER));
+
+	ck_assert_int_eq(libevdev_capset_enable_event_code(set, EV_KEY, KEY_MAX + 1), -1);
+	ck_assert_int_eq(libevdev_capset_enable_event_code(set, EV_SYN, SYN_REPORT), -1);
+	ck_assert_int_eq(libevdev_capset_enable_event_code(set, EV_MAX + 1, 0), -1);
+	ck_assert_int_eq(libevdev_capset_enable_property(set, INPUT_PROP_MAX + 1), -1);
+	ck_assert(!libevdev_capset_has_event_code(set, EV_KEY, KEY_MAX + 1));
+	ck_assert(!libevdev_capset_has_property(set, INPUT_PROP_MAX + 1));
+
+	ck_assert_int_eq(libevdev_capset_disable_event_code(set, EV_KEY, KEY_A), 0);
+	ck_assert_int_eq(libevdev_capset_disable_property(set, INPUT_PROP_DIRECT), 0);
+	ck_assert(!libevdev_capset_has_event_code(set, EV_KEY, KEY_A));
+	ck_assert(!libevdev_capset_has_property(set, INPUT_PROP_DIRECT));
+	ck_assert_int_eq(libevdev_capset_count(set), 2);
+
+	libevdev_capset_free(set);
+	libevdev_capset_free(NULL);
+}
+END_TEST
+
+START_TEST(test_capset_from_device)
+{
+	struct libevdev *d = libevdev_new();
+	struct libevdev_capset *set, *expected;
+	struct input_absinfo abs = { .minimum = 0, .maximum = 5 };
+
+	libevdev_enable_event_code(d, EV_KEY, BTN_LEFT, NULL);
+	libevdev_enable_event_code(d, EV_REL, REL_X, NULL);
+	libevdev_enable_event_code(d, EV_ABS, ABS_Y, &abs);
+	libevdev_enable_event_code(d, EV_LED, LED_NUML, NULL);
+	libevdev_enable_event_code(d, EV_MSC, MSC_SCAN, NULL);
+	libevdev_enable_property(d, INPUT_PROP_POINTER);
+
+	set = libevdev_capset_new_from_device(d);
+	ck_assert_int_eq(libevdev_capset_count(set), 6);
+
+	expected = libevdev_capset_new();
+	libevdev_capset_enable_event_code(expected, EV_KEY, BTN_LEFT);
+	libevdev_capset_enable_event_code(expected, EV_REL, REL_X);
+	libevdev_capset_enable_event_code(expected, EV_ABS, ABS_Y);
+	libevdev_capset_enable_event_code(expected, EV_LED, LED_NUML);
+	libevdev_capset_enable_event_code(expected, EV_MSC, MSC_SCAN);
+	libevdev_capset_enable_property(expected, INPUT_PROP_POINTER);
+	ck_assert(libevdev_capset_equal(set, expected));
+	libevdev_capset_free(set);
+
+	/* codes of disabled types are not in the set */
+	libevdev_disable_event_type(d, EV_REL);
+	set = libevdev_capset_new_from_device(d);
+	ck_assert(!libevdev_capset_has_event_code(set, EV_REL, REL_X));
+	ck_assert(!libevdev_capset_equal(set, expected));
+	ck_assert(libevdev_capset_is_subset(set, expected));
+
+	libevdev_capset_free(set);
+	libevdev_capset_free(expected);
+	libevdev_free(d);
+}
+END_TEST
+
+START_TEST(test_capset_algebra)
+{
+	struct libevdev_capset *a = libevdev_capset_new();
+	struct libevdev_capset *b = libevdev_capset_new();
+	struct libevdev_capset *empty = libevdev_capset_new();
+
+	libevdev_capset_enable_event_code(a, EV_KEY, BTN_LEFT);
+	libevdev_capset_enable_event_code(a, EV_KEY, BTN_RIGHT);
+	libevdev_capset_enable_property(a, INPUT_PROP_BUTTONPAD);
+
+	libevdev_capset_enable_event_code(b, EV_KEY, BTN_RIGHT);
+	libevdev_capset_enable_event_code(b, EV_REL, REL_X);
+
+	ck_assert(libevdev_capset_is_subset(empty, a));
+	ck_assert(libevdev_capset_is_disjoint(empty, a));
+	ck_assert(!libevdev_capset_is_subset(a, b));
+	ck_assert(!libevdev_capset_is_subset(b, a));
+	ck_assert(!libevdev_capset_is_disjoint(a, b));
+	ck_assert(libevdev_capset_equal(a, a));
+	ck_assert(!libevdev_capset_equal(a, b));
+
+	libevdev_capset_union(empty, a);
+	ck_assert(libevdev_capset_equal(empty, a));
+
+	libevdev_capset_union(a, b);
+	ck_assert_int_eq(libevdev_capset_count(a), 4);
+	ck_assert(libevdev_capset_is_subset(b, a));
+	ck_assert(libevdev_capset_is_subset(empty, a));
+	ck_assert(libevdev_capset_has_event_code(a, EV_REL, REL_X));
+
+	libevdev_capset_intersect(a, b);
+	ck_assert(libevdev_capset_equal(a, b));
+	ck_assert_int_eq(libevdev_capset_count(a), 2);
+
+	libevdev_capset_disable_event_code(a, EV_KEY, BTN_RIGHT);
+	libevdev_capset_disable_event_code(a, EV_REL, REL_X);
+	ck_assert_int_eq(libevdev_capset_count(a), 0);
+	ck_assert(libevdev_capset_is_disjoint(a, b));
+
+	libevdev_capset_free(a);
+	libevdev_capset_free(b);
+	libevdev_capset_free(empty);
+}
+END_TEST
+
+START_TEST(test_capset_iterate)
+{
+	struct libevdev_capset *set = libevdev_capset_new();
+	unsigned int codes[] = { KEY_ESC, KEY_1, 63, 64, 65, BTN_LEFT, KEY_MAX };
+	unsigned int i;
+	int code;
+
+	ck_assert_int_eq(libevdev_capset_next_event_code(set, EV_KEY, 0), -1);
+	ck_assert_int_eq(libevdev_capset_next_event_code(set, EV_SYN, 0), -1);
+	ck_assert_int_eq(libevdev_capset_next_event_code(set, EV_KEY, KEY_MAX + 1), -1);
+
+	for (i = 0; i < ARRAY_LENGTH(codes); i++)
+		libevdev_capset_enable_event_code(set, EV_KEY, codes[i]);
+	libevdev_capset_enable_event_code(set, EV_REL, REL_Y);
+
+	i = 0;
+	for (code = libevdev_capset_next_event_code(set, EV_KEY, 0);
+	     code != -1;
+	     code = libevdev_capset_next_event_code(set, EV_KEY, code + 1)) {
+		ck_assert_int_lt(i, ARRAY_LENGTH(codes));
+		ck_assert_int_eq(code, codes[i]);
+		i++;
+	}
+	ck_assert_int_eq(i, ARRAY_LENGTH(codes));
+
+	ck_assert_int_eq(libevdev_capset_next_event_code(set, EV_KEY, 64), 64);
+	ck_assert_int_eq(libevdev_capset_next_event_code(set, EV_KEY, 66), BTN_LEFT);
+	ck_assert_int_eq(libevdev_capset_next_event_code(set, EV_REL, 0), REL_Y);
+	ck_assert_int_eq(libevdev_capset_next_event_code(set, EV_REL, REL_Y + 1), -1);
+	ck_assert_int_eq(libevdev_capset_next_event_code(set, EV_ABS, 0), -1);
+
+	libevdev_capset_free(set);
+}
+END_TEST
+
+TEST_SUITE(capset)
+{
+	Suite *s = suite_create("Capability sets");
+
+	add_test(s, test_capset_codes);
+	add_test(s, test_capset_from_device);
+	add_test(s, test_capset_algebra);
+	add_test(s, test_capset_iterate);
+
+	return s;
+}
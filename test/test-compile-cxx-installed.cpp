@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+/* Compiled with only the directory of the generated header on the
+ * include path, like a consumer of the installed header. The header must
+ * not need the kernel headers libevdev was built with, so nothing here
+ * uses the macros from <linux/input.h>. */
+
+#include "event-names.hpp"
+
+static_assert(evdev::type_from_name("EV_KEY") == 0x01);
+static_assert(evdev::code_from_name("KEY_A") == 30);
+static_assert(evdev::code_from_name("BTN_A") == 0x130);
+static_assert(evdev::type_from_code_name("BTN_A") == 0x01);
+static_assert(evdev::code_from_name("KEY_CAMERA_ACCESS_DISABLE") == 0x24c);
+static_assert(evdev::code_get_name(0x03, 0x2f) == "ABS_MT_SLOT");
+static_assert(evdev::property_get_name(0x01) == "INPUT_PROP_DIRECT");
+static_assert(evdev::type_get_max(0x02) == 0x0f);
+
+int main(void) {
+	return 0;
+}
@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+/* Everything in this file is evaluated at compile time, the program
+ * itself does nothing. The header is installed as
+ * <libevdev/event-names.hpp>, here it is picked up from the build
+ * directory. */
+
+#include <libevdev/libevdev.h>
+#include "event-names.hpp"
+
+static_assert(evdev::type_from_name("EV_ABS") == EV_ABS);
+static_assert(evdev::type_from_name("EV_MAX") == EV_MAX);
+static_assert(evdev::type_from_name("EV_ABSX") == -1);
+
+static_assert(evdev::code_from_name("KEY_A") == KEY_A);
+static_assert(evdev::code_from_name("BTN_A") == BTN_A);
+static_assert(evdev::code_from_name("ABS_MT_SLOT") == ABS_MT_SLOT);
+static_assert(evdev::code_from_name("KEY_MAX") == KEY_MAX);
+static_assert(evdev::code_from_name("KEY_BANANA") == -1);
+static_assert(evdev::code_from_name("BTN_GAMEPAD") == -1);
+
+static_assert(evdev::code_from_name(EV_KEY, "BTN_LEFT") == BTN_LEFT);
+static_assert(evdev::code_from_name(EV_REL, "ABS_X") == -1);
+static_assert(evdev::code_from_name(EV_FF_STATUS, "FF_STATUS_STOPPED") == FF_STATUS_STOPPED);
+static_assert(evdev::code_from_name(EV_FF, "FF_STATUS_STOPPED") == -1);
+
+static_assert(evdev::type_from_code_name("BTN_LEFT") == EV_KEY);
+static_assert(evdev::type_from_code_name("SW_LID") == EV_SW);
+static_assert(evdev::type_from_code_name("EV_ABS") == -1);
+
+static_assert(evdev::property_from_name("INPUT_PROP_BUTTONPAD") == INPUT_PROP_BUTTONPAD);
+static_assert(evdev::tool_type_from_name("MT_TOOL_PALM") == MT_TOOL_PALM);
+
+static_assert(evdev::type_get_name(EV_SYN) == "EV_SYN");
+static_assert(evdev::type_get_name(EV_MAX + 1).empty());
+static_assert(evdev::code_get_name(EV_ABS, ABS_X) == "ABS_X");
+static_assert(evdev::code_get_name(EV_KEY, BTN_LEFT) == "BTN_LEFT");
+static_assert(evdev::code_get_name(EV_REL, REL_MAX + 1).empty());
+static_assert(evdev::code_get_name(EV_PWR, 0).empty());
+static_assert(evdev::property_get_name(INPUT_PROP_DIRECT) == "INPUT_PROP_DIRECT");
+static_assert(evdev::type_get_max(EV_KEY) == KEY_MAX);
+
+int main(void) {
+	return 0;
+}
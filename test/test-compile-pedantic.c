@@ -1,5 +1,6 @@
 #include <libevdev/libevdev.h>
 #include <libevdev/libevdev-uinput.h>
+#include <libevdev/libevdev-monitor.h>
 
 int main(void) {
 	return 0;
@@ -4,6 +4,10 @@
  */
 
 #include "config.h"
+#include <stddef.h>
+#include <string.h>
+#include <libevdev/libevdev-util.h>
+
 #include "test-common.h"
 
 START_TEST(test_info)
@@ -146,6 +150,375 @@ START_TEST(test_mt_tracking_id)
 }
 END_TEST
 
+START_TEST(test_event_code_count)
+{
+	struct libevdev *d = libevdev_new();
+	struct input_absinfo abs = { .minimum = -1, .maximum = 5 };
+	unsigned int code;
+
+	ck_assert_int_eq(libevdev_get_event_code_count(d, EV_KEY), 0);
+	ck_assert_int_eq(libevdev_get_event_code_count(d, EV_SYN), -1);
+	ck_assert_int_eq(libevdev_get_event_code_count(d, EV_PWR), -1);
+	ck_assert_int_eq(libevdev_get_event_code_count(d, EV_MAX + 1), -1);
+
+	for (code = KEY_ESC; code <= KEY_MAX; code += 3)
+		libevdev_enable_event_code(d, EV_KEY, code, NULL);
+	ck_assert_int_eq(libevdev_get_event_code_count(d, EV_KEY),
+			 (KEY_MAX - KEY_ESC) / 3 + 1);
+
+	libevdev_enable_event_code(d, EV_REL, REL_X, NULL);
+	libevdev_enable_event_code(d, EV_REL, REL_MAX, NULL);
+	ck_assert_int_eq(libevdev_get_event_code_count(d, EV_REL), 2);
+
+	libevdev_disable_event_type(d, EV_REL);
+	ck_assert_int_eq(libevdev_get_event_code_count(d, EV_REL), 0);
+
+	libevdev_enable_event_code(d, EV_ABS, ABS_X, &abs);
+	ck_assert_int_eq(libevdev_get_event_code_count(d, EV_ABS), 1);
+
+	libevdev_free(d);
+}
+END_TEST
+
+START_TEST(test_capability_summary)
+{
+	struct libevdev *d = libevdev_new();
+	struct libevdev_capability_summary summary;
+	struct input_absinfo abs = { .minimum = -1, .maximum = 5 };
+
+	libevdev_get_capability_summary(d, &summary, sizeof(summary));
+	ck_assert_int_eq(summary.ntypes, 1); /* EV_SYN */
+	ck_assert_int_eq(summary.ncodes_total, 0);
+	ck_assert_int_eq(summary.nprops, 0);
+	ck_assert_int_eq(summary.nslots, -1);
+	ck_assert_int_eq(summary.nmt_axes, 0);
+
+	libevdev_enable_property(d, INPUT_PROP_DIRECT);
+	libevdev_enable_property(d, INPUT_PROP_BUTTONPAD);
+	libevdev_enable_event_code(d, EV_KEY, BTN_TOUCH, NULL);
+	libevdev_enable_event_code(d, EV_KEY, BTN_LEFT, NULL);
+	libevdev_enable_event_code(d, EV_ABS, ABS_X, &abs);
+	libevdev_enable_event_code(d, EV_ABS, ABS_MT_SLOT, &abs);
+	libevdev_enable_event_code(d, EV_ABS, ABS_MT_POSITION_X, &abs);
+	libevdev_enable_event_code(d, EV_ABS, ABS_MT_TRACKING_ID, &abs);
+	libevdev_enable_event_code(d, EV_MSC, MSC_TIMESTAMP, NULL);
+
+	libevdev_get_capability_summary(d, &summary, sizeof(summary));
+	ck_assert_int_eq(summary.ntypes, 4);
+	ck_assert_int_eq(summary.ncodes[EV_SYN], 0);
+	ck_assert_int_eq(summary.ncodes[EV_KEY], 2);
+	ck_assert_int_eq(summary.ncodes[EV_ABS], 4);
+	ck_assert_int_eq(summary.ncodes[EV_MSC], 1);
+	ck_assert_int_eq(summary.ncodes[EV_REL], 0);
+	ck_assert_int_eq(summary.ncodes_total, 7);
+	ck_assert_int_eq(summary.nprops, 2);
+	ck_assert_int_eq(summary.nslots, 6);
+	ck_assert_int_eq(summary.nmt_axes, 3);
+
+	/* a caller built against a smaller struct only gets its prefix */
+	memset(&summary, 0xab, sizeof(summary));
+	libevdev_get_capability_summary(d, &summary,
+					offsetof(struct libevdev_capability_summary, ncodes_total));
+	ck_assert_int_eq(summary.ntypes, 4);
+	ck_assert_int_eq(summary.ncodes[EV_ABS], 4);
+	ck_assert_int_eq(summary.ncodes_total, 0xabababab);
+	ck_assert_int_eq(summary.nmt_axes, 0xabababab);
+
+	/* a caller built against a larger struct gets the rest zeroed */
+	{
+		struct {
+			struct libevdev_capability_summary s;
+			unsigned int extra;
+		} bigger;
+
+		memset(&bigger, 0xab, sizeof(bigger));
+		libevdev_get_capability_summary(d, &bigger.s, sizeof(bigger));
+		ck_assert_int_eq(bigger.s.nmt_axes, 3);
+		ck_assert_int_eq(bigger.extra, 0);
+	}
+
+	libevdev_free(d);
+}
+END_TEST
+
+START_TEST(test_enable_codes)
+{
+	struct libevdev *d = libevdev_new();
+	unsigned long bits[NLONGS(KEY_CNT)] = {0};
+	unsigned long toolong[NLONGS(KEY_CNT) + 1] = {0};
+	unsigned int code;
+	int rc;
+
+	for (code = KEY_ESC; code <= KEY_MAX; code += 5)
+		set_bit(bits, code);
+
+	rc = libevdev_enable_event_codes(d, EV_KEY, bits, KEY_CNT);
+	ck_assert_int_eq(rc, 0);
+	ck_assert(libevdev_has_event_type(d, EV_KEY));
+	for (code = 0; code <= KEY_MAX; code++)
+		ck_assert_int_eq(libevdev_has_event_code(d, EV_KEY, code),
+				 code >= KEY_ESC && (code - KEY_ESC) % 5 == 0);
+
+	/* disable everything but the first 64 bits */
+	rc = libevdev_disable_event_codes(d, EV_KEY, bits, KEY_CNT);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_enable_event_codes(d, EV_KEY, bits, 64);
+	ck_assert_int_eq(rc, 0);
+	for (code = 0; code <= KEY_MAX; code++)
+		ck_assert_int_eq(libevdev_has_event_code(d, EV_KEY, code),
+				 code < 64 && code >= KEY_ESC && (code - KEY_ESC) % 5 == 0);
+
+	/* bits beyond the max must not be set */
+	memcpy(toolong, bits, sizeof(bits));
+	set_bit(toolong, KEY_CNT);
+	rc = libevdev_enable_event_codes(d, EV_KEY, toolong, KEY_CNT + 1);
+	ck_assert_int_eq(rc, -1);
+	ck_assert(!libevdev_has_event_code(d, EV_KEY, KEY_MAX - 1));
+	clear_bit(toolong, KEY_CNT);
+	rc = libevdev_enable_event_codes(d, EV_KEY, toolong, ARRAY_LENGTH(toolong) * LONG_BITS);
+	ck_assert_int_eq(rc, 0);
+
+	/* need data */
+	rc = libevdev_enable_event_codes(d, EV_ABS, bits, ABS_CNT);
+	ck_assert_int_eq(rc, -1);
+	rc = libevdev_enable_event_codes(d, EV_REP, bits, REP_CNT);
+	ck_assert_int_eq(rc, -1);
+	rc = libevdev_disable_event_codes(d, EV_SYN, bits, SYN_CNT);
+	ck_assert_int_eq(rc, -1);
+	rc = libevdev_enable_event_codes(d, EV_MAX + 1, bits, 1);
+	ck_assert_int_eq(rc, -1);
+
+	libevdev_free(d);
+}
+END_TEST
+
+START_TEST(test_disable_codes_mt)
+{
+	struct libevdev *d = libevdev_new();
+	struct input_absinfo abs = { .minimum = -1, .maximum = 5 };
+	unsigned long bits[NLONGS(ABS_CNT)] = {0};
+	int rc;
+
+	libevdev_enable_event_code(d, EV_ABS, ABS_X, &abs);
+	libevdev_enable_event_code(d, EV_ABS, ABS_MT_SLOT, &abs);
+	libevdev_enable_event_code(d, EV_ABS, ABS_MT_POSITION_X, &abs);
+	libevdev_enable_event_code(d, EV_ABS, ABS_MT_TRACKING_ID, &abs);
+	ck_assert_int_eq(libevdev_get_num_slots(d), 6);
+
+	set_bit(bits, ABS_X);
+	set_bit(bits, ABS_MT_POSITION_X);
+	rc = libevdev_disable_event_codes(d, EV_ABS, bits, ABS_CNT);
+	ck_assert_int_eq(rc, 0);
+	ck_assert(!libevdev_has_event_code(d, EV_ABS, ABS_X));
+	ck_assert(!libevdev_has_event_code(d, EV_ABS, ABS_MT_POSITION_X));
+	ck_assert_int_eq(libevdev_get_num_slots(d), 6);
+
+	set_bit(bits, ABS_MT_SLOT);
+	rc = libevdev_disable_event_codes(d, EV_ABS, bits, ABS_CNT);
+	ck_assert_int_eq(rc, 0);
+	ck_assert(!libevdev_has_event_code(d, EV_ABS, ABS_MT_SLOT));
+	ck_assert(libevdev_has_event_code(d, EV_ABS, ABS_MT_TRACKING_ID));
+	ck_assert_int_eq(libevdev_get_num_slots(d), -1);
+
+	libevdev_free(d);
+}
+END_TEST
+
+START_TEST(test_get_code_bits)
+{
+	struct libevdev *d = libevdev_new();
+	struct input_absinfo abs = { .minimum = -1, .maximum = 5 };
+	unsigned long bits[NLONGS(KEY_CNT) + 2];
+	unsigned long props[NLONGS(INPUT_PROP_CNT)];
+	unsigned int code;
+	int rc;
+
+	rc = libevdev_get_event_code_bits(d, EV_KEY, NULL, 0);
+	ck_assert_int_eq(rc, NLONGS(KEY_CNT));
+	rc = libevdev_get_event_code_bits(d, EV_SYN, bits, ARRAY_LENGTH(bits));
+	ck_assert_int_eq(rc, -1);
+	rc = libevdev_get_event_code_bits(d, EV_MAX + 1, bits, ARRAY_LENGTH(bits));
+	ck_assert_int_eq(rc, -1);
+
+	memset(bits, 0xab, sizeof(bits));
+	rc = libevdev_get_event_code_bits(d, EV_KEY, bits, ARRAY_LENGTH(bits));
+	ck_assert_int_eq(rc, NLONGS(KEY_CNT));
+	for (code = 0; code < ARRAY_LENGTH(bits) * LONG_BITS; code++)
+		ck_assert(!bit_is_set(bits, code));
+
+	libevdev_enable_event_code(d, EV_KEY, KEY_A, NULL);
+	libevdev_enable_event_code(d, EV_KEY, BTN_LEFT, NULL);
+	libevdev_enable_event_code(d, EV_KEY, KEY_MAX, NULL);
+	libevdev_enable_event_code(d, EV_ABS, ABS_Y, &abs);
+
+	memset(bits, 0xab, sizeof(bits));
+	rc = libevdev_get_event_code_bits(d, EV_KEY, bits, ARRAY_LENGTH(bits));
+	ck_assert_int_eq(rc, NLONGS(KEY_CNT));
+	for (code = 0; code < ARRAY_LENGTH(bits) * LONG_BITS; code++)
+		ck_assert_int_eq(bit_is_set(bits, code),
+				 code == KEY_A || code == BTN_LEFT || code == KEY_MAX);
+
+	/* truncated */
+	memset(bits, 0, sizeof(bits));
+	rc = libevdev_get_event_code_bits(d, EV_KEY, bits, 1);
+	ck_assert_int_eq(rc, NLONGS(KEY_CNT));
+	ck_assert(bit_is_set(bits, KEY_A));
+	ck_assert(!bit_is_set(bits, BTN_LEFT));
+
+	rc = libevdev_get_event_code_bits(d, EV_ABS, bits, NLONGS(ABS_CNT));
+	ck_assert_int_eq(rc, NLONGS(ABS_CNT));
+	ck_assert_int_eq(bit_count(bits, 0, ABS_CNT), 1);
+	ck_assert(bit_is_set(bits, ABS_Y));
+
+	/* a disabled type reads as empty */
+	libevdev_disable_event_type(d, EV_KEY);
+	rc = libevdev_get_event_code_bits(d, EV_KEY, bits, ARRAY_LENGTH(bits));
+	ck_assert_int_eq(rc, NLONGS(KEY_CNT));
+	ck_assert_int_eq(bit_count(bits, 0, KEY_CNT), 0);
+
+	libevdev_enable_property(d, INPUT_PROP_DIRECT);
+	libevdev_enable_property(d, INPUT_PROP_MAX);
+	rc = libevdev_get_property_bits(d, props, ARRAY_LENGTH(props));
+	ck_assert_int_eq(rc, NLONGS(INPUT_PROP_CNT));
+	for (code = 0; code < INPUT_PROP_CNT; code++)
+		ck_assert_int_eq(bit_is_set(props, code),
+				 code == INPUT_PROP_DIRECT || code == INPUT_PROP_MAX);
+
+	libevdev_free(d);
+}
+END_TEST
+
+START_TEST(test_device_class)
+{
+	struct libevdev *d = libevdev_new();
+	struct input_absinfo abs = { .minimum = 0, .maximum = 100 };
+	unsigned int code;
+
+	ck_assert_int_eq(libevdev_get_device_class(d), 0);
+
+	for (code = KEY_ESC; code <= KEY_S; code++)
+		libevdev_enable_event_code(d, EV_KEY, code, NULL);
+	ck_assert_int_eq(libevdev_get_device_class(d), LIBEVDEV_DEVICE_CLASS_KEYBOARD);
+	libevdev_disable_event_code(d, EV_KEY, KEY_Q);
+	ck_assert_int_eq(libevdev_get_device_class(d), 0);
+	libevdev_enable_event_code(d, EV_KEY, KEY_Q, NULL);
+
+	/* keyboard with a pointing stick */
+	libevdev_enable_event_code(d, EV_REL, REL_X, NULL);
+	libevdev_enable_event_code(d, EV_REL, REL_Y, NULL);
+	ck_assert_int_eq(libevdev_get_device_class(d), LIBEVDEV_DEVICE_CLASS_KEYBOARD);
+	libevdev_enable_property(d, INPUT_PROP_POINTING_STICK);
+	ck_assert_int_eq(libevdev_get_device_class(d),
+			 LIBEVDEV_DEVICE_CLASS_KEYBOARD|LIBEVDEV_DEVICE_CLASS_POINTER);
+	libevdev_disable_property(d, INPUT_PROP_POINTING_STICK);
+	libevdev_enable_event_code(d, EV_KEY, BTN_LEFT, NULL);
+	ck_assert_int_eq(libevdev_get_device_class(d),
+			 LIBEVDEV_DEVICE_CLASS_KEYBOARD|LIBEVDEV_DEVICE_CLASS_POINTER);
+	libevdev_disable_event_type(d, EV_KEY);
+	ck_assert_int_eq(libevdev_get_device_class(d), 0);
+	libevdev_free(d);
+
+	/* touchpad */
+	d = libevdev_new();
+	libevdev_enable_event_code(d, EV_ABS, ABS_X, &abs);
+	libevdev_enable_event_code(d, EV_ABS, ABS_Y, &abs);
+	libevdev_enable_event_code(d, EV_KEY, BTN_LEFT, NULL);
+	ck_assert_int_eq(libevdev_get_device_class(d), LIBEVDEV_DEVICE_CLASS_POINTER);
+	libevdev_enable_event_code(d, EV_KEY, BTN_TOUCH, NULL);
+	ck_assert_int_eq(libevdev_get_device_class(d), LIBEVDEV_DEVICE_CLASS_TOUCHSCREEN);
+	libevdev_enable_event_code(d, EV_KEY, BTN_TOOL_FINGER, NULL);
+	ck_assert_int_eq(libevdev_get_device_class(d), LIBEVDEV_DEVICE_CLASS_TOUCHPAD);
+	/* touchscreen */
+	libevdev_enable_property(d, INPUT_PROP_DIRECT);
+	ck_assert_int_eq(libevdev_get_device_class(d), LIBEVDEV_DEVICE_CLASS_TOUCHSCREEN);
+	/* tablet */
+	libevdev_enable_event_code(d, EV_KEY, BTN_TOOL_PEN, NULL);
+	ck_assert_int_eq(libevdev_get_device_class(d), LIBEVDEV_DEVICE_CLASS_TABLET);
+	libevdev_free(d);
+
+	/* MT-only touchscreen */
+	d = libevdev_new();
+	libevdev_enable_event_code(d, EV_ABS, ABS_MT_POSITION_X, &abs);
+	libevdev_enable_event_code(d, EV_ABS, ABS_MT_POSITION_Y, &abs);
+	libevdev_enable_event_code(d, EV_KEY, BTN_TOUCH, NULL);
+	ck_assert_int_eq(libevdev_get_device_class(d), LIBEVDEV_DEVICE_CLASS_TOUCHSCREEN);
+	libevdev_free(d);
+
+	/* gamepad */
+	d = libevdev_new();
+	libevdev_enable_event_code(d, EV_ABS, ABS_X, &abs);
+	libevdev_enable_event_code(d, EV_ABS, ABS_Y, &abs);
+	libevdev_enable_event_code(d, EV_KEY, BTN_SOUTH, NULL);
+	ck_assert_int_eq(libevdev_get_device_class(d), LIBEVDEV_DEVICE_CLASS_JOYSTICK);
+	libevdev_disable_event_code(d, EV_KEY, BTN_SOUTH);
+	libevdev_enable_event_code(d, EV_KEY, BTN_TRIGGER_HAPPY2, NULL);
+	ck_assert_int_eq(libevdev_get_device_class(d), LIBEVDEV_DEVICE_CLASS_JOYSTICK);
+	libevdev_free(d);
+
+	/* switch */
+	d = libevdev_new();
+	libevdev_enable_event_type(d, EV_SW);
+	ck_assert_int_eq(libevdev_get_device_class(d), 0);
+	libevdev_enable_event_code(d, EV_SW, SW_LID, NULL);
+	ck_assert_int_eq(libevdev_get_device_class(d), LIBEVDEV_DEVICE_CLASS_SWITCH);
+	libevdev_free(d);
+}
+END_TEST
+
+START_TEST(test_clone)
+{
+	struct libevdev *d = libevdev_new();
+	struct libevdev *clone;
+	struct input_absinfo abs = { .minimum = -1, .maximum = 5 };
+	int rc;
+
+	libevdev_set_name(d, "some name");
+	libevdev_set_id_vendor(d, 2);
+	libevdev_enable_property(d, INPUT_PROP_DIRECT);
+	libevdev_enable_event_code(d, EV_KEY, BTN_TOUCH, NULL);
+	libevdev_enable_event_code(d, EV_ABS, ABS_X, &abs);
+	libevdev_enable_event_code(d, EV_ABS, ABS_MT_SLOT, &abs);
+	libevdev_enable_event_code(d, EV_ABS, ABS_MT_TRACKING_ID, &abs);
+	libevdev_set_event_value(d, EV_KEY, BTN_TOUCH, 1);
+	libevdev_set_event_value(d, EV_ABS, ABS_X, 3);
+	libevdev_set_slot_value(d, 2, ABS_MT_TRACKING_ID, 4);
+
+	rc = libevdev_clone(d, &clone);
+	ck_assert_int_eq(rc, 0);
+	ck_assert(clone != d);
+
+	ck_assert_str_eq(libevdev_get_name(clone), "some name");
+	ck_assert(libevdev_get_phys(clone) == NULL);
+	ck_assert_int_eq(libevdev_get_id_vendor(clone), 2);
+	ck_assert_int_eq(libevdev_get_fd(clone), -1);
+	ck_assert(libevdev_has_property(clone, INPUT_PROP_DIRECT));
+	ck_assert(libevdev_has_event_code(clone, EV_KEY, BTN_TOUCH));
+	ck_assert_int_eq(libevdev_get_abs_maximum(clone, ABS_X), 5);
+	ck_assert_int_eq(libevdev_get_event_value(clone, EV_KEY, BTN_TOUCH), 1);
+	ck_assert_int_eq(libevdev_get_event_value(clone, EV_ABS, ABS_X), 3);
+	ck_assert_int_eq(libevdev_get_num_slots(clone), 6);
+	ck_assert_int_eq(libevdev_get_slot_value(clone, 2, ABS_MT_TRACKING_ID), 4);
+	ck_assert_int_eq(libevdev_get_slot_value(clone, 1, ABS_MT_TRACKING_ID), -1);
+
+	/* the two devices are independent */
+	libevdev_set_name(clone, "other name");
+	libevdev_disable_event_code(clone, EV_KEY, BTN_TOUCH);
+	libevdev_set_event_value(clone, EV_ABS, ABS_X, 1);
+	libevdev_set_slot_value(clone, 2, ABS_MT_TRACKING_ID, -1);
+
+	ck_assert_str_eq(libevdev_get_name(d), "some name");
+	ck_assert(libevdev_has_event_code(d, EV_KEY, BTN_TOUCH));
+	ck_assert_int_eq(libevdev_get_event_value(d, EV_ABS, ABS_X), 3);
+	ck_assert_int_eq(libevdev_get_slot_value(d, 2, ABS_MT_TRACKING_ID), 4);
+
+	libevdev_free(d);
+
+	ck_assert_str_eq(libevdev_get_name(clone), "other name");
+	ck_assert_int_eq(libevdev_get_slot_value(clone, 2, ABS_MT_TRACKING_ID), -1);
+	libevdev_free(clone);
+}
+END_TEST
+
 TEST_SUITE(event_name_suite)
 {
 	Suite *s = suite_create("Context manipulation");
@@ -156,6 +529,13 @@ TEST_SUITE(event_name_suite)
 	add_test(s, test_mt_slots_enable_disable);
 	add_test(s, test_mt_slots_increase_decrease);
 	add_test(s, test_mt_tracking_id);
+	add_test(s, test_event_code_count);
+	add_test(s, test_capability_summary);
+	add_test(s, test_enable_codes);
+	add_test(s, test_disable_codes_mt);
+	add_test(s, test_get_code_bits);
+	add_test(s, test_device_class);
+	add_test(s, test_clone);
 
 	return s;
 }
@@ -4,6 +4,7 @@
  */
 
 #include "config.h"
+#include <libevdev/libevdev-util.h>
 #include "test-common.h"
 
 START_TEST(test_type_names)
@@ -189,6 +190,67 @@ START_TEST(test_code_names_max)
 }
 END_TEST
 
+START_TEST(test_code_names_all)
+{
+	unsigned int type, code;
+
+	for (type = 0; type <= EV_MAX; type++) {
+		const char *name = libevdev_event_type_get_name(type);
+		int max = libevdev_event_type_get_max(type);
+
+		if (name)
+			ck_assert_int_eq(libevdev_event_type_from_name(name), type);
+
+		for (code = 0; max != -1 && code <= (unsigned int)max; code++) {
+			name = libevdev_event_code_get_name(type, code);
+			if (!name)
+				continue;
+
+			ck_assert_int_eq(libevdev_event_code_from_code_name(name), code);
+		}
+	}
+}
+END_TEST
+
+START_TEST(test_code_names_batch)
+{
+	const char *names[] = { "KEY_A", "BTN_LEFT", "ABS_MT_SLOT", "FF_STATUS_MAX", "KEY_BANANA", "EV_ABS" };
+	int types[ARRAY_LENGTH(names)], codes[ARRAY_LENGTH(names)];
+	unsigned int utypes[] = { EV_KEY, EV_KEY, EV_ABS, EV_REL, EV_ABS, EV_MAX + 1 };
+	unsigned int ucodes[] = { KEY_A, BTN_LEFT, ABS_MT_SLOT, REL_MAX + 1, ABS_MAX + 1, 0 };
+	const char *out[ARRAY_LENGTH(names)];
+	size_t found;
+
+	found = libevdev_event_codes_from_code_names(names, ARRAY_LENGTH(names), types, codes);
+	ck_assert_int_eq(found, 4);
+	ck_assert_int_eq(types[0], EV_KEY);
+	ck_assert_int_eq(codes[0], KEY_A);
+	ck_assert_int_eq(types[1], EV_KEY);
+	ck_assert_int_eq(codes[1], BTN_LEFT);
+	ck_assert_int_eq(types[2], EV_ABS);
+	ck_assert_int_eq(codes[2], ABS_MT_SLOT);
+	ck_assert_int_eq(types[3], EV_FF_STATUS);
+	ck_assert_int_eq(codes[3], FF_STATUS_MAX);
+	ck_assert_int_eq(types[4], -1);
+	ck_assert_int_eq(codes[4], -1);
+	ck_assert_int_eq(types[5], -1);
+	ck_assert_int_eq(codes[5], -1);
+
+	found = libevdev_event_codes_from_code_names(names, 2, NULL, codes);
+	ck_assert_int_eq(found, 2);
+	ck_assert_int_eq(codes[1], BTN_LEFT);
+
+	found = libevdev_event_codes_get_names(utypes, ucodes, ARRAY_LENGTH(utypes), out);
+	ck_assert_int_eq(found, 3);
+	ck_assert_str_eq(out[0], "KEY_A");
+	ck_assert_str_eq(out[1], "BTN_LEFT");
+	ck_assert_str_eq(out[2], "ABS_MT_SLOT");
+	ck_assert(out[3] == NULL);
+	ck_assert(out[4] == NULL);
+	ck_assert(out[5] == NULL);
+}
+END_TEST
+
 START_TEST(test_value_names)
 {
 	ck_assert_int_eq(libevdev_event_value_from_name(EV_ABS, ABS_MT_TOOL_TYPE, "MT_TOOL_PALM"), MT_TOOL_PALM);
@@ -257,6 +319,8 @@ TEST_SUITE(event_code_suite)
 	add_test(s, test_code_names_invalid);
 	add_test(s, test_code_name_lookup_invalid);
 	add_test(s, test_code_names_max);
+	add_test(s, test_code_names_all);
+	add_test(s, test_code_names_batch);
 
 	add_test(s, test_value_names);
 	add_test(s, test_value_names_invalid);
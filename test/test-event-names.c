@@ -4,6 +4,7 @@
  */
 
 #include "config.h"
+#include <errno.h>
 #include "test-common.h"
 
 START_TEST(test_limits)
@@ -284,6 +285,58 @@ START_TEST(test_event_code)
 }
 END_TEST
 
+START_TEST(test_event_format)
+{
+	struct input_event ev = {
+		.input_event_sec = 12,
+		.input_event_usec = 34,
+		.type = EV_KEY,
+		.code = KEY_A,
+		.value = 1,
+	};
+	char buf[64];
+	int rc;
+
+	rc = libevdev_event_format(buf, sizeof(buf), &ev, 0);
+	ck_assert_str_eq(buf, "EV_KEY KEY_A 1");
+	ck_assert_int_eq(rc, strlen(buf));
+
+	rc = libevdev_event_format(buf, sizeof(buf), &ev,
+				   LIBEVDEV_FORMAT_FLAG_TIMESTAMP|LIBEVDEV_FORMAT_FLAG_NUMERIC);
+	ck_assert_str_eq(buf, "12.000034 EV_KEY(1) KEY_A(30) 1");
+	ck_assert_int_eq(rc, strlen(buf));
+
+	ev.type = EV_ABS;
+	ev.code = ABS_MAX + 1;
+	ev.value = -200;
+	rc = libevdev_event_format(buf, sizeof(buf), &ev, 0);
+	ck_assert_str_eq(buf, "EV_ABS 64 -200");
+
+	ev.type = EV_MAX + 1;
+	ev.code = 0;
+	ev.value = 0;
+	rc = libevdev_event_format(buf, sizeof(buf), &ev, LIBEVDEV_FORMAT_FLAG_NUMERIC);
+	ck_assert_str_eq(buf, "32 0 0");
+
+	/* truncated */
+	ev.type = EV_SYN;
+	ev.code = SYN_REPORT;
+	rc = libevdev_event_format(buf, 8, &ev, 0);
+	ck_assert_str_eq(buf, "EV_SYN ");
+	ck_assert_int_eq(rc, strlen("EV_SYN SYN_REPORT 0"));
+
+	buf[0] = 'x';
+	rc = libevdev_event_format(buf, 0, &ev, 0);
+	ck_assert_int_eq(buf[0], 'x');
+	ck_assert_int_eq(rc, strlen("EV_SYN SYN_REPORT 0"));
+
+	libevdev_set_log_function(test_logfunc_ignore_error, NULL);
+	rc = libevdev_event_format(buf, sizeof(buf), &ev, 0x10);
+	ck_assert_int_eq(rc, -EINVAL);
+	libevdev_set_log_function(test_logfunc_abort_on_error, NULL);
+}
+END_TEST
+
 TEST_SUITE(event_name_suite)
 {
 	Suite *s = suite_create("Event names");
@@ -310,5 +363,7 @@ TEST_SUITE(event_name_suite)
 	add_test(s, test_event_type);
 	add_test(s, test_event_code);
 
+	add_test(s, test_event_format);
+
 	return s;
 }
@@ -11,8 +11,12 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
 
+#include <libevdev/libevdev-monitor.h>
 #include <libevdev/libevdev-uinput.h>
+#include <libevdev/libevdev-util.h>
 #include "test-common.h"
 
 START_TEST(test_new_device)
@@ -673,6 +677,398 @@ START_TEST(test_clock_id_events)
 }
 END_TEST
 
+START_TEST(test_device_init_lazy)
+{
+	struct uinput_device* uidev;
+	struct libevdev *dev, *lazy;
+	struct input_event ev;
+	struct input_absinfo abs[] = {
+		{ .value = ABS_X, .minimum = 0, .maximum = 1000, .resolution = 10 },
+		{ .value = ABS_Y, .minimum = 0, .maximum = 1000, .resolution = 10 },
+		{ .value = ABS_MT_POSITION_X, .maximum = 1000 },
+		{ .value = ABS_MT_POSITION_Y, .maximum = 1000 },
+		{ .value = ABS_MT_SLOT, .maximum = 3 },
+		{ .value = ABS_MT_TRACKING_ID, .minimum = -1, .maximum = 500 },
+	};
+	unsigned long bits[NLONGS(KEY_CNT)], lazy_bits[NLONGS(KEY_CNT)];
+	int rc;
+
+	test_create_abs_device(&uidev, &dev,
+			       ARRAY_LENGTH(abs), abs,
+			       EV_KEY, BTN_TOUCH,
+			       EV_KEY, BTN_TOOL_FINGER,
+			       EV_KEY, BTN_LEFT,
+			       -1);
+
+	libevdev_set_log_function(test_logfunc_ignore_error, NULL);
+	rc = libevdev_new_from_fd_with_flags(uinput_device_get_fd(uidev), 0x10, &lazy);
+	ck_assert_int_eq(rc, -EINVAL);
+	libevdev_set_log_function(test_logfunc_abort_on_error, NULL);
+
+	uinput_device_event(uidev, EV_KEY, BTN_LEFT, 1);
+	uinput_device_event(uidev, EV_SYN, SYN_REPORT, 0);
+
+	rc = libevdev_new_from_fd_with_flags(uinput_device_get_fd(uidev),
+					     LIBEVDEV_INIT_FLAG_LAZY,
+					     &lazy);
+	ck_assert_int_eq(rc, 0);
+
+	ck_assert_str_eq(libevdev_get_name(lazy), libevdev_get_name(dev));
+	ck_assert_int_eq(libevdev_get_id_vendor(lazy), libevdev_get_id_vendor(dev));
+	ck_assert_int_eq(libevdev_get_device_class(lazy), libevdev_get_device_class(dev));
+	ck_assert_int_eq(libevdev_get_device_class(lazy), LIBEVDEV_DEVICE_CLASS_TOUCHPAD);
+
+	libevdev_get_event_code_bits(dev, EV_KEY, bits, ARRAY_LENGTH(bits));
+	libevdev_get_event_code_bits(lazy, EV_KEY, lazy_bits, ARRAY_LENGTH(lazy_bits));
+	ck_assert(memcmp(bits, lazy_bits, sizeof(bits)) == 0);
+
+	ck_assert_int_eq(libevdev_get_abs_maximum(lazy, ABS_X), 1000);
+	ck_assert_int_eq(libevdev_get_abs_resolution(lazy, ABS_Y), 10);
+	ck_assert_int_eq(libevdev_get_num_slots(lazy), 4);
+	ck_assert_int_eq(libevdev_get_slot_value(lazy, 0, ABS_MT_TRACKING_ID), -1);
+
+	/* state is fetched on first access, after the event above */
+	ck_assert_int_eq(libevdev_get_event_value(lazy, EV_KEY, BTN_LEFT), 1);
+
+	uinput_device_event(uidev, EV_KEY, BTN_LEFT, 0);
+	uinput_device_event(uidev, EV_SYN, SYN_REPORT, 0);
+
+	/* the first BTN_LEFT 1 is still pending on the fd */
+	rc = libevdev_next_event(lazy, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+	ck_assert_int_eq(rc, LIBEVDEV_READ_STATUS_SUCCESS);
+	assert_event(&ev, EV_KEY, BTN_LEFT, 1);
+	rc = libevdev_next_event(lazy, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+	ck_assert_int_eq(rc, LIBEVDEV_READ_STATUS_SUCCESS);
+	assert_event(&ev, EV_SYN, SYN_REPORT, 0);
+	rc = libevdev_next_event(lazy, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+	ck_assert_int_eq(rc, LIBEVDEV_READ_STATUS_SUCCESS);
+	assert_event(&ev, EV_KEY, BTN_LEFT, 0);
+	ck_assert_int_eq(libevdev_get_event_value(lazy, EV_KEY, BTN_LEFT), 0);
+
+	libevdev_free(lazy);
+	uinput_device_free(uidev);
+	libevdev_free(dev);
+}
+END_TEST
+
+START_TEST(test_device_init_lazy_modify)
+{
+	struct uinput_device* uidev;
+	struct libevdev *dev, *lazy;
+	int rc;
+
+	test_create_device(&uidev, &dev,
+			   EV_SYN, SYN_REPORT,
+			   EV_REL, REL_X,
+			   EV_REL, REL_Y,
+			   EV_KEY, BTN_LEFT,
+			   -1);
+
+	rc = libevdev_new_from_fd_with_flags(uinput_device_get_fd(uidev),
+					     LIBEVDEV_INIT_FLAG_LAZY,
+					     &lazy);
+	ck_assert_int_eq(rc, 0);
+
+	/* modifying the device must not lose the kernel's capabilities */
+	rc = libevdev_enable_event_code(lazy, EV_KEY, BTN_RIGHT, NULL);
+	ck_assert_int_eq(rc, 0);
+	ck_assert(libevdev_has_event_code(lazy, EV_KEY, BTN_LEFT));
+	ck_assert(libevdev_has_event_code(lazy, EV_KEY, BTN_RIGHT));
+	ck_assert(libevdev_has_event_code(lazy, EV_REL, REL_X));
+	ck_assert_int_eq(libevdev_get_device_class(lazy), LIBEVDEV_DEVICE_CLASS_POINTER);
+
+	libevdev_free(lazy);
+	uinput_device_free(uidev);
+	libevdev_free(dev);
+}
+END_TEST
+
+START_TEST(test_device_init_lazy_fetch_error)
+{
+	struct uinput_device* uidev;
+	struct libevdev *dev, *lazy, *clone;
+	int fd;
+	int rc;
+
+	test_create_device(&uidev, &dev,
+			   EV_SYN, SYN_REPORT,
+			   EV_REL, REL_X,
+			   EV_REL, REL_Y,
+			   EV_KEY, BTN_LEFT,
+			   -1);
+
+	fd = dup(uinput_device_get_fd(uidev));
+	ck_assert_int_ge(fd, 0);
+	rc = libevdev_new_from_fd_with_flags(fd, LIBEVDEV_INIT_FLAG_LAZY, &lazy);
+	ck_assert_int_eq(rc, 0);
+	close(fd);
+
+	/* every getter finds the data missing, the error is logged once */
+	log_fn_called = 0;
+	libevdev_set_log_function(logfunc, logdata);
+	ck_assert(!libevdev_has_event_code(lazy, EV_KEY, BTN_LEFT));
+	ck_assert(!libevdev_has_event_type(lazy, EV_REL));
+	ck_assert_int_eq(libevdev_get_event_value(lazy, EV_KEY, BTN_LEFT), 0);
+	ck_assert_int_eq(log_fn_called, 1);
+	libevdev_set_log_function(test_logfunc_abort_on_error, NULL);
+	log_fn_called = 0;
+
+	/* a clone could never fetch the missing data */
+	clone = NULL;
+	rc = libevdev_clone(lazy, &clone);
+	ck_assert_int_eq(rc, -EBADF);
+	ck_assert(clone == NULL);
+
+	libevdev_free(lazy);
+	uinput_device_free(uidev);
+	libevdev_free(dev);
+}
+END_TEST
+
+START_TEST(test_device_init_lazy_realtime)
+{
+	struct uinput_device* uidev;
+	struct libevdev *dev, *lazy;
+	int fd;
+	int rc;
+
+	test_create_device(&uidev, &dev,
+			   EV_SYN, SYN_REPORT,
+			   EV_REL, REL_X,
+			   EV_REL, REL_Y,
+			   EV_KEY, BTN_LEFT,
+			   -1);
+
+	/* in realtime mode everything is fetched up front, closing the
+	 * fd afterwards must not lose any data */
+	fd = dup(uinput_device_get_fd(uidev));
+	ck_assert_int_ge(fd, 0);
+	lazy = libevdev_new();
+	rc = libevdev_set_realtime_mode(lazy, LIBEVDEV_REALTIME_ON);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_set_fd_with_flags(lazy, fd, LIBEVDEV_INIT_FLAG_LAZY);
+	ck_assert_int_eq(rc, 0);
+	close(fd);
+
+	ck_assert(libevdev_has_event_code(lazy, EV_KEY, BTN_LEFT));
+	ck_assert(libevdev_has_event_code(lazy, EV_REL, REL_Y));
+	ck_assert_int_eq(libevdev_dispatch_deferred_log(lazy), 0);
+
+	libevdev_free(lazy);
+	uinput_device_free(uidev);
+	libevdev_free(dev);
+}
+END_TEST
+
+START_TEST(test_device_clone)
+{
+	struct uinput_device* uidev;
+	struct libevdev *dev, *clone;
+	struct input_event ev;
+	struct input_event events[] = {
+		{ .type = EV_KEY, .code = BTN_LEFT, .value = 0 },
+		{ .type = EV_SYN, .code = SYN_REPORT, .value = 0 },
+	};
+	int pipefd[2];
+	int rc;
+
+	test_create_device(&uidev, &dev,
+			   EV_SYN, SYN_REPORT,
+			   EV_REL, REL_X,
+			   EV_KEY, BTN_LEFT,
+			   -1);
+
+	/* one event queued in dev when we clone */
+	uinput_device_event(uidev, EV_KEY, BTN_LEFT, 1);
+	uinput_device_event(uidev, EV_SYN, SYN_REPORT, 0);
+	rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+	ck_assert_int_eq(rc, LIBEVDEV_READ_STATUS_SUCCESS);
+	assert_event(&ev, EV_KEY, BTN_LEFT, 1);
+
+	rc = libevdev_clone(dev, &clone);
+	ck_assert_int_eq(rc, 0);
+	ck_assert_int_eq(libevdev_get_fd(clone), -1);
+	ck_assert_int_eq(libevdev_get_event_value(clone, EV_KEY, BTN_LEFT), 1);
+
+	/* queued events are copied, but there is no fd to read from */
+	rc = libevdev_next_event(clone, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+	ck_assert_int_eq(rc, -EBADF);
+
+	rc = pipe2(pipefd, O_NONBLOCK);
+	ck_assert_int_eq(rc, 0);
+	libevdev_change_fd(clone, pipefd[0]);
+
+	rc = libevdev_next_event(clone, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+	ck_assert_int_eq(rc, LIBEVDEV_READ_STATUS_SUCCESS);
+	assert_event(&ev, EV_SYN, SYN_REPORT, 0);
+
+	rc = write(pipefd[1], events, sizeof(events));
+	ck_assert_int_eq(rc, sizeof(events));
+	rc = libevdev_next_event(clone, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+	ck_assert_int_eq(rc, LIBEVDEV_READ_STATUS_SUCCESS);
+	assert_event(&ev, EV_KEY, BTN_LEFT, 0);
+	ck_assert_int_eq(libevdev_get_event_value(clone, EV_KEY, BTN_LEFT), 0);
+
+	/* the original is unaffected */
+	ck_assert_int_eq(libevdev_get_event_value(dev, EV_KEY, BTN_LEFT), 1);
+	rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+	ck_assert_int_eq(rc, LIBEVDEV_READ_STATUS_SUCCESS);
+	assert_event(&ev, EV_SYN, SYN_REPORT, 0);
+
+	close(pipefd[0]);
+	close(pipefd[1]);
+	libevdev_free(clone);
+	uinput_device_free(uidev);
+	libevdev_free(dev);
+}
+END_TEST
+
+struct monitor_record {
+	int added;
+	int removed;
+	char name[64];
+	char devnode[PATH_MAX];
+};
+
+static void
+monitor_func(struct libevdev_monitor *monitor,
+	     enum libevdev_monitor_event event,
+	     const char *devnode,
+	     struct libevdev *dev,
+	     void *data)
+{
+	struct monitor_record *record = data;
+
+	snprintf(record->devnode, sizeof(record->devnode), "%s", devnode);
+
+	if (event == LIBEVDEV_MONITOR_ADDED) {
+		ck_assert(dev != NULL);
+		record->added++;
+		snprintf(record->name, sizeof(record->name), "%s",
+			 libevdev_get_name(dev));
+		close(libevdev_get_fd(dev));
+		libevdev_free(dev);
+	} else {
+		ck_assert_int_eq(event, LIBEVDEV_MONITOR_REMOVED);
+		ck_assert(dev == NULL);
+		record->removed++;
+	}
+}
+
+START_TEST(test_monitor)
+{
+	struct uinput_device* uidev;
+	struct libevdev *dev;
+	struct libevdev_monitor *monitor;
+	struct monitor_record record = {0};
+	char dir[] = "/tmp/libevdev-test-XXXXXX";
+	char node1[PATH_MAX], node2[PATH_MAX], other[PATH_MAX];
+	int rc;
+
+	test_create_device(&uidev, &dev,
+			   EV_SYN, SYN_REPORT,
+			   EV_REL, REL_X,
+			   EV_REL, REL_Y,
+			   EV_KEY, BTN_LEFT,
+			   -1);
+
+	ck_assert(mkdtemp(dir) != NULL);
+	snprintf(node1, sizeof(node1), "%s/event1", dir);
+	snprintf(node2, sizeof(node2), "%s/event2", dir);
+	snprintf(other, sizeof(other), "%s/mouse1", dir);
+
+	/* existing nodes are only reported by enumerate */
+	rc = symlink(uinput_device_get_devnode(uidev), node1);
+	ck_assert_int_eq(rc, 0);
+	rc = symlink(uinput_device_get_devnode(uidev), other);
+	ck_assert_int_eq(rc, 0);
+
+	rc = libevdev_monitor_new(dir, O_RDONLY|O_NONBLOCK, 0,
+				  monitor_func, &record, &monitor);
+	ck_assert_int_eq(rc, 0);
+	ck_assert_int_ge(libevdev_monitor_get_fd(monitor), 0);
+	ck_assert_int_eq(libevdev_monitor_dispatch(monitor), -EAGAIN);
+
+	rc = libevdev_monitor_enumerate(monitor);
+	ck_assert_int_eq(rc, 1);
+	ck_assert_int_eq(record.added, 1);
+	ck_assert_str_eq(record.devnode, node1);
+	ck_assert_str_eq(record.name, libevdev_get_name(dev));
+
+	/* already known */
+	rc = libevdev_monitor_enumerate(monitor);
+	ck_assert_int_eq(rc, 0);
+
+	rc = symlink(uinput_device_get_devnode(uidev), node2);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_monitor_dispatch(monitor);
+	ck_assert_int_eq(rc, 1);
+	ck_assert_int_eq(record.added, 2);
+	ck_assert_str_eq(record.devnode, node2);
+
+	unlink(node1);
+	unlink(other);
+	rc = libevdev_monitor_dispatch(monitor);
+	ck_assert_int_eq(rc, 1);
+	ck_assert_int_eq(record.removed, 1);
+	ck_assert_str_eq(record.devnode, node1);
+	ck_assert_int_eq(libevdev_monitor_dispatch(monitor), -EAGAIN);
+
+	libevdev_monitor_free(monitor);
+
+	unlink(node2);
+	rmdir(dir);
+	uinput_device_free(uidev);
+	libevdev_free(dev);
+}
+END_TEST
+
+START_TEST(test_monitor_invalid_node)
+{
+	struct libevdev_monitor *monitor;
+	struct monitor_record record = {0};
+	char dir[] = "/tmp/libevdev-test-XXXXXX";
+	char path[PATH_MAX];
+	int fd;
+	int rc;
+
+	ck_assert(mkdtemp(dir) != NULL);
+
+	libevdev_set_log_function(test_logfunc_ignore_error, NULL);
+
+	rc = libevdev_monitor_new(dir, O_RDONLY|O_NONBLOCK, 0,
+				  monitor_func, &record, &monitor);
+	ck_assert_int_eq(rc, 0);
+
+	/* not an evdev device, never reported */
+	snprintf(path, sizeof(path), "%s/event0", dir);
+	fd = open(path, O_CREAT|O_WRONLY, 0600);
+	ck_assert_int_ge(fd, 0);
+	close(fd);
+
+	rc = libevdev_monitor_dispatch(monitor);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_monitor_enumerate(monitor);
+	ck_assert_int_eq(rc, 0);
+
+	unlink(path);
+	rc = libevdev_monitor_dispatch(monitor);
+	ck_assert_int_eq(rc, 0);
+	ck_assert_int_eq(record.added, 0);
+	ck_assert_int_eq(record.removed, 0);
+
+	libevdev_monitor_free(monitor);
+	rmdir(dir);
+
+	rc = libevdev_monitor_new(dir, O_RDONLY, 0, monitor_func, NULL, &monitor);
+	ck_assert_int_eq(rc, -ENOENT);
+
+	rc = libevdev_monitor_new(NULL, O_RDONLY, 0, NULL, NULL, &monitor);
+	ck_assert_int_eq(rc, -EINVAL);
+	libevdev_set_log_function(test_logfunc_abort_on_error, NULL);
+}
+END_TEST
+
 TEST_SUITE_ROOT_PRIVILEGES(libevdev_init_test)
 {
 	Suite *s = suite_create("libevdev init tests");
@@ -691,6 +1087,14 @@ TEST_SUITE_ROOT_PRIVILEGES(libevdev_init_test)
 
 	add_test(s, test_device_init);
 	add_test(s, test_device_init_from_fd);
+	add_test(s, test_device_init_lazy);
+	add_test(s, test_device_init_lazy_modify);
+	add_test(s, test_device_init_lazy_fetch_error);
+	add_test(s, test_device_init_lazy_realtime);
+	add_test(s, test_device_clone);
+
+	add_test(s, test_monitor);
+	add_test(s, test_monitor_invalid_node);
 
 	add_test(s, test_device_grab);
 	add_test(s, test_device_grab_invalid_fd);
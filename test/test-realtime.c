@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+#include "config.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <libevdev/libevdev-util.h>
+
+#include "test-common.h"
+
+/* The allocator and the log handler are interposed for the whole test
+ * binary, so this file must not be linked into any of the other test
+ * binaries. Only calls made while 'armed' is set are counted.
+ *
+ * The allocator hooks need glibc's __libc_* functions, the test is only
+ * built with glibc.
+ */
+static bool armed;
+static int nallocs;
+static int nlog_messages;
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+void *
+malloc(size_t size)
+{
+	if (armed)
+		nallocs++;
+	return __libc_malloc(size);
+}
+
+void *
+calloc(size_t nmemb, size_t size)
+{
+	if (armed)
+		nallocs++;
+	return __libc_calloc(nmemb, size);
+}
+
+void *
+realloc(void *ptr, size_t size)
+{
+	if (armed)
+		nallocs++;
+	return __libc_realloc(ptr, size);
+}
+
+static void
+logfunc_count(enum libevdev_log_priority priority,
+	      void *data,
+	      const char *file, int line,
+	      const char *func,
+	      const char *format, va_list args)
+{
+	nlog_messages++;
+}
+
+static int
+next_event_armed(struct libevdev *dev, unsigned int flags, struct input_event *ev)
+{
+	int rc;
+
+	armed = true;
+	rc = libevdev_next_event(dev, flags, ev);
+	armed = false;
+
+	return rc;
+}
+
+static void
+drain_armed(struct libevdev *dev)
+{
+	struct input_event ev;
+	int rc;
+
+	do {
+		rc = next_event_armed(dev, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+		while (rc == LIBEVDEV_READ_STATUS_SYNC)
+			rc = next_event_armed(dev, LIBEVDEV_READ_FLAG_SYNC, &ev);
+	} while (rc != -EAGAIN);
+}
+
+START_TEST(test_realtime_read_path)
+{
+	struct uinput_device* uidev;
+	struct libevdev *dev;
+	struct input_event ev;
+	int rc;
+	int pipefd[2];
+	struct input_absinfo abs[6] = {
+		{ .value = ABS_X, .maximum = 1000 },
+		{ .value = ABS_Y, .maximum = 1000 },
+		{ .value = ABS_MT_POSITION_X, .maximum = 1000 },
+		{ .value = ABS_MT_POSITION_Y, .maximum = 1000 },
+		{ .value = ABS_MT_SLOT, .maximum = 1 },
+		{ .value = ABS_MT_TRACKING_ID, .minimum = -1, .maximum = 500 },
+	};
+	struct input_event events[] = {
+		/* invalid slot index */
+		{ .type = EV_ABS, .code = ABS_MT_SLOT, .value = 5 },
+		{ .type = EV_SYN, .code = SYN_REPORT, .value = 0 },
+		/* double tracking ID */
+		{ .type = EV_ABS, .code = ABS_MT_TRACKING_ID, .value = 2 },
+		{ .type = EV_SYN, .code = SYN_REPORT, .value = 0 },
+	};
+
+	test_create_abs_device(&uidev, &dev,
+			       ARRAY_LENGTH(abs), abs,
+			       EV_KEY, BTN_LEFT,
+			       EV_SYN, SYN_REPORT,
+			       -1);
+
+	rc = libevdev_set_realtime_mode(dev, LIBEVDEV_REALTIME_ON);
+	ck_assert_int_eq(rc, 0);
+	libevdev_set_log_function(logfunc_count, NULL);
+
+	uinput_device_event(uidev, EV_ABS, ABS_MT_SLOT, 1);
+	uinput_device_event(uidev, EV_ABS, ABS_MT_TRACKING_ID, 1);
+	uinput_device_event(uidev, EV_KEY, BTN_LEFT, 1);
+	uinput_device_event(uidev, EV_SYN, SYN_REPORT, 0);
+	drain_armed(dev);
+
+	/* the sync path */
+	uinput_device_event(uidev, EV_KEY, BTN_LEFT, 0);
+	uinput_device_event(uidev, EV_SYN, SYN_REPORT, 0);
+	rc = next_event_armed(dev, LIBEVDEV_READ_FLAG_FORCE_SYNC, &ev);
+	ck_assert_int_eq(rc, LIBEVDEV_READ_STATUS_SYNC);
+	drain_armed(dev);
+
+	ck_assert_int_eq(nlog_messages, 0);
+
+	/* invalid events need the pipe, the kernel filters them otherwise */
+	rc = pipe2(pipefd, O_NONBLOCK);
+	ck_assert_int_eq(rc, 0);
+	libevdev_change_fd(dev, pipefd[0]);
+	rc = write(pipefd[1], events, sizeof(events));
+	ck_assert_int_eq(rc, sizeof(events));
+	drain_armed(dev);
+
+	ck_assert_int_eq(nlog_messages, 0);
+	ck_assert_int_eq(nallocs, 0);
+
+	rc = libevdev_dispatch_deferred_log(dev);
+	ck_assert_int_eq(rc, 2);
+	ck_assert_int_eq(nlog_messages, 2);
+
+	rc = libevdev_dispatch_deferred_log(dev);
+	ck_assert_int_eq(rc, 0);
+
+	libevdev_set_log_function(test_logfunc_abort_on_error, NULL);
+
+	close(pipefd[0]);
+	close(pipefd[1]);
+	uinput_device_free(uidev);
+	libevdev_free(dev);
+}
+END_TEST
+
+START_TEST(test_realtime_log_overflow)
+{
+	struct libevdev *dev;
+	int rc;
+
+	dev = libevdev_new();
+	libevdev_set_realtime_mode(dev, LIBEVDEV_REALTIME_ON);
+	libevdev_set_log_function(logfunc_count, NULL);
+
+	/* each of these logs a bug, more than fit into the ring */
+	for (int i = 0; i < 100; i++)
+		libevdev_change_fd(dev, 0);
+
+	ck_assert_int_eq(nlog_messages, 0);
+
+	rc = libevdev_dispatch_deferred_log(dev);
+	ck_assert_int_gt(rc, 0);
+	ck_assert_int_lt(rc, 100);
+	/* plus one for the dropped messages */
+	ck_assert_int_eq(nlog_messages, rc + 1);
+
+	nlog_messages = 0;
+	libevdev_change_fd(dev, 0);
+	ck_assert_int_eq(nlog_messages, 0);
+	libevdev_set_realtime_mode(dev, LIBEVDEV_REALTIME_OFF);
+	ck_assert_int_eq(nlog_messages, 1);
+
+	libevdev_change_fd(dev, 0);
+	ck_assert_int_eq(nlog_messages, 2);
+
+	libevdev_set_log_function(test_logfunc_abort_on_error, NULL);
+	libevdev_free(dev);
+}
+END_TEST
+
+START_TEST(test_realtime_log_survives_reset)
+{
+	struct libevdev *dev;
+	int fd;
+	int rc;
+
+	fd = open("/dev/null", O_RDONLY);
+	ck_assert_int_ge(fd, 0);
+
+	dev = libevdev_new();
+	libevdev_set_realtime_mode(dev, LIBEVDEV_REALTIME_ON);
+	libevdev_set_log_function(logfunc_count, NULL);
+	nlog_messages = 0;
+
+	libevdev_change_fd(dev, 0);
+	ck_assert_int_eq(nlog_messages, 0);
+
+	/* not an evdev node, the failed set_fd resets the device */
+	rc = libevdev_set_fd(dev, fd);
+	ck_assert_int_lt(rc, 0);
+	ck_assert_int_eq(nlog_messages, 0);
+
+	rc = libevdev_dispatch_deferred_log(dev);
+	ck_assert_int_eq(rc, 1);
+	ck_assert_int_eq(nlog_messages, 1);
+
+	libevdev_set_log_function(test_logfunc_abort_on_error, NULL);
+	libevdev_free(dev);
+	close(fd);
+}
+END_TEST
+
+TEST_SUITE_ROOT_PRIVILEGES(realtime)
+{
+	Suite *s = suite_create("libevdev realtime mode tests");
+
+	add_test(s, test_realtime_read_path);
+	add_test(s, test_realtime_log_overflow);
+	add_test(s, test_realtime_log_survives_reset);
+
+	return s;
+}
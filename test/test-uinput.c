@@ -5,11 +5,21 @@
 
 #include "config.h"
 #include <linux/input.h>
+#include <linux/uinput.h>
 #include <errno.h>
 #include <unistd.h>
 #include <stdlib.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <time.h>
 #include <libevdev/libevdev-uinput.h>
+#include <libevdev/libevdev-util.h>
 
 #include "test-common.h"
 #define UINPUT_NODE "/dev/uinput"
@@ -234,12 +244,45 @@ END_TEST
 
 #else /* !__FreeBSD__ */
 
-START_TEST(test_uinput_check_syspath_time)
+/* Older kernels don't have UI_GET_SYSNAME and libevdev finds the device
+ * in sysfs by a unique phys instead. The ioctl is interposed for the whole
+ * binary to take that path on any kernel, UI_GET_SYSNAME only fails while
+ * 'force_phys_lookup' is set.
+ *
+ * The hook matches glibc's prototype of ioctl(), other libcs differ.
+ */
+#if defined(__GLIBC__) && !defined(__USE_TIME_BITS64)
+#define HAVE_IOCTL_HOOK 1
+static bool force_phys_lookup;
+
+int
+ioctl(int fd, unsigned long request, ...)
+{
+	va_list args;
+	void *arg;
+
+	va_start(args, request);
+	arg = va_arg(args, void *);
+	va_end(args);
+
+	if (force_phys_lookup &&
+	    _IOC_TYPE(request) == UINPUT_IOCTL_BASE &&
+	    _IOC_NR(request) == _IOC_NR(UI_GET_SYSNAME(0))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	return syscall(SYS_ioctl, fd, request, arg);
+}
+#endif
+
+static void
+check_syspath_unique(const char *phys_prefix)
 {
 	struct libevdev *dev;
-	struct libevdev_uinput *uidev, *uidev2;
+	struct libevdev_uinput *uidev[8];
 	const char *syspath, *syspath2;
-	int fd, fd2;
+	size_t i, j;
 	int rc;
 
 	dev = libevdev_new();
@@ -250,45 +293,65 @@ START_TEST(test_uinput_check_syspath_time)
 	libevdev_enable_event_code(dev, EV_REL, REL_X, NULL);
 	libevdev_enable_event_code(dev, EV_REL, REL_Y, NULL);
 
-	fd = open(UINPUT_NODE, O_RDWR);
-	ck_assert_int_gt(fd, -1);
-	fd2 = open(UINPUT_NODE, O_RDWR);
-	ck_assert_int_gt(fd2, -1);
-
-	rc = libevdev_uinput_create_from_device(dev, fd, &uidev);
-	ck_assert_int_eq(rc, 0);
-
-	/* sleep for 1.5 seconds. sysfs resolution is 1 second, so
-	   creating both devices without delay means
-	   libevdev_uinput_get_syspath can't actually differ between
-	   them. By waiting, we get different ctime for uidev and uidev2,
-	   and exercise that part of the code.
-	 */
-	usleep(1500000);
-
-	/* create a second one to test the syspath time filtering code */
-	rc = libevdev_uinput_create_from_device(dev, fd2, &uidev2);
-	ck_assert_int_eq(rc, 0);
+	/* identically named devices created back to back */
+	for (i = 0; i < ARRAY_LENGTH(uidev); i++) {
+		rc = libevdev_uinput_create_from_device(dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &uidev[i]);
+		ck_assert_int_eq(rc, 0);
+	}
 
-	syspath = libevdev_uinput_get_syspath(uidev);
+	syspath = libevdev_uinput_get_syspath(uidev[0]);
 	ck_assert(syspath != NULL);
 
 	/* get syspath twice returns same pointer */
-	syspath2 = libevdev_uinput_get_syspath(uidev);
+	syspath2 = libevdev_uinput_get_syspath(uidev[0]);
 	ck_assert(syspath == syspath2);
 
-	/* second dev has different syspath */
-	syspath2 = libevdev_uinput_get_syspath(uidev2);
-	ck_assert(strcmp(syspath, syspath2) != 0);
+	/* all devices have different syspaths and devnodes */
+	for (i = 0; i < ARRAY_LENGTH(uidev); i++) {
+		for (j = i + 1; j < ARRAY_LENGTH(uidev); j++) {
+			ck_assert(strcmp(libevdev_uinput_get_syspath(uidev[i]),
+					 libevdev_uinput_get_syspath(uidev[j])) != 0);
+			ck_assert(strcmp(libevdev_uinput_get_devnode(uidev[i]),
+					 libevdev_uinput_get_devnode(uidev[j])) != 0);
+		}
+	}
+
+	if (phys_prefix) {
+		for (i = 0; i < ARRAY_LENGTH(uidev); i++) {
+			struct libevdev *d;
+			int fd;
+
+			fd = open(libevdev_uinput_get_devnode(uidev[i]), O_RDONLY);
+			ck_assert_int_gt(fd, -1);
+			rc = libevdev_new_from_fd(fd, &d);
+			ck_assert_int_eq(rc, 0);
+			ck_assert(strncmp(libevdev_get_phys(d), phys_prefix,
+					  strlen(phys_prefix)) == 0);
+			libevdev_free(d);
+			close(fd);
+		}
+	}
 
 	libevdev_free(dev);
-	libevdev_uinput_destroy(uidev);
-	libevdev_uinput_destroy(uidev2);
+	for (i = 0; i < ARRAY_LENGTH(uidev); i++)
+		libevdev_uinput_destroy(uidev[i]);
+}
 
-	close(fd);
-	close(fd2);
+START_TEST(test_uinput_check_syspath_time)
+{
+	check_syspath_unique(NULL);
+}
+END_TEST
+
+#ifdef HAVE_IOCTL_HOOK
+START_TEST(test_uinput_check_syspath_phys)
+{
+	force_phys_lookup = true;
+	check_syspath_unique("libevdev-uinput/");
+	force_phys_lookup = false;
 }
 END_TEST
+#endif
 
 START_TEST(test_uinput_check_syspath_name)
 {
@@ -341,6 +404,41 @@ END_TEST
 
 #endif /* __FreeBSD __ */
 
+START_TEST(test_uinput_wait_devnode)
+{
+	struct libevdev *dev, *dev2;
+	struct libevdev_uinput *uidev;
+	int fd;
+	int rc;
+
+	dev = libevdev_new();
+	ck_assert(dev != NULL);
+	libevdev_set_name(dev, TEST_DEVICE_NAME);
+	libevdev_enable_event_code(dev, EV_REL, REL_X, NULL);
+
+	rc = libevdev_uinput_create_from_device(dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &uidev);
+	ck_assert_int_eq(rc, 0);
+
+	rc = libevdev_uinput_wait_devnode(uidev, 5000);
+	ck_assert_int_eq(rc, 0);
+
+	fd = open(libevdev_uinput_get_devnode(uidev), O_RDONLY);
+	ck_assert_int_gt(fd, -1);
+	rc = libevdev_new_from_fd(fd, &dev2);
+	ck_assert_int_eq(rc, 0);
+	ck_assert_str_eq(libevdev_get_name(dev2), TEST_DEVICE_NAME);
+
+	/* already there, doesn't wait */
+	rc = libevdev_uinput_wait_devnode(uidev, 0);
+	ck_assert_int_eq(rc, 0);
+
+	libevdev_free(dev);
+	libevdev_free(dev2);
+	libevdev_uinput_destroy(uidev);
+	close(fd);
+}
+END_TEST
+
 START_TEST(test_uinput_events)
 {
 	struct libevdev *dev;
@@ -398,6 +496,562 @@ START_TEST(test_uinput_events)
 }
 END_TEST
 
+START_TEST(test_uinput_events_batch)
+{
+	struct libevdev *dev;
+	struct libevdev_uinput *uidev;
+	int fd, fd2;
+	int rc;
+	const char *devnode;
+	int i;
+	const int nevents = 5;
+	struct input_event events[] = { {{0, 0}, EV_REL, REL_X, 1},
+					{{0, 0}, EV_REL, REL_Y, -1},
+					{{0, 0}, EV_SYN, SYN_REPORT, 0},
+					{{0, 0}, EV_KEY, BTN_LEFT, 1},
+					{{0, 0}, EV_SYN, SYN_REPORT, 0}};
+	struct input_event invalid[] = { {{0, 0}, EV_REL, REL_X, 1},
+					 {{0, 0}, EV_REL, REL_MAX + 1, 1},
+					 {{0, 0}, EV_SYN, SYN_REPORT, 0}};
+	struct input_event events_read[nevents];
+
+	dev = libevdev_new();
+	ck_assert(dev != NULL);
+	libevdev_set_name(dev, TEST_DEVICE_NAME);
+	libevdev_enable_event_type(dev, EV_SYN);
+	libevdev_enable_event_type(dev, EV_REL);
+	libevdev_enable_event_type(dev, EV_KEY);
+	libevdev_enable_event_code(dev, EV_REL, REL_X, NULL);
+	libevdev_enable_event_code(dev, EV_REL, REL_Y, NULL);
+	libevdev_enable_event_code(dev, EV_KEY, BTN_LEFT, NULL);
+
+	fd = open(UINPUT_NODE, O_RDWR);
+	ck_assert_int_gt(fd, -1);
+
+	rc = libevdev_uinput_create_from_device(dev, fd, &uidev);
+	ck_assert_int_eq(rc, 0);
+	ck_assert(uidev != NULL);
+
+	devnode = libevdev_uinput_get_devnode(uidev);
+	ck_assert(devnode != NULL);
+
+	fd2 = open(devnode, O_RDONLY|O_NONBLOCK);
+	ck_assert_int_gt(fd2, -1);
+
+	/* nothing is written if one event is invalid */
+	rc = libevdev_uinput_write_events(uidev, invalid, ARRAY_LENGTH(invalid));
+	ck_assert_int_eq(rc, -EINVAL);
+	rc = read(fd2, events_read, sizeof(events_read));
+	ck_assert_int_eq(rc, -1);
+	ck_assert_int_eq(errno, EAGAIN);
+
+	rc = libevdev_uinput_write_events(uidev, events, nevents);
+	ck_assert_int_eq(rc, 0);
+
+	rc = read(fd2, events_read, sizeof(events_read));
+	ck_assert_int_eq(rc, sizeof(events_read));
+
+	for (i = 0; i < nevents; i++) {
+		ck_assert_int_eq(events[i].type, events_read[i].type);
+		ck_assert_int_eq(events[i].code, events_read[i].code);
+		ck_assert_int_eq(events[i].value, events_read[i].value);
+	}
+
+	libevdev_free(dev);
+	libevdev_uinput_destroy(uidev);
+	close(fd);
+	close(fd2);
+}
+END_TEST
+
+START_TEST(test_uinput_frame)
+{
+	struct libevdev *dev;
+	struct libevdev_uinput *uidev;
+	struct input_absinfo abs = { .minimum = 0, .maximum = 100 };
+	struct input_absinfo slots = { .minimum = 0, .maximum = 1 };
+	struct input_absinfo tracking_id = { .minimum = -1, .maximum = 0xffff };
+	int fd;
+	int rc;
+	const char *devnode;
+	struct input_event events_read[16];
+	struct input_event frame1[] = { {{0, 0}, EV_KEY, BTN_LEFT, 1},
+					{{0, 0}, EV_REL, REL_X, 2},
+					{{0, 0}, EV_ABS, ABS_X, 10},
+					{{0, 0}, EV_SYN, SYN_REPORT, 0}};
+	struct input_event frame2[] = { {{0, 0}, EV_ABS, ABS_MT_TRACKING_ID, 5},
+					{{0, 0}, EV_ABS, ABS_MT_SLOT, 1},
+					{{0, 0}, EV_ABS, ABS_MT_TRACKING_ID, 6},
+					{{0, 0}, EV_SYN, SYN_REPORT, 0}};
+	size_t i;
+
+	dev = libevdev_new();
+	ck_assert(dev != NULL);
+	libevdev_set_name(dev, TEST_DEVICE_NAME);
+	libevdev_enable_event_code(dev, EV_REL, REL_X, NULL);
+	libevdev_enable_event_code(dev, EV_KEY, BTN_LEFT, NULL);
+	libevdev_enable_event_code(dev, EV_ABS, ABS_X, &abs);
+	libevdev_enable_event_code(dev, EV_ABS, ABS_MT_SLOT, &slots);
+	libevdev_enable_event_code(dev, EV_ABS, ABS_MT_POSITION_X, &abs);
+	libevdev_enable_event_code(dev, EV_ABS, ABS_MT_TRACKING_ID, &tracking_id);
+
+	rc = libevdev_uinput_create_from_device(dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &uidev);
+	ck_assert_int_eq(rc, 0);
+
+	devnode = libevdev_uinput_get_devnode(uidev);
+	ck_assert(devnode != NULL);
+
+	fd = open(devnode, O_RDONLY|O_NONBLOCK);
+	ck_assert_int_gt(fd, -1);
+
+	ck_assert_int_eq(libevdev_uinput_frame_add(uidev, EV_REL, REL_MAX + 1, 1), -EINVAL);
+	ck_assert_int_eq(libevdev_uinput_frame_add(uidev, EV_MAX + 1, 0, 1), -EINVAL);
+
+	/* zero relative motion and SYN_REPORT are dropped */
+	libevdev_uinput_frame_begin(uidev);
+	libevdev_uinput_frame_add(uidev, EV_KEY, BTN_LEFT, 1);
+	libevdev_uinput_frame_add(uidev, EV_REL, REL_X, 0);
+	libevdev_uinput_frame_add(uidev, EV_REL, REL_X, 2);
+	libevdev_uinput_frame_add(uidev, EV_SYN, SYN_REPORT, 0);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_X, 10);
+	rc = libevdev_uinput_frame_commit(uidev);
+	ck_assert_int_eq(rc, 0);
+
+	rc = read(fd, events_read, sizeof(events_read));
+	ck_assert_int_eq(rc, sizeof(frame1));
+	for (i = 0; i < ARRAY_LENGTH(frame1); i++) {
+		ck_assert_int_eq(events_read[i].type, frame1[i].type);
+		ck_assert_int_eq(events_read[i].code, frame1[i].code);
+		ck_assert_int_eq(events_read[i].value, frame1[i].value);
+	}
+
+	/* unchanged values, nothing to write */
+	libevdev_uinput_frame_begin(uidev);
+	libevdev_uinput_frame_add(uidev, EV_KEY, BTN_LEFT, 1);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_X, 10);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_SLOT, 0);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_TRACKING_ID, -1);
+	rc = libevdev_uinput_frame_commit(uidev);
+	ck_assert_int_eq(rc, 0);
+
+	/* discarded by frame_begin */
+	libevdev_uinput_frame_add(uidev, EV_KEY, BTN_LEFT, 0);
+	libevdev_uinput_frame_begin(uidev);
+	rc = libevdev_uinput_frame_commit(uidev);
+	ck_assert_int_eq(rc, 0);
+
+	rc = read(fd, events_read, sizeof(events_read));
+	ck_assert_int_eq(rc, -1);
+	ck_assert_int_eq(errno, EAGAIN);
+
+	/* slot switches only for changed slot values */
+	libevdev_uinput_frame_begin(uidev);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_SLOT, 0);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_TRACKING_ID, 5);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_POSITION_X, 0);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_SLOT, 1);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_POSITION_X, 0);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_SLOT, 1);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_TRACKING_ID, 6);
+	rc = libevdev_uinput_frame_commit(uidev);
+	ck_assert_int_eq(rc, 0);
+
+	rc = read(fd, events_read, sizeof(events_read));
+	ck_assert_int_eq(rc, sizeof(frame2));
+	for (i = 0; i < ARRAY_LENGTH(frame2); i++) {
+		ck_assert_int_eq(events_read[i].type, frame2[i].type);
+		ck_assert_int_eq(events_read[i].code, frame2[i].code);
+		ck_assert_int_eq(events_read[i].value, frame2[i].value);
+	}
+
+	libevdev_free(dev);
+	libevdev_uinput_destroy(uidev);
+	close(fd);
+}
+END_TEST
+
+START_TEST(test_uinput_frame_timed)
+{
+	struct libevdev *dev;
+	struct libevdev_uinput *uidev;
+	struct input_event frame1[] = { {{10, 100}, EV_REL, REL_X, 1},
+					{{10, 100}, EV_SYN, SYN_REPORT, 0}};
+	struct input_event frame2[] = { {{10, 600}, EV_REL, REL_X, 2}};
+	struct input_event frame3[] = { {{10, 900}, EV_REL, REL_X, 3}};
+	struct input_event two_frames[] = { {{10, 600}, EV_REL, REL_X, 2},
+					    {{10, 600}, EV_SYN, SYN_REPORT, 0},
+					    {{10, 700}, EV_REL, REL_X, 2}};
+	struct input_event events_read[8];
+	struct timeval t1, t2;
+	struct timespec now;
+	int fd;
+	int rc;
+
+	dev = libevdev_new();
+	ck_assert(dev != NULL);
+	libevdev_set_name(dev, TEST_DEVICE_NAME);
+	libevdev_enable_event_code(dev, EV_REL, REL_X, NULL);
+	libevdev_enable_event_code(dev, EV_MSC, MSC_TIMESTAMP, NULL);
+
+	rc = libevdev_uinput_create_from_device(dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &uidev);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_uinput_wait_devnode(uidev, 5000);
+	ck_assert_int_eq(rc, 0);
+
+	fd = open(libevdev_uinput_get_devnode(uidev), O_RDONLY|O_NONBLOCK);
+	ck_assert_int_gt(fd, -1);
+
+	rc = libevdev_uinput_write_frame_timed(uidev, two_frames,
+					       ARRAY_LENGTH(two_frames), NULL);
+	ck_assert_int_eq(rc, -EINVAL);
+
+	rc = libevdev_uinput_write_frame_timed(uidev, frame1, ARRAY_LENGTH(frame1), &t1);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_uinput_write_frame_timed(uidev, frame2, ARRAY_LENGTH(frame2), &t2);
+	ck_assert_int_eq(rc, 0);
+
+	/* kernel timestamps are CLOCK_MONOTONIC */
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	ck_assert(t1.tv_sec > 0 || t1.tv_usec > 0);
+	ck_assert(t2.tv_sec > t1.tv_sec ||
+		  (t2.tv_sec == t1.tv_sec && t2.tv_usec >= t1.tv_usec));
+	ck_assert_int_le(t2.tv_sec, now.tv_sec);
+
+	rc = read(fd, events_read, sizeof(events_read));
+	ck_assert_int_eq(rc, 6 * sizeof(struct input_event));
+	ck_assert_int_eq(events_read[0].type, EV_REL);
+	ck_assert_int_eq(events_read[1].type, EV_MSC);
+	ck_assert_int_eq(events_read[1].code, MSC_TIMESTAMP);
+	ck_assert_int_eq(events_read[1].value, 0);
+	ck_assert_int_eq(events_read[2].type, EV_SYN);
+	ck_assert_int_eq(events_read[3].type, EV_REL);
+	ck_assert_int_eq(events_read[4].type, EV_MSC);
+	ck_assert_int_eq(events_read[4].code, MSC_TIMESTAMP);
+	ck_assert_int_eq(events_read[4].value, 500);
+	ck_assert_int_eq(events_read[5].type, EV_SYN);
+
+	/* with the device grabbed, the frame is still posted, only the
+	 * kernel time is unknown */
+	rc = ioctl(fd, EVIOCGRAB, (void*)1);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_uinput_write_frame_timed(uidev, frame3, ARRAY_LENGTH(frame3), &t1);
+	ck_assert_int_eq(rc, 0);
+	ck_assert_int_eq(t1.tv_sec, 0);
+	ck_assert_int_eq(t1.tv_usec, 0);
+
+	rc = read(fd, events_read, sizeof(events_read));
+	ck_assert_int_eq(rc, 3 * sizeof(struct input_event));
+	ck_assert_int_eq(events_read[0].type, EV_REL);
+	ck_assert_int_eq(events_read[1].code, MSC_TIMESTAMP);
+	ck_assert_int_eq(events_read[1].value, 800);
+
+	libevdev_uinput_destroy(uidev);
+	close(fd);
+
+	/* without MSC_TIMESTAMP the recorded time can't be passed on */
+	libevdev_disable_event_code(dev, EV_MSC, MSC_TIMESTAMP);
+	rc = libevdev_uinput_create_from_device(dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &uidev);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_uinput_write_frame_timed(uidev, frame1, ARRAY_LENGTH(frame1), NULL);
+	ck_assert_int_eq(rc, -EOPNOTSUPP);
+
+	libevdev_free(dev);
+	libevdev_uinput_destroy(uidev);
+}
+END_TEST
+
+static int
+ff_handler(struct libevdev_uinput *uidev,
+	   enum libevdev_uinput_ff_request request,
+	   const struct ff_effect *effect,
+	   const struct ff_effect *old,
+	   void *data)
+{
+	int *uploads = data;
+
+	if (request == LIBEVDEV_UINPUT_FF_ERASE)
+		return 0;
+
+	/* accept the first upload, reject the second */
+	ck_assert_int_eq(effect->type, FF_RUMBLE);
+	return (*uploads)++ == 0 ? 0 : -EINVAL;
+}
+
+/* uploads and erases effects, exit status 0 on the expected results */
+static void
+ff_client(const char *devnode)
+{
+	struct ff_effect effect = {
+		.type = FF_RUMBLE,
+		.id = -1,
+		.u.rumble = { .strong_magnitude = 0x8000 },
+	};
+	struct input_event play = { .type = EV_FF, .value = 1 };
+	int fd;
+
+	fd = open(devnode, O_RDWR);
+	if (fd < 0)
+		_exit(1);
+
+	if (ioctl(fd, EVIOCSFF, &effect) != 0 || effect.id < 0)
+		_exit(2);
+
+	play.code = effect.id;
+	if (write(fd, &play, sizeof(play)) != sizeof(play))
+		_exit(3);
+
+	effect.id = -1;
+	if (ioctl(fd, EVIOCSFF, &effect) == 0 || errno != EINVAL)
+		_exit(4);
+
+	if (ioctl(fd, EVIOCRMFF, play.code) != 0)
+		_exit(5);
+
+	_exit(0);
+}
+
+START_TEST(test_uinput_ff)
+{
+	struct libevdev *dev;
+	struct libevdev_uinput *uidev;
+	struct input_event events[8];
+	struct pollfd fds;
+	int uploads = 0;
+	bool played = false;
+	int status;
+	int i;
+	pid_t pid;
+	int rc;
+
+	dev = libevdev_new();
+	ck_assert(dev != NULL);
+	libevdev_set_name(dev, TEST_DEVICE_NAME);
+	libevdev_enable_event_code(dev, EV_KEY, BTN_SOUTH, NULL);
+	libevdev_enable_event_code(dev, EV_FF, FF_RUMBLE, NULL);
+
+	rc = libevdev_uinput_create_from_device(dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &uidev);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_uinput_wait_devnode(uidev, 5000);
+	ck_assert_int_eq(rc, 0);
+
+	libevdev_uinput_set_ff_handler(uidev, ff_handler, &uploads);
+
+	rc = libevdev_uinput_dispatch(uidev, events, ARRAY_LENGTH(events));
+	ck_assert_int_eq(rc, -EAGAIN);
+
+	pid = fork();
+	ck_assert_int_ne(pid, -1);
+	if (pid == 0)
+		ff_client(libevdev_uinput_get_devnode(uidev));
+
+	fds.fd = libevdev_uinput_get_fd(uidev);
+	fds.events = POLLIN;
+
+	for (i = 0; i < 500 && waitpid(pid, &status, WNOHANG) == 0; i++) {
+		int j;
+
+		if (poll(&fds, 1, 10) <= 0)
+			continue;
+
+		rc = libevdev_uinput_dispatch(uidev, events, ARRAY_LENGTH(events));
+		if (rc == -EAGAIN)
+			continue;
+		ck_assert_int_ge(rc, 0);
+
+		for (j = 0; j < rc; j++) {
+			if (events[j].type == EV_FF && events[j].value == 1)
+				played = true;
+		}
+	}
+
+	ck_assert_int_lt(i, 500);
+	ck_assert(WIFEXITED(status));
+	ck_assert_int_eq(WEXITSTATUS(status), 0);
+	ck_assert_int_eq(uploads, 2);
+	ck_assert(played);
+
+	libevdev_free(dev);
+	libevdev_uinput_destroy(uidev);
+}
+END_TEST
+
+START_TEST(test_uinput_pool)
+{
+	struct libevdev *dev, *dev2;
+	struct libevdev_uinput_pool *pool;
+	struct libevdev_uinput *uidev, *uidev2, *uidev3;
+	struct input_absinfo abs = { .minimum = 0, .maximum = 100 };
+	struct input_absinfo slots = { .minimum = 0, .maximum = 1 };
+	struct input_absinfo tracking_id = { .minimum = -1, .maximum = 0xffff };
+	struct input_event ev;
+	int fd;
+	int rc;
+
+	dev = libevdev_new();
+	ck_assert(dev != NULL);
+	libevdev_set_name(dev, TEST_DEVICE_NAME);
+	libevdev_enable_event_code(dev, EV_KEY, BTN_LEFT, NULL);
+	libevdev_enable_event_code(dev, EV_ABS, ABS_MT_SLOT, &slots);
+	libevdev_enable_event_code(dev, EV_ABS, ABS_MT_POSITION_X, &abs);
+	libevdev_enable_event_code(dev, EV_ABS, ABS_MT_TRACKING_ID, &tracking_id);
+
+	rc = libevdev_uinput_pool_new(4, &pool);
+	ck_assert_int_eq(rc, 0);
+
+	rc = libevdev_uinput_pool_acquire(pool, dev, &uidev);
+	ck_assert_int_eq(rc, 0);
+
+	fd = open(libevdev_uinput_get_devnode(uidev), O_RDONLY|O_NONBLOCK);
+	ck_assert_int_gt(fd, -1);
+	rc = libevdev_new_from_fd(fd, &dev2);
+	ck_assert_int_eq(rc, 0);
+
+	/* a button and a touch left behind */
+	libevdev_uinput_frame_begin(uidev);
+	libevdev_uinput_frame_add(uidev, EV_KEY, BTN_LEFT, 1);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_SLOT, 1);
+	libevdev_uinput_frame_add(uidev, EV_ABS, ABS_MT_TRACKING_ID, 3);
+	rc = libevdev_uinput_frame_commit(uidev);
+	ck_assert_int_eq(rc, 0);
+
+	libevdev_uinput_pool_release(pool, uidev);
+
+	/* same capabilities, same device */
+	rc = libevdev_uinput_pool_acquire(pool, dev, &uidev2);
+	ck_assert_int_eq(rc, 0);
+	ck_assert(uidev2 == uidev);
+
+	do {
+		rc = libevdev_next_event(dev2, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+	} while (rc == LIBEVDEV_READ_STATUS_SUCCESS);
+	ck_assert_int_eq(rc, -EAGAIN);
+	ck_assert_int_eq(libevdev_get_event_value(dev2, EV_KEY, BTN_LEFT), 0);
+	ck_assert_int_eq(libevdev_get_slot_value(dev2, 1, ABS_MT_TRACKING_ID), -1);
+
+	/* different capabilities, different device */
+	libevdev_enable_event_code(dev, EV_KEY, BTN_RIGHT, NULL);
+	rc = libevdev_uinput_pool_acquire(pool, dev, &uidev3);
+	ck_assert_int_eq(rc, 0);
+	ck_assert(uidev3 != uidev2);
+
+	libevdev_uinput_pool_release(pool, uidev2);
+	libevdev_uinput_pool_release(pool, uidev3);
+	libevdev_uinput_pool_free(pool);
+
+	libevdev_free(dev);
+	libevdev_free(dev2);
+	close(fd);
+}
+END_TEST
+
+START_TEST(test_uinput_pool_order)
+{
+	struct libevdev *mouse, *keyboard;
+	struct libevdev_uinput_pool *pool;
+	struct libevdev_uinput *m1, *k, *m2, *m3, *uidev;
+	int rc;
+
+	mouse = libevdev_new();
+	ck_assert(mouse != NULL);
+	libevdev_set_name(mouse, TEST_DEVICE_NAME);
+	libevdev_enable_event_code(mouse, EV_KEY, BTN_LEFT, NULL);
+	libevdev_enable_event_code(mouse, EV_REL, REL_X, NULL);
+
+	keyboard = libevdev_new();
+	ck_assert(keyboard != NULL);
+	libevdev_set_name(keyboard, TEST_DEVICE_NAME);
+	libevdev_enable_event_code(keyboard, EV_KEY, KEY_A, NULL);
+
+	rc = libevdev_uinput_pool_new(4, &pool);
+	ck_assert_int_eq(rc, 0);
+
+	rc = libevdev_uinput_pool_acquire(pool, mouse, &m1);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_uinput_pool_acquire(pool, keyboard, &k);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_uinput_pool_acquire(pool, mouse, &m2);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_uinput_pool_acquire(pool, mouse, &m3);
+	ck_assert_int_eq(rc, 0);
+
+	libevdev_uinput_pool_release(pool, m1);
+	libevdev_uinput_pool_release(pool, k);
+	libevdev_uinput_pool_release(pool, m2);
+	libevdev_uinput_pool_release(pool, m3);
+
+	/* taking out an older entry keeps the most recently released
+	 * mouse preferred */
+	rc = libevdev_uinput_pool_acquire(pool, keyboard, &uidev);
+	ck_assert_int_eq(rc, 0);
+	ck_assert(uidev == k);
+	libevdev_uinput_pool_release(pool, uidev);
+
+	rc = libevdev_uinput_pool_acquire(pool, mouse, &uidev);
+	ck_assert_int_eq(rc, 0);
+	ck_assert(uidev == m3);
+	libevdev_uinput_pool_release(pool, uidev);
+
+	libevdev_uinput_pool_free(pool);
+	libevdev_free(mouse);
+	libevdev_free(keyboard);
+}
+END_TEST
+
+START_TEST(test_uinput_next_events)
+{
+	struct libevdev *dev;
+	struct libevdev_uinput *uidev;
+	struct input_event leds[] = { {{0, 0}, EV_LED, LED_CAPSL, 1},
+				      {{0, 0}, EV_LED, LED_NUML, 1},
+				      {{0, 0}, EV_SYN, SYN_REPORT, 0}};
+	struct input_event events[4];
+	int fd;
+	int rc;
+
+	dev = libevdev_new();
+	ck_assert(dev != NULL);
+	libevdev_set_name(dev, TEST_DEVICE_NAME);
+	libevdev_enable_event_code(dev, EV_KEY, KEY_A, NULL);
+	libevdev_enable_event_code(dev, EV_LED, LED_CAPSL, NULL);
+	libevdev_enable_event_code(dev, EV_LED, LED_NUML, NULL);
+
+	rc = libevdev_uinput_create_from_device(dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &uidev);
+	ck_assert_int_eq(rc, 0);
+	rc = libevdev_uinput_wait_devnode(uidev, 5000);
+	ck_assert_int_eq(rc, 0);
+
+	rc = libevdev_uinput_next_events(uidev, events, 0);
+	ck_assert_int_eq(rc, -EINVAL);
+	rc = libevdev_uinput_next_events(uidev, events, ARRAY_LENGTH(events));
+	ck_assert_int_eq(rc, -EAGAIN);
+
+	/* the consumer side */
+	fd = open(libevdev_uinput_get_devnode(uidev), O_RDWR);
+	ck_assert_int_gt(fd, -1);
+	rc = write(fd, leds, sizeof(leds));
+	ck_assert_int_eq(rc, sizeof(leds));
+
+	/* one at a time, the rest stays queued */
+	rc = libevdev_uinput_next_events(uidev, events, 1);
+	ck_assert_int_eq(rc, 1);
+	ck_assert_int_eq(events[0].type, EV_LED);
+	ck_assert_int_eq(events[0].code, LED_CAPSL);
+	ck_assert_int_eq(events[0].value, 1);
+
+	rc = libevdev_uinput_next_events(uidev, events, ARRAY_LENGTH(events));
+	ck_assert_int_eq(rc, 1);
+	ck_assert_int_eq(events[0].type, EV_LED);
+	ck_assert_int_eq(events[0].code, LED_NUML);
+
+	rc = libevdev_uinput_next_events(uidev, events, ARRAY_LENGTH(events));
+	ck_assert_int_eq(rc, -EAGAIN);
+
+	libevdev_free(dev);
+	libevdev_uinput_destroy(uidev);
+	close(fd);
+}
+END_TEST
+
 START_TEST(test_uinput_properties)
 {
 	struct libevdev *dev, *dev2;
@@ -452,10 +1106,21 @@ TEST_SUITE_ROOT_PRIVILEGES(uinput_suite)
 	add_test(s, test_uinput_check_syspath_bsd);
 #else
 	add_test(s, test_uinput_check_syspath_time);
+#ifdef HAVE_IOCTL_HOOK
+	add_test(s, test_uinput_check_syspath_phys);
+#endif
 	add_test(s, test_uinput_check_syspath_name);
 #endif
 
+	add_test(s, test_uinput_wait_devnode);
 	add_test(s, test_uinput_events);
+	add_test(s, test_uinput_events_batch);
+	add_test(s, test_uinput_frame);
+	add_test(s, test_uinput_frame_timed);
+	add_test(s, test_uinput_pool);
+	add_test(s, test_uinput_pool_order);
+	add_test(s, test_uinput_ff);
+	add_test(s, test_uinput_next_events);
 
 	add_test(s, test_uinput_properties);
 
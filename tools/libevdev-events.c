@@ -16,6 +16,8 @@
 
 #include "libevdev/libevdev.h"
 
+#define LONG_BITS (sizeof(long) * 8)
+
 static void
 print_abs_bits(struct libevdev *dev, int axis)
 {
@@ -40,9 +42,18 @@ print_abs_bits(struct libevdev *dev, int axis)
 static void
 print_code_bits(struct libevdev *dev, unsigned int type, unsigned int max)
 {
+	unsigned long bits[(KEY_MAX + LONG_BITS) / LONG_BITS];
 	unsigned int i;
+
+	if (libevdev_get_event_code_bits(dev, type, bits, sizeof(bits)/sizeof(bits[0])) < 0)
+		return;
+
 	for (i = 0; i <= max; i++) {
-		if (!libevdev_has_event_code(dev, type, i))
+		if (!bits[i / LONG_BITS]) { /* skip empty words */
+			i |= LONG_BITS - 1;
+			continue;
+		}
+		if (!(bits[i / LONG_BITS] & (1UL << (i % LONG_BITS))))
 			continue;
 
 		printf("    Event code %i (%s)\n", i, libevdev_event_code_get_name(type, i));
@@ -80,11 +91,13 @@ print_bits(struct libevdev *dev)
 static void
 print_props(struct libevdev *dev)
 {
+	unsigned long bits[(INPUT_PROP_MAX + LONG_BITS) / LONG_BITS];
 	unsigned int i;
 	printf("Properties:\n");
 
+	libevdev_get_property_bits(dev, bits, sizeof(bits)/sizeof(bits[0]));
 	for (i = 0; i <= INPUT_PROP_MAX; i++) {
-		if (libevdev_has_property(dev, i))
+		if (bits[i / LONG_BITS] & (1UL << (i % LONG_BITS)))
 			printf("  Property type %d (%s)\n", i,
 					libevdev_property_get_name(i));
 	}
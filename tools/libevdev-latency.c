@@ -0,0 +1,565 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <libgen.h>
+#include <limits.h>
+#include <linux/input.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "libevdev/libevdev.h"
+#include "libevdev/libevdev-uinput.h"
+
+/* the most events the batch mode reads before taking a timestamp */
+#define MAX_BATCH 256
+
+enum read_mode {
+	MODE_BLOCKING = 1 << 0,
+	MODE_POLL = 1 << 1,
+	MODE_BATCH = 1 << 2,
+};
+
+enum opts {
+	OPT_MODE = 1,
+	OPT_RATE,
+	OPT_DURATION,
+	OPT_HELP,
+};
+
+static const struct {
+	enum read_mode mode;
+	const char *name;
+} modes[] = {
+	{ MODE_BLOCKING, "blocking" },
+	{ MODE_POLL, "poll" },
+	{ MODE_BATCH, "batch" },
+};
+
+/* the event types in each frame, in the order they are reported */
+static const unsigned int types[] = { EV_REL, EV_ABS, EV_KEY, EV_SYN };
+#define NTYPES (sizeof(types) / sizeof(types[0]))
+
+struct samples {
+	uint64_t *ns;
+	size_t count;
+	size_t size;
+};
+
+struct run {
+	struct samples samples[NTYPES];
+	unsigned long dropped;
+};
+
+static void
+usage(const char *progname)
+{
+	printf("Usage: %s [--mode blocking|poll|batch] [--rate hz] [--duration s]\n"
+	       "\n"
+	       "Creates a uinput device, reads it back through its device node and\n"
+	       "prints the latency from the write() to libevdev_next_event()\n"
+	       "returning the event, per event type and read mode.\n"
+	       "\n"
+	       "--mode ...	The read mode, may be given more than once.\n"
+	       "		Default: all of them, one after the other.\n"
+	       "		blocking: a blocking fd and LIBEVDEV_READ_FLAG_BLOCKING\n"
+	       "		poll: poll(), then read each event as it is returned\n"
+	       "		batch: poll(), then read all pending events before\n"
+	       "		       handling them\n"
+	       "--rate hz	The frames per second written. Default: 1000\n"
+	       "--duration s	The seconds each mode is measured for. Default: 2\n"
+	       "\n"
+	       "The latency is measured against the kernel's timestamp of each event,\n"
+	       "which is taken while the event is written.\n",
+	       progname);
+}
+
+static inline bool
+safe_atoi(const char *str, int *val)
+{
+	char *endptr;
+	long v;
+
+	v = strtol(str, &endptr, 10);
+	if (str == endptr)
+		return false;
+	if (*str != '\0' && *endptr != '\0')
+		return false;
+
+	if (v > INT_MAX || v < INT_MIN)
+		return false;
+
+	*val = v;
+	return true;
+}
+
+static inline uint64_t
+now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static inline uint64_t
+event_ns(const struct input_event *ev)
+{
+	return (uint64_t)ev->input_event_sec * 1000000000 +
+	       (uint64_t)ev->input_event_usec * 1000;
+}
+
+static int
+type_index(unsigned int type)
+{
+	size_t i;
+
+	for (i = 0; i < NTYPES; i++) {
+		if (types[i] == type)
+			return i;
+	}
+
+	return -1;
+}
+
+static int
+add_sample(struct samples *s, uint64_t ns)
+{
+	if (s->count == s->size) {
+		size_t size = s->size ? s->size * 2 : 4096;
+		uint64_t *tmp = realloc(s->ns, size * sizeof(*tmp));
+
+		if (!tmp)
+			return -ENOMEM;
+		s->ns = tmp;
+		s->size = size;
+	}
+
+	s->ns[s->count++] = ns;
+
+	return 0;
+}
+
+static int
+cmp_ns(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a;
+	uint64_t y = *(const uint64_t *)b;
+
+	return x < y ? -1 : x > y;
+}
+
+/**
+ * @return the nearest-rank percentile of the sorted samples in us
+ */
+static double
+percentile(const struct samples *s, double p)
+{
+	double rank = p * s->count;
+	size_t idx = (size_t)rank;
+
+	if (idx < rank)
+		idx++;
+	if (idx > s->count)
+		idx = s->count;
+
+	return s->ns[idx > 0 ? idx - 1 : 0] / 1000.0;
+}
+
+static struct libevdev *
+create_template(void)
+{
+	struct libevdev *dev = libevdev_new();
+	struct input_absinfo abs = { .maximum = 1000 };
+
+	libevdev_set_name(dev, "libevdev latency test device");
+	libevdev_enable_event_code(dev, EV_REL, REL_X, NULL);
+	libevdev_enable_event_code(dev, EV_ABS, ABS_X, &abs);
+	libevdev_enable_event_code(dev, EV_KEY, BTN_LEFT, NULL);
+	libevdev_enable_event_code(dev, EV_KEY, BTN_RIGHT, NULL);
+
+	return dev;
+}
+
+/**
+ * Write frames at the given rate for the given duration, then a BTN_RIGHT
+ * press and release to tell the reader we're done. Runs in the forked
+ * child.
+ */
+static int
+write_frames(struct libevdev_uinput *uidev, int rate, int duration)
+{
+	const struct input_event done[] = {
+		{ .type = EV_KEY, .code = BTN_RIGHT, .value = 1 },
+		{ .type = EV_SYN, .code = SYN_REPORT, .value = 0 },
+		{ .type = EV_KEY, .code = BTN_RIGHT, .value = 0 },
+		{ .type = EV_SYN, .code = SYN_REPORT, .value = 0 },
+	};
+	uint64_t start, next, end;
+	uint64_t frame = 0;
+	int rc = 0;
+
+	start = now_ns();
+	end = start + (uint64_t)duration * 1000000000;
+	next = start;
+
+	while (next < end) {
+		/* values always differ from the previous frame, so the
+		 * kernel doesn't filter any of them */
+		struct input_event frame_events[] = {
+			{ .type = EV_REL, .code = REL_X, .value = frame % 2 ? 1 : -1 },
+			{ .type = EV_ABS, .code = ABS_X, .value = frame % 1000 },
+			{ .type = EV_KEY, .code = BTN_LEFT, .value = frame % 2 },
+			{ .type = EV_SYN, .code = SYN_REPORT, .value = 0 },
+		};
+		struct timespec ts = {
+			.tv_sec = next / 1000000000,
+			.tv_nsec = next % 1000000000,
+		};
+
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+
+		rc = libevdev_uinput_write_events(uidev, frame_events,
+						  sizeof(frame_events) / sizeof(frame_events[0]));
+		if (rc < 0)
+			break;
+
+		frame++;
+		next = start + frame * 1000000000 / rate;
+	}
+
+	if (libevdev_uinput_write_events(uidev, done, sizeof(done) / sizeof(done[0])) < 0)
+		return 1;
+
+	return rc < 0 ? 1 : 0;
+}
+
+/**
+ * Skip over the events of a SYN_DROPPED sync, they are libevdev's
+ * reconstructed state and have no meaningful latency.
+ */
+static int
+skip_sync(struct libevdev *dev)
+{
+	struct input_event ev;
+	int rc;
+
+	do {
+		rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_SYNC, &ev);
+	} while (rc == LIBEVDEV_READ_STATUS_SYNC);
+
+	return rc == -EAGAIN ? 0 : rc;
+}
+
+/**
+ * Record the latency of one event read at the given time.
+ *
+ * @return 1 if the event ends the run, 0 if it was recorded, or a
+ * negative errno
+ */
+static int
+record_event(struct run *run, const struct input_event *ev, uint64_t now)
+{
+	int idx;
+
+	if (ev->type == EV_KEY && ev->code == BTN_RIGHT)
+		return ev->value == 0 ? 1 : 0;
+
+	idx = type_index(ev->type);
+	if (idx < 0)
+		return 0;
+
+	return add_sample(&run->samples[idx], now - event_ns(ev));
+}
+
+/**
+ * Read the events of one writer run.
+ *
+ * @return 0 on success or a negative errno
+ */
+static int
+read_frames(struct libevdev *dev, enum read_mode mode, struct run *run)
+{
+	struct pollfd fds = { .fd = libevdev_get_fd(dev), .events = POLLIN };
+	struct input_event events[MAX_BATCH];
+	unsigned int flags = LIBEVDEV_READ_FLAG_NORMAL;
+	int rc = 0;
+
+	if (mode == MODE_BLOCKING)
+		flags |= LIBEVDEV_READ_FLAG_BLOCKING;
+
+	while (rc == 0) {
+		size_t nevents = 0;
+		uint64_t now;
+		size_t i;
+
+		if (mode != MODE_BLOCKING && poll(&fds, 1, -1) < 0)
+			return -errno;
+
+		/* in batch mode everything pending is read before taking
+		 * the timestamp, the other modes take one per event */
+		do {
+			rc = libevdev_next_event(dev, flags, &events[nevents]);
+			if (rc == LIBEVDEV_READ_STATUS_SYNC) {
+				run->dropped++;
+				rc = skip_sync(dev);
+				if (rc < 0)
+					return rc;
+				continue;
+			}
+			if (rc < 0)
+				break;
+
+			if (mode != MODE_BATCH) {
+				rc = record_event(run, &events[0], now_ns());
+				if (rc != 0)
+					break;
+			} else {
+				nevents++;
+			}
+		} while (mode != MODE_BLOCKING && nevents < MAX_BATCH);
+
+		if (rc == -EAGAIN)
+			rc = 0;
+		if (rc != 0)
+			break;
+
+		now = now_ns();
+		for (i = 0; i < nevents && rc == 0; i++)
+			rc = record_event(run, &events[i], now);
+	}
+
+	return rc < 0 ? rc : 0;
+}
+
+/**
+ * Discard whatever is left over from the previous run.
+ */
+static void
+drain(struct libevdev *dev)
+{
+	struct input_event ev;
+	int rc;
+
+	do {
+		rc = libevdev_next_event(dev, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+		if (rc == LIBEVDEV_READ_STATUS_SYNC)
+			rc = skip_sync(dev);
+	} while (rc >= 0);
+}
+
+static int
+run_mode(struct libevdev_uinput *uidev, struct libevdev *dev,
+	 enum read_mode mode, int rate, int duration, struct run *run)
+{
+	int fd = libevdev_get_fd(dev);
+	int flags = fcntl(fd, F_GETFL) | O_NONBLOCK;
+	int status;
+	pid_t pid;
+	int rc;
+
+	if (fcntl(fd, F_SETFL, flags) < 0)
+		return -errno;
+	drain(dev);
+
+	if (mode == MODE_BLOCKING && fcntl(fd, F_SETFL, flags & ~O_NONBLOCK) < 0)
+		return -errno;
+
+	fflush(stdout);
+
+	pid = fork();
+	if (pid < 0)
+		return -errno;
+	if (pid == 0) {
+		/* don't destroy the device on exit, the parent owns it */
+		_exit(write_frames(uidev, rate, duration));
+	}
+
+	rc = read_frames(dev, mode, run);
+	if (rc < 0)
+		kill(pid, SIGTERM);
+
+	waitpid(pid, &status, 0);
+	if (rc == 0 && (!WIFEXITED(status) || WEXITSTATUS(status) != 0))
+		rc = -EIO;
+
+	return rc;
+}
+
+static void
+print_run(const char *mode, struct run *run)
+{
+	size_t i;
+
+	for (i = 0; i < NTYPES; i++) {
+		struct samples *s = &run->samples[i];
+
+		if (s->count == 0)
+			continue;
+
+		qsort(s->ns, s->count, sizeof(*s->ns), cmp_ns);
+		printf("%-9s %-7s %9zu %9.1f %9.1f %9.1f %9.1f\n",
+		       mode, libevdev_event_type_get_name(types[i]), s->count,
+		       percentile(s, 0.5), percentile(s, 0.99),
+		       percentile(s, 0.999), s->ns[s->count - 1] / 1000.0);
+	}
+
+	if (run->dropped)
+		printf("%-9s %lu SYN_DROPPED, events in the sync not counted\n",
+		       mode, run->dropped);
+}
+
+static int
+parse_mode(const char *str, unsigned int *mask)
+{
+	size_t i;
+
+	for (i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+		if (strcmp(str, modes[i].name) == 0) {
+			*mask |= modes[i].mode;
+			return 0;
+		}
+	}
+
+	return -1;
+}
+
+int
+main(int argc, char **argv)
+{
+	struct libevdev_uinput *uidev = NULL;
+	struct libevdev *dev = NULL;
+	unsigned int mask = 0;
+	int rate = 1000, duration = 2;
+	int fd = -1;
+	size_t i, j;
+	int rc = 1;
+
+	while (1) {
+		static struct option opts[] = {
+			{ "mode", 1, 0, OPT_MODE },
+			{ "rate", 1, 0, OPT_RATE },
+			{ "duration", 1, 0, OPT_DURATION },
+			{ "help", 0, 0, OPT_HELP },
+			{ NULL, 0, 0, 0 },
+		};
+		int option_index = 0;
+		int c;
+
+		c = getopt_long(argc, argv, "h", opts, &option_index);
+		if (c == -1)
+			break;
+
+		switch (c) {
+			case 'h':
+			case OPT_HELP:
+				usage(basename(argv[0]));
+				return 0;
+			case OPT_MODE:
+				if (parse_mode(optarg, &mask) != 0) {
+					fprintf(stderr, "Invalid mode: %s\n", optarg);
+					return 1;
+				}
+				break;
+			case OPT_RATE:
+				if (!safe_atoi(optarg, &rate) || rate <= 0) {
+					fprintf(stderr, "Invalid rate: %s\n", optarg);
+					return 1;
+				}
+				break;
+			case OPT_DURATION:
+				if (!safe_atoi(optarg, &duration) || duration <= 0) {
+					fprintf(stderr, "Invalid duration: %s\n", optarg);
+					return 1;
+				}
+				break;
+			default:
+				usage(basename(argv[0]));
+				return 1;
+		}
+	}
+
+	if (optind < argc) {
+		usage(basename(argv[0]));
+		return 1;
+	}
+
+	if (mask == 0)
+		mask = MODE_BLOCKING | MODE_POLL | MODE_BATCH;
+
+	dev = create_template();
+	rc = libevdev_uinput_create_from_device(dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &uidev);
+	libevdev_free(dev);
+	dev = NULL;
+	if (rc < 0) {
+		fprintf(stderr, "Failed to create device: %s\n", strerror(-rc));
+		rc = 1;
+		goto out;
+	}
+
+	fd = open(libevdev_uinput_get_devnode(uidev), O_RDONLY|O_NONBLOCK|O_CLOEXEC);
+	if (fd < 0) {
+		fprintf(stderr, "Failed to open %s: %s\n",
+			libevdev_uinput_get_devnode(uidev), strerror(errno));
+		rc = 1;
+		goto out;
+	}
+
+	rc = libevdev_new_from_fd(fd, &dev);
+	if (rc == 0)
+		rc = libevdev_set_clock_id(dev, CLOCK_MONOTONIC);
+	if (rc < 0) {
+		fprintf(stderr, "Failed to initialize device: %s\n", strerror(-rc));
+		rc = 1;
+		goto out;
+	}
+
+	printf("%s: %d frames/s for %ds per mode\n",
+	       libevdev_uinput_get_devnode(uidev), rate, duration);
+	printf("%-9s %-7s %9s %9s %9s %9s %9s\n",
+	       "mode", "type", "events", "p50 us", "p99 us", "p999 us", "max us");
+
+	for (i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+		struct run run = {0};
+
+		if (!(mask & modes[i].mode))
+			continue;
+
+		rc = run_mode(uidev, dev, modes[i].mode, rate, duration, &run);
+		if (rc == 0)
+			print_run(modes[i].name, &run);
+
+		for (j = 0; j < NTYPES; j++)
+			free(run.samples[j].ns);
+
+		if (rc < 0) {
+			fprintf(stderr, "Failed to measure %s: %s\n",
+				modes[i].name, strerror(-rc));
+			rc = 1;
+			goto out;
+		}
+	}
+
+	rc = 0;
+out:
+	libevdev_free(dev);
+	if (fd >= 0)
+		close(fd);
+	libevdev_uinput_destroy(uidev);
+
+	return rc;
+}
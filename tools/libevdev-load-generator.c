@@ -0,0 +1,416 @@
+// SPDX-License-Identifier: MIT
+/*
+ * Copyright © 2026 Red Hat, Inc.
+ */
+
+#include "config.h"
+
+#include <errno.h>
+#include <getopt.h>
+#include <libgen.h>
+#include <limits.h>
+#include <linux/input.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "libevdev/libevdev.h"
+#include "libevdev/libevdev-uinput.h"
+
+#define NTOUCHES 10
+/* the largest frame any generator produces: slot, tracking id, x and y
+ * per touch, BTN_TOUCH, ABS_X, ABS_Y and SYN_REPORT */
+#define MAX_FRAME_SIZE (NTOUCHES * 4 + 4)
+
+static int signalled = 0;
+
+enum device_type {
+	DEVICE_MOUSE = 1 << 0,
+	DEVICE_KEYBOARD = 1 << 1,
+	DEVICE_TOUCH = 1 << 2,
+};
+
+enum opts {
+	OPT_DEVICE = 1,
+	OPT_RATE,
+	OPT_BATCH,
+	OPT_DURATION,
+	OPT_HELP,
+};
+
+struct generator {
+	const char *name;
+	enum device_type type;
+	struct libevdev_uinput *uidev;
+	struct input_event *buffer; /* [batch * MAX_FRAME_SIZE] */
+	unsigned long frames;
+	unsigned long events;
+};
+
+static void
+usage(const char *progname)
+{
+	printf("Usage: %s [--device mouse|keyboard|touch] [--rate hz] [--batch frames] [--duration s]\n"
+	       "\n"
+	       "Creates uinput devices and posts synthetic events through them at a\n"
+	       "fixed rate, then prints the achieved rate and the CPU time used.\n"
+	       "\n"
+	       "--device ...	The device to create, may be given more than once.\n"
+	       "		Default: one of each. The touch device has %d slots,\n"
+	       "		all of them touching.\n"
+	       "--rate hz	The frames per second posted through each device.\n"
+	       "		Default: 1000\n"
+	       "--batch frames	The frames posted with one write(). Default: enough\n"
+	       "		frames for at most 1000 writes per second\n"
+	       "--duration s	Stop after this many seconds. Default: 5\n"
+	       "\n"
+	       "Readers that don't keep up see SYN_DROPPED once the kernel's buffer\n"
+	       "for them is full, a large batch fills it at once.\n",
+	       progname, NTOUCHES);
+}
+
+static void
+signal_handler(__attribute__((__unused__)) int signal)
+{
+	signalled++;
+}
+
+static inline bool
+safe_atoi(const char *str, int *val)
+{
+	char *endptr;
+	long v;
+
+	v = strtol(str, &endptr, 10);
+	if (str == endptr)
+		return false;
+	if (*str != '\0' && *endptr != '\0')
+		return false;
+
+	if (v > INT_MAX || v < INT_MIN)
+		return false;
+
+	*val = v;
+	return true;
+}
+
+static inline uint64_t
+now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static inline double
+cpu_seconds(void)
+{
+	struct rusage ru;
+
+	getrusage(RUSAGE_SELF, &ru);
+	return ru.ru_utime.tv_sec + ru.ru_utime.tv_usec / 1e6 +
+	       ru.ru_stime.tv_sec + ru.ru_stime.tv_usec / 1e6;
+}
+
+static struct libevdev *
+create_template(enum device_type type)
+{
+	struct libevdev *dev = libevdev_new();
+	struct input_absinfo abs = { .maximum = 4000, .resolution = 40 };
+	struct input_absinfo slots = { .maximum = NTOUCHES - 1 };
+	struct input_absinfo tracking_id = { .minimum = -1, .maximum = 0xffff };
+	unsigned int code;
+
+	switch (type) {
+		case DEVICE_MOUSE:
+			libevdev_set_name(dev, "libevdev load generator mouse");
+			libevdev_enable_event_code(dev, EV_REL, REL_X, NULL);
+			libevdev_enable_event_code(dev, EV_REL, REL_Y, NULL);
+			libevdev_enable_event_code(dev, EV_KEY, BTN_LEFT, NULL);
+			libevdev_enable_event_code(dev, EV_KEY, BTN_RIGHT, NULL);
+			break;
+		case DEVICE_KEYBOARD:
+			libevdev_set_name(dev, "libevdev load generator keyboard");
+			for (code = KEY_ESC; code <= KEY_MICMUTE; code++)
+				libevdev_enable_event_code(dev, EV_KEY, code, NULL);
+			break;
+		case DEVICE_TOUCH:
+			libevdev_set_name(dev, "libevdev load generator touch");
+			libevdev_enable_event_code(dev, EV_KEY, BTN_TOUCH, NULL);
+			libevdev_enable_event_code(dev, EV_ABS, ABS_X, &abs);
+			libevdev_enable_event_code(dev, EV_ABS, ABS_Y, &abs);
+			libevdev_enable_event_code(dev, EV_ABS, ABS_MT_SLOT, &slots);
+			libevdev_enable_event_code(dev, EV_ABS, ABS_MT_POSITION_X, &abs);
+			libevdev_enable_event_code(dev, EV_ABS, ABS_MT_POSITION_Y, &abs);
+			libevdev_enable_event_code(dev, EV_ABS, ABS_MT_TRACKING_ID, &tracking_id);
+			libevdev_enable_property(dev, INPUT_PROP_DIRECT);
+			break;
+	}
+
+	return dev;
+}
+
+static inline struct input_event *
+add_event(struct input_event *ev, unsigned int type, unsigned int code, int value)
+{
+	ev->type = type;
+	ev->code = code;
+	ev->value = value;
+
+	return ev + 1;
+}
+
+/**
+ * Fill in the given frame number.
+ *
+ * @return the number of events in the frame
+ */
+static size_t
+fill_frame(enum device_type type, unsigned long frame, struct input_event *events)
+{
+	struct input_event *ev = events;
+	int slot;
+
+	switch (type) {
+		case DEVICE_MOUSE:
+			/* a circle-ish motion, a click every 100 frames */
+			ev = add_event(ev, EV_REL, REL_X, (frame / 50) % 2 ? 1 : -1);
+			ev = add_event(ev, EV_REL, REL_Y, (frame / 25) % 2 ? 1 : -1);
+			if (frame % 100 == 0)
+				ev = add_event(ev, EV_KEY, BTN_LEFT, (frame / 100) % 2);
+			break;
+		case DEVICE_KEYBOARD:
+			/* press and release a to z in turn */
+			ev = add_event(ev, EV_KEY,
+				       KEY_A + (frame / 2) % 26,
+				       frame % 2 == 0);
+			break;
+		case DEVICE_TOUCH:
+			if (frame == 0)
+				ev = add_event(ev, EV_KEY, BTN_TOUCH, 1);
+			for (slot = 0; slot < NTOUCHES; slot++) {
+				int pos = 200 + slot * 300 + frame % 200;
+
+				ev = add_event(ev, EV_ABS, ABS_MT_SLOT, slot);
+				if (frame == 0)
+					ev = add_event(ev, EV_ABS, ABS_MT_TRACKING_ID, slot);
+				ev = add_event(ev, EV_ABS, ABS_MT_POSITION_X, pos);
+				ev = add_event(ev, EV_ABS, ABS_MT_POSITION_Y, pos);
+			}
+			ev = add_event(ev, EV_ABS, ABS_X, 200 + frame % 200);
+			ev = add_event(ev, EV_ABS, ABS_Y, 200 + frame % 200);
+			break;
+	}
+
+	ev = add_event(ev, EV_SYN, SYN_REPORT, 0);
+
+	return ev - events;
+}
+
+static int
+post_batch(struct generator *g, unsigned int batch)
+{
+	size_t nevents = 0;
+	unsigned int i;
+
+	for (i = 0; i < batch; i++)
+		nevents += fill_frame(g->type, g->frames + i, &g->buffer[nevents]);
+
+	g->frames += batch;
+	g->events += nevents;
+
+	return libevdev_uinput_write_events(g->uidev, g->buffer, nevents);
+}
+
+static int
+parse_device(const char *str, unsigned int *devices)
+{
+	if (strcmp(str, "mouse") == 0)
+		*devices |= DEVICE_MOUSE;
+	else if (strcmp(str, "keyboard") == 0)
+		*devices |= DEVICE_KEYBOARD;
+	else if (strcmp(str, "touch") == 0)
+		*devices |= DEVICE_TOUCH;
+	else
+		return -1;
+
+	return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+	struct generator generators[] = {
+		{ .name = "mouse", .type = DEVICE_MOUSE },
+		{ .name = "keyboard", .type = DEVICE_KEYBOARD },
+		{ .name = "touch", .type = DEVICE_TOUCH },
+	};
+	const size_t ngenerators = sizeof(generators) / sizeof(generators[0]);
+	unsigned int devices = 0;
+	int rate = 1000, batch = 0, duration = 5;
+	uint64_t start, next, period, end;
+	double cpu_start, cpu, wall;
+	unsigned long ticks = 0;
+	size_t i;
+	int rc = 1;
+
+	while (1) {
+		static struct option opts[] = {
+			{ "device", 1, 0, OPT_DEVICE },
+			{ "rate", 1, 0, OPT_RATE },
+			{ "batch", 1, 0, OPT_BATCH },
+			{ "duration", 1, 0, OPT_DURATION },
+			{ "help", 0, 0, OPT_HELP },
+			{ NULL, 0, 0, 0 },
+		};
+		int option_index = 0;
+		int c;
+
+		c = getopt_long(argc, argv, "h", opts, &option_index);
+		if (c == -1)
+			break;
+
+		switch (c) {
+			case 'h':
+			case OPT_HELP:
+				usage(basename(argv[0]));
+				return 0;
+			case OPT_DEVICE:
+				if (parse_device(optarg, &devices) != 0) {
+					fprintf(stderr, "Invalid device: %s\n", optarg);
+					return 1;
+				}
+				break;
+			case OPT_RATE:
+				if (!safe_atoi(optarg, &rate) || rate <= 0) {
+					fprintf(stderr, "Invalid rate: %s\n", optarg);
+					return 1;
+				}
+				break;
+			case OPT_BATCH:
+				if (!safe_atoi(optarg, &batch) || batch <= 0) {
+					fprintf(stderr, "Invalid batch size: %s\n", optarg);
+					return 1;
+				}
+				break;
+			case OPT_DURATION:
+				if (!safe_atoi(optarg, &duration) || duration <= 0) {
+					fprintf(stderr, "Invalid duration: %s\n", optarg);
+					return 1;
+				}
+				break;
+			default:
+				usage(basename(argv[0]));
+				return 1;
+		}
+	}
+
+	if (optind < argc) {
+		usage(basename(argv[0]));
+		return 1;
+	}
+
+	if (devices == 0)
+		devices = DEVICE_MOUSE | DEVICE_KEYBOARD | DEVICE_TOUCH;
+	if (batch == 0)
+		batch = (rate + 999) / 1000;
+
+	for (i = 0; i < ngenerators; i++) {
+		struct generator *g = &generators[i];
+		struct libevdev *dev;
+
+		if (!(devices & g->type))
+			continue;
+
+		g->buffer = calloc((size_t)batch * MAX_FRAME_SIZE, sizeof(*g->buffer));
+		if (!g->buffer) {
+			fprintf(stderr, "Out of memory\n");
+			rc = 1;
+			goto out;
+		}
+
+		dev = create_template(g->type);
+		rc = libevdev_uinput_create_from_device(dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &g->uidev);
+		libevdev_free(dev);
+		if (rc < 0) {
+			fprintf(stderr, "Failed to create %s: %s\n", g->name, strerror(-rc));
+			rc = 1;
+			goto out;
+		}
+
+		printf("%s: %s\n", g->name, libevdev_uinput_get_devnode(g->uidev));
+	}
+
+	printf("Posting %d frames/s per device in batches of %d for %ds\n",
+	       rate, batch, duration);
+
+	signal(SIGINT, signal_handler);
+
+	period = (uint64_t)batch * 1000000000 / rate;
+	start = now_ns();
+	cpu_start = cpu_seconds();
+	end = start + (uint64_t)duration * 1000000000;
+	next = start;
+
+	while (!signalled && next < end) {
+		struct timespec ts = {
+			.tv_sec = next / 1000000000,
+			.tv_nsec = next % 1000000000,
+		};
+
+		/* absolute deadlines, if we fall behind we catch up as
+		 * fast as we can */
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+
+		for (i = 0; i < ngenerators; i++) {
+			struct generator *g = &generators[i];
+
+			if (!g->uidev)
+				continue;
+
+			rc = post_batch(g, batch);
+			if (rc < 0) {
+				fprintf(stderr, "Failed to write to %s: %s\n",
+					g->name, strerror(-rc));
+				rc = 1;
+				goto out;
+			}
+		}
+
+		ticks++;
+		next = start + ticks * period;
+	}
+
+	wall = (now_ns() - start) / 1e9;
+	cpu = cpu_seconds() - cpu_start;
+
+	for (i = 0; i < ngenerators; i++) {
+		struct generator *g = &generators[i];
+
+		if (!g->uidev)
+			continue;
+
+		printf("%-8s %10lu frames %12lu events %10.0f frames/s %12.0f events/s\n",
+		       g->name, g->frames, g->events,
+		       g->frames / wall, g->events / wall);
+	}
+	printf("CPU time: %.3fs in %.3fs (%.1f%%), %.2f us per write\n",
+	       cpu, wall, cpu / wall * 100,
+	       ticks ? cpu * 1e6 / (ticks * (double)__builtin_popcount(devices)) : 0.0);
+
+	rc = 0;
+out:
+	for (i = 0; i < ngenerators; i++) {
+		libevdev_uinput_destroy(generators[i].uidev);
+		free(generators[i].buffer);
+	}
+
+	return rc;
+}